@@ -0,0 +1,210 @@
+/******************************************************************************/
+/** \file       cyclicBench.c
+ *******************************************************************************
+ *
+ *  \brief      Host benchmark of the cyclic executive dispatch. Compares the
+ *              precomputed dispatch lists of cyclicExec.c with the former
+ *              scan of the whole table (one modulo per entry and frame) for
+ *              tables of 4 up to 512 entries.
+ *              The phases of the tables are set by u32CyclicBalance, the
+ *              peak frame load before (all phases 0) and after is shown.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Peak load of the balancer
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              main
+ *  functions  local:
+ *              vBenchTask
+ *              vBenchScan
+ *              u64BenchNow
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <time.h>
+
+#include "cyclicExec.h"
+
+//----- Macros -----------------------------------------------------------------
+#define BENCH_MAX_ENTRIES   ( 512 )     /* Largest table                      */
+#define BENCH_VISITS        ( 4000000 ) /* Table entries visited per size     */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static void vBenchTask(void *pvData) __attribute__((noinline));
+static void vBenchScan(TableEntry *psTable, uint32_t u32Cycle)
+__attribute__((noinline));
+static uint64_t u64BenchNow(void);
+
+//----- Data -------------------------------------------------------------------
+/* Periods of the generated tables, hyperperiod 20 frames */
+static const uint32_t u32Periods[] = {1, 2, 4, 5, 10, 20};
+
+static TableEntry sTable[BENCH_MAX_ENTRIES + 1];
+static volatile uint32_t u32BenchCalls;
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    main
+ ******************************************************************************/
+/** \brief        Run both dispatchers on tables of growing size
+ *
+ *  \type         global
+ *
+ *  \return       0 on success, 1 if the dispatchers disagree
+ *
+ ******************************************************************************/
+int main(void) {
+
+    uint32_t u32Entries;
+    uint32_t u32Task;
+    uint32_t u32Hyper;
+    uint32_t u32Rounds;
+    uint32_t u32Round;
+    uint32_t u32Frame;
+    uint32_t u32ScanCalls;
+    uint32_t u32ListCalls;
+    uint64_t u64Start;
+    uint64_t u64Scan;
+    uint64_t u64List;
+    uint64_t u64Frames;
+    CyclicBalance sBalance;
+
+    printf("entries  hyper  peak us before/after  "
+           "calls/frame  scan ns/frame  lists ns/frame  speedup\n");
+
+    for (u32Entries = 4; u32Entries <= BENCH_MAX_ENTRIES; u32Entries *= 2) {
+        /* Mixed periods and WCETs, all phases 0 until balanced */
+        for (u32Task = 0; u32Task < u32Entries; u32Task++) {
+            sTable[u32Task].u32CyclicActivation =
+                u32Periods[u32Task % (sizeof(u32Periods) / sizeof(u32Periods[0]))];
+            sTable[u32Task].u32FirstActivation = 0;
+            sTable[u32Task].pfFunction = vBenchTask;
+            sTable[u32Task].u32Wcet = 10 + ((u32Task * 37) % 90);
+        }
+        sTable[u32Entries].u32CyclicActivation = 0;
+        sTable[u32Entries].u32FirstActivation = 0;
+        sTable[u32Entries].pfFunction = LAST_ENTRY;
+        sTable[u32Entries].u32Wcet = 0;
+
+        u32CyclicBalance(sTable, &sBalance);
+        u32Hyper = u32CyclicInit(sTable, 1);
+        if (u32Hyper == 0) {
+            printf("%7u  table does not fit\n", (unsigned) u32Entries);
+            return 1;
+        }
+        u32Rounds = BENCH_VISITS / (u32Entries * u32Hyper) + 1;
+        u64Frames = (uint64_t) u32Rounds * u32Hyper;
+
+        u32BenchCalls = 0;
+        u64Start = u64BenchNow();
+        for (u32Round = 0; u32Round < u32Rounds; u32Round++) {
+            for (u32Frame = 0; u32Frame < u32Hyper; u32Frame++) {
+                vBenchScan(sTable, u32Frame);
+            }
+        }
+        u64Scan = u64BenchNow() - u64Start;
+        u32ScanCalls = u32BenchCalls;
+
+        u32BenchCalls = 0;
+        u64Start = u64BenchNow();
+        for (u32Round = 0; u32Round < u32Rounds; u32Round++) {
+            for (u32Frame = 0; u32Frame < u32Hyper; u32Frame++) {
+                vCyclicDispatch(u32Frame);
+            }
+        }
+        u64List = u64BenchNow() - u64Start;
+        u32ListCalls = u32BenchCalls;
+
+        if (u32ScanCalls != u32ListCalls) {
+            printf("%7u  call count differs: scan %u, lists %u\n",
+                   (unsigned) u32Entries, (unsigned) u32ScanCalls,
+                   (unsigned) u32ListCalls);
+            return 1;
+        }
+        printf("%7u  %5u  %9u/%-10u  %11.1f  %13.1f  %14.1f  %6.2fx\n",
+               (unsigned) u32Entries, (unsigned) u32Hyper,
+               (unsigned) sBalance.u32PeakBefore,
+               (unsigned) sBalance.u32PeakAfter,
+               (double) u32ListCalls / (double) u64Frames,
+               (double) u64Scan / (double) u64Frames,
+               (double) u64List / (double) u64Frames,
+               (double) u64Scan / (double) (u64List ? u64List : 1));
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    vBenchTask
+ ******************************************************************************/
+/** \brief        Table entry doing nothing but counting its calls
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvData    not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchTask(void *pvData) {
+
+    u32BenchCalls++;
+}
+
+/*******************************************************************************
+ *  function :    vBenchScan
+ ******************************************************************************/
+/** \brief        Former dispatch: scan the whole table every frame
+ *
+ *  \type         local
+ *
+ *  \param[in]    psTable   Table terminated by LAST_ENTRY
+ *  \param[in]    u32Cycle  Frame within the hyperperiod
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchScan(TableEntry *psTable, uint32_t u32Cycle) {
+
+    uint32_t u32Task = 0;
+
+    while (psTable[u32Task].pfFunction != LAST_ENTRY) {
+        if (psTable[u32Task].u32CyclicActivation != 0) {
+            if (((u32Cycle % psTable[u32Task].u32CyclicActivation) -
+                    (psTable[u32Task].u32FirstActivation)) == 0) {
+
+                (*psTable[u32Task].pfFunction)((void*)0);
+            }
+        }
+        u32Task++;
+    }
+}
+
+/*******************************************************************************
+ *  function :    u64BenchNow
+ ******************************************************************************/
+/** \brief        Monotonic host time
+ *
+ *  \type         local
+ *
+ *  \return       time in ns
+ *
+ ******************************************************************************/
+static uint64_t u64BenchNow(void) {
+
+    struct timespec sNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &sNow);
+    return ((uint64_t) sNow.tv_sec * 1000000000ULL) + (uint64_t) sNow.tv_nsec;
+}
@@ -0,0 +1,124 @@
+/******************************************************************************/
+/** \file       simHarness.c
+ *******************************************************************************
+ *
+ *  \brief      Host harness for EZBSY_U1A1. Presses the buttons T0 and T1
+ *              on a fixed schedule of virtual ticks and prints the frame
+ *              statistics of the cyclic executive at the end of the run.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              .
+ *  functions  local:
+ *              vHarnessInit
+ *              vHarnessTick
+ *              vHarnessReport
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sim.h>
+#include "cyclicExec.h"
+
+//----- Macros -----------------------------------------------------------------
+#define BUTTON_T0       ( 0x01 )    /* Increments the value                   */
+#define BUTTON_T1       ( 0x02 )    /* Decrements the value                   */
+#define HARNESS_PERIOD  ( 4000 )    /* Length of the button schedule in ticks */
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    uint32_t u32Tick;               /* Tick at which the buttons change       */
+    uint8_t  u8Buttons;             /* New button state                       */
+} HarnessStep;
+
+//----- Function prototypes ----------------------------------------------------
+static void vHarnessInit(void) __attribute__((constructor));
+static void vHarnessTick(uint32_t u32Tick);
+static void vHarnessReport(void);
+
+//----- Data -------------------------------------------------------------------
+/* Button schedule, repeated every HARNESS_PERIOD ticks */
+static const HarnessStep sSteps[] = {
+    {1000, BUTTON_T0},
+    {1350, 0},
+    {2000, BUTTON_T1},
+    {2150, 0},
+    {3000, BUTTON_T0 | BUTTON_T1},
+    {3200, 0}
+};
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vHarnessInit
+ ******************************************************************************/
+/** \brief        Install the tick hook before main runs
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vHarnessInit(void)
+{
+
+    vSimSetTickHook(vHarnessTick);
+    atexit(vHarnessReport);
+}
+
+/*******************************************************************************
+ *  function :    vHarnessTick
+ ******************************************************************************/
+/** \brief        Apply the button schedule
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32Tick   current tick
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vHarnessTick(uint32_t u32Tick)
+{
+
+    uint32_t u32Phase = u32Tick % HARNESS_PERIOD;
+    uint32_t u32I;
+
+    for (u32I = 0; u32I < (sizeof(sSteps) / sizeof(sSteps[0])); u32I++) {
+        if (sSteps[u32I].u32Tick == u32Phase) {
+            vSimSetButtons(sSteps[u32I].u8Buttons);
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    vHarnessReport
+ ******************************************************************************/
+/** \brief        Print the statistics of the cyclic executive
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vHarnessReport(void)
+{
+
+    CyclicStats sStats;
+
+    vCyclicGetStats(&sStats);
+    printf("frames %u, overruns %u, max overrun %u ticks, leds 0x%02X\n",
+           (unsigned) sStats.u32Frames, (unsigned) sStats.u32Overruns,
+           (unsigned) sStats.u32MaxOverrunTicks, (unsigned) u8SimGetLeds());
+}
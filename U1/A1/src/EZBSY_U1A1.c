@@ -17,6 +17,10 @@
  *               \li wht4, 23.08.2011   Adapted because of consistency reason
  *               \li wht4, 24.01.2014   Adapted to CARME-M4
  *               \li WBR1, 09.02.2017   minor optimizations
+ *               \li id101010, 17.10.2026 SysTick driven frames instead of vWait
+ *               \li id101010, 17.10.2026 Hyperperiod from the table periods
+ *               \li id101010, 17.10.2026 UART for the profile report
+ *               \li id101010, 17.10.2026 Balance the phases by the WCETs
  *
  ******************************************************************************/
 /*
@@ -27,7 +31,6 @@
  *              vApplication2
  *              vApplication3
  *              vApplication4
- *              vWait
  *
  ******************************************************************************/
 
@@ -36,14 +39,17 @@
 #include <carme.h>                      /* CARME Board Support Package        */
 #include <carme_io1.h>                  /* CARMEIO1 Board Support Package     */
 #include <carme_io2.h>                  /* CARMEIO2 Board Support Package     */
+#include <uart.h>                       /* CARME BSP UART port                */
 
 #include <stdio.h>                      /* Standard Input/Output              */
 #include <stdlib.h>                     /* General Utilities                  */
 #include <string.h>                     /* String handling                    */
 
+#include "cyclicExec.h"
+
 //----- Macros -----------------------------------------------------------------
-#define LAST_ENTRY    ( 0 )     /* Last entry for table_entry table[]         */
-#define CYCLE_RESET   ( 6 )     /* Number of cycles until cycle-counter reset */
+#define FRAME_TICKS   ( 100 )   /* Length of a minor frame in ticks (ms)      */
+#define FRAME_US      ( FRAME_TICKS * 1000 ) /* Length of a minor frame in us */
 
 #define Y_HEADERLINE  ( 1 )     /* Pixel y-pos for headerline                 */
 #define Y_VALUE       ( 100 )   /* Pixel y-pos for value                      */
@@ -58,31 +64,26 @@
 
 //----- Data types -------------------------------------------------------------
 
-/* struct describing a table entry for cyclical OS */
-typedef struct   {
-    uint32_t u32FirstActivation;    /* Cycle when action is called first time */
-    uint32_t u32CyclicActivation;   /* Periodic cycle */
-    void     (*pfFunction)(void*);  /* Function pointer to action */
-} TableEntry;
-
 //----- Function prototypes ----------------------------------------------------
 static void  vApplication1(void *pvDdata);
 static void  vApplication2(void *pvDdata);
 static void  vApplication3(void *pvDdata);
 static void  vApplication4(void *pvDdata);
-static void  vWait(void);
 
 //----- Data -------------------------------------------------------------------
 static uint8_t  u8ButtonData;       /* Holds the value of the buttons  */
 static int8_t   s8DisplayValue;     /* Holds the displayed value */
 
-/* Table defining cyclical OS */
+/* Table defining cyclical OS, the WCETs (us) are upper bounds taken from
+ * the profile report. The first activations are set by u32CyclicBalance,
+ * with every period 1 they all stay 0 and the peak load is unchanged. The
+ * tables with mixed periods of bench/cyclicBench.c show the balancing. */
 TableEntry sTableEntry[] = {
-    {0, 1, vApplication1},
-    {0, 1, vApplication2},
-    {0, 1, vApplication3},
-    {0, 1, vApplication4},
-    {0, 0, LAST_ENTRY}
+    {0, 1, vApplication1,  10},
+    {0, 1, vApplication2,  10},
+    {0, 1, vApplication3,  10},
+    {0, 1, vApplication4, 400},
+    {0, 0, LAST_ENTRY,      0}
 };
 
 /* Text to display */
@@ -90,6 +91,8 @@ static const char* pcHello = "EZBSY U1A1: Hello cyclical OS";/* Welcome text
 static const char* pcValueText = "Value = %d";   /* Text to display value     */
 static const char* pcInstructionLine1 = "Button 0 increment value";
 static const char* pcInstructionLine2 = "Button 1 decrement value";
+static const char* pcTableError = "Table does not fit";
+static const char* pcLoadText = "Peak frame load %u.%u%% -> %u.%u%%\r\n";
 
 //----- Implementation ---------------------------------------------------------
 
@@ -105,8 +108,7 @@ static const char* pcInstructionLine2 = "Button 1 decrement value";
  ******************************************************************************/
 int  main(void) {
 
-    static uint32_t u32Cycle = 0;         /* Counts number of cycles */
-    uint8_t         u8Task;
+    CyclicBalance sBalance;
 
     /* Initialize board: CPU, LED's, and GUI */
     CARME_IO1_Init();
@@ -119,34 +121,29 @@ int  main(void) {
     LCD_DisplayStringXY(X_BORDER, Y_INSTR1, pcInstructionLine1);
     LCD_DisplayStringXY(X_BORDER, Y_INSTR2, pcInstructionLine2);
 
-    /* Endless loop */
-    while (1) {
-        u8Task = 0;    /* Start with first table entry */
-
-        /* Process table and call task if necessary */
-        /* Still task in table?                     */
-        while (sTableEntry[u8Task].pfFunction != LAST_ENTRY) {
-            /* Modulo 0 yields undefined result! Prevent this */
-            if(sTableEntry[u8Task].u32CyclicActivation != 0) {
-                /* Call  task? */
-                if (((u32Cycle % sTableEntry[u8Task].u32CyclicActivation) -
-                        (sTableEntry[u8Task].u32FirstActivation)) == 0)   {
-
-                    (*sTableEntry[u8Task].pfFunction)((void*)0);
-                }
-            }
-            u8Task++;  /* Prepare next task */
-        }
+    /* Initialize UART, printf of the profile report goes there */
+    USART_InitTypeDef USART_InitStruct;
+    USART_StructInit(&USART_InitStruct);
+    USART_InitStruct.USART_BaudRate = 115200;
+    CARME_UART_Init(CARME_UART0, &USART_InitStruct);
+
+    /* Spread the entries over the frames, report the busiest frame */
+    if (u32CyclicBalance(sTableEntry, &sBalance) != 0) {
+        printf(pcLoadText,
+               (unsigned) (sBalance.u32PeakBefore * 100 / FRAME_US),
+               (unsigned) (sBalance.u32PeakBefore * 1000 / FRAME_US % 10),
+               (unsigned) (sBalance.u32PeakAfter * 100 / FRAME_US),
+               (unsigned) (sBalance.u32PeakAfter * 1000 / FRAME_US % 10));
+    }
 
-        /* Prepare next cycle and check if counter has to be reset */
-        u32Cycle++;
-        if (u32Cycle >= CYCLE_RESET) {
-            u32Cycle = 0;
+    /* Process the table once per frame, sleep in between */
+    if (u32CyclicInit(sTableEntry, FRAME_TICKS) == 0) {
+        LCD_DisplayStringXY(X_BORDER, Y_VALUE, pcTableError);
+        while (1) {
         }
-
-        /* Wait some time before processing next loop */
-        vWait();
     }
+    vCyclicRun();
+
     return(0);      // Code never reached because of endless loop
 }
 
@@ -260,23 +257,3 @@ static void  vApplication4 (void *pvData) {
     LCD_DisplayStringXY(X_BORDER, Y_VALUE, cBuffer);
 
 }
-
-/*******************************************************************************
- *  function :    wait
- ******************************************************************************/
-/** \brief        Wait some time using CPU
- *
- *  \type         local
- *
- *  \return       void
- *
- ******************************************************************************/
-static void vWait(void) {
-
-    uint32_t i, j;
-
-    for (i=0; i<1000; i++) {
-        for (j=0; j<2000; j++) {
-        }
-    }
-}
@@ -0,0 +1,522 @@
+/******************************************************************************/
+/** \file       cyclicExec.c
+ *******************************************************************************
+ *
+ *  \brief      Tick driven cyclic executive. The SysTick defines the time
+ *              base, a minor frame lasts a fixed number of ticks. The table
+ *              is processed at the beginning of every minor frame, the rest of
+ *              the frame is spent sleeping with WFI.
+ *              If the table entries of a frame are still running when the
+ *              next frame is due, the frame is counted as overrun and the
+ *              next frame is started immediately.
+ *              The table is not scanned at run time. At init the hyperperiod
+ *              (least common multiple of all periods) is computed and the
+ *              functions due in each of its frames are stored in a list, so
+ *              a frame only costs the calls which are due, without divisions.
+ *              An entry runs in the frames n with n = u32FirstActivation
+ *              modulo u32CyclicActivation. u32CyclicBalance spreads the
+ *              entries over the frames with a greedy heuristic: the entries
+ *              are placed by decreasing WCET, each one at the phase where
+ *              the busiest of its frames gets least loaded.
+ *              The profiler times every call and every frame start, its report
+ *              is printed one line per frame after the dispatch.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Precomputed dispatch lists
+ *               \li id101010, 17.10.2026, Execution time profiling
+ *               \li id101010, 17.10.2026, Phase balancing, offsets fixed
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              u32CyclicBalance
+ *              u32CyclicInit
+ *              vCyclicDispatch
+ *              vCyclicRun
+ *              vCyclicTick
+ *              vCyclicGetStats
+ *  functions  local:
+ *              u32Hyperperiod
+ *              u32PeakLoad
+ *              u32Gcd
+ *              vWaitForFrame
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stm32f4xx.h>                  /* Processor STM32F407IG              */
+#include <stddef.h>                     /* NULL                               */
+
+#include "cyclicExec.h"
+#include "cyclicProfile.h"
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static uint32_t u32Hyperperiod(TableEntry *psTable);
+static uint32_t u32PeakLoad(TableEntry *psTable, uint32_t u32Hyper);
+static uint32_t u32Gcd(uint32_t u32A, uint32_t u32B);
+static void vWaitForFrame(uint32_t u32FrameStart);
+
+//----- Data -------------------------------------------------------------------
+static TableEntry        *psCyclicTable;    /* Table to dispatch              */
+static uint32_t           u32TicksPerFrame; /* Length of a minor frame        */
+static uint32_t           u32CycleReset;    /* Minor frames per hyperperiod   */
+
+/* Dispatch lists: frame n calls the table entries u16Calls[u16First[n]] up
+ * to u16Calls[u16First[n + 1] - 1], in the order of the table */
+static uint16_t           u16First[CYCLIC_MAX_FRAMES + 1];
+static uint16_t           u16Calls[CYCLIC_MAX_CALLS];
+static uint32_t           u32Load[CYCLIC_MAX_FRAMES];  /* For balancing     */
+static volatile uint32_t  u32TickCount;     /* Incremented by the SysTick     */
+static CyclicStats        sStats;           /* Frame statistics               */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    u32CyclicBalance
+ ******************************************************************************/
+/** \brief        Assign the first activations of the table so that the
+ *                highest sum of WCETs in a frame gets small. The entries are
+ *                placed by decreasing WCET, each at the phase which gives the
+ *                lowest maximum load over the frames it runs in. Ties go to
+ *                the lower total load, then to the earlier phase.
+ *                The WCETs can be declared or taken from the profiler (max).
+ *
+ *  \type         global
+ *
+ *  \param[in]    psTable   Table, terminated by LAST_ENTRY
+ *  \param[out]   psResult  Peak frame load before and after, may be NULL
+ *
+ *  \return       Hyperperiod in minor frames, 0 if it exceeds
+ *                CYCLIC_MAX_FRAMES (the table is left unchanged)
+ *
+ ******************************************************************************/
+uint32_t u32CyclicBalance(TableEntry *psTable, CyclicBalance *psResult) {
+
+    uint32_t u32Hyper = u32Hyperperiod(psTable);
+    uint32_t u32PeakBefore;
+    uint32_t u32Task;
+    uint32_t u32Best;
+    uint32_t u32LastWcet = UINT32_MAX;  /* Key of the entry placed last */
+    uint32_t u32LastTask = 0;
+    uint32_t u32Period;
+    uint32_t u32Phase;
+    uint32_t u32Frame;
+    uint32_t u32Wcet;
+    uint32_t u32Max, u32Sum;
+    uint32_t u32BestPhase, u32BestMax, u32BestSum;
+    uint8_t  u8First = 1;
+
+    if (u32Hyper == 0) {
+        return 0;
+    }
+    u32PeakBefore = u32PeakLoad(psTable, u32Hyper);
+
+    for (u32Frame = 0; u32Frame < u32Hyper; u32Frame++) {
+        u32Load[u32Frame] = 0;
+    }
+
+    while (1) {
+        /* Next entry in the order (WCET descending, table index ascending),
+         * found by a scan, so no memory is needed for sorting */
+        u32Best = UINT32_MAX;
+        for (u32Task = 0; psTable[u32Task].pfFunction != LAST_ENTRY; u32Task++) {
+            u32Wcet = psTable[u32Task].u32Wcet;
+            if (psTable[u32Task].u32CyclicActivation == 0) {
+                continue;
+            }
+            if (!u8First && ((u32Wcet > u32LastWcet) ||
+                             ((u32Wcet == u32LastWcet) && (u32Task <= u32LastTask)))) {
+                continue;   /* Already placed */
+            }
+            if ((u32Best == UINT32_MAX) || (u32Wcet > psTable[u32Best].u32Wcet)) {
+                u32Best = u32Task;
+            }
+        }
+        if (u32Best == UINT32_MAX) {
+            break;
+        }
+
+        /* Try every phase of its period */
+        u32Period = psTable[u32Best].u32CyclicActivation;
+        u32BestPhase = 0;
+        u32BestMax = UINT32_MAX;
+        u32BestSum = UINT32_MAX;
+        for (u32Phase = 0; u32Phase < u32Period; u32Phase++) {
+            u32Max = 0;
+            u32Sum = 0;
+            for (u32Frame = u32Phase; u32Frame < u32Hyper; u32Frame += u32Period) {
+                if (u32Load[u32Frame] > u32Max) {
+                    u32Max = u32Load[u32Frame];
+                }
+                u32Sum += u32Load[u32Frame];
+            }
+            if ((u32Max < u32BestMax) ||
+                    ((u32Max == u32BestMax) && (u32Sum < u32BestSum))) {
+                u32BestPhase = u32Phase;
+                u32BestMax = u32Max;
+                u32BestSum = u32Sum;
+            }
+        }
+        for (u32Frame = u32BestPhase; u32Frame < u32Hyper; u32Frame += u32Period) {
+            u32Load[u32Frame] += psTable[u32Best].u32Wcet;
+        }
+        psTable[u32Best].u32FirstActivation = u32BestPhase;
+
+        u32LastWcet = psTable[u32Best].u32Wcet;
+        u32LastTask = u32Best;
+        u8First = 0;
+    }
+
+    if (psResult != NULL) {
+        psResult->u32PeakBefore = u32PeakBefore;
+        psResult->u32PeakAfter = u32PeakLoad(psTable, u32Hyper);
+    }
+    return u32Hyper;
+}
+
+/*******************************************************************************
+ *  function :    u32CyclicInit
+ ******************************************************************************/
+/** \brief        Build the dispatch lists of the table and start the SysTick.
+ *                An entry is called in every frame n of the hyperperiod with
+ *                (n % u32CyclicActivation) ==
+ *                (u32FirstActivation % u32CyclicActivation).
+ *                Entries with a period of 0 are never called.
+ *
+ *  \type         global
+ *
+ *  \param[in]    psTable        Table to dispatch, terminated by LAST_ENTRY
+ *  \param[in]    u32FrameTicks  Length of a minor frame in ticks
+ *
+ *  \return       Hyperperiod in minor frames, 0 if it exceeds
+ *                CYCLIC_MAX_FRAMES or the lists exceed CYCLIC_MAX_CALLS
+ *
+ ******************************************************************************/
+uint32_t u32CyclicInit(TableEntry *psTable, uint32_t u32FrameTicks) {
+
+    uint32_t u32Hyper = u32Hyperperiod(psTable);
+    uint32_t u32Period;
+    uint32_t u32Frame;
+    uint32_t u32Calls = 0;
+    uint32_t u32Task;
+
+    if (u32Hyper == 0) {
+        return 0;
+    }
+
+    /* Count the calls per frame, u16First[n + 1] is used as counter */
+    for (u32Frame = 0; u32Frame <= u32Hyper; u32Frame++) {
+        u16First[u32Frame] = 0;
+    }
+    for (u32Task = 0; psTable[u32Task].pfFunction != LAST_ENTRY; u32Task++) {
+        u32Period = psTable[u32Task].u32CyclicActivation;
+        if (u32Period != 0) {
+            for (u32Frame = psTable[u32Task].u32FirstActivation % u32Period;
+                    u32Frame < u32Hyper; u32Frame += u32Period) {
+                u16First[u32Frame + 1]++;
+                u32Calls++;
+            }
+        }
+    }
+    if (u32Calls > CYCLIC_MAX_CALLS) {
+        return 0;
+    }
+
+    /* Turn the counts into start indices, then fill in table order */
+    for (u32Frame = 0; u32Frame < u32Hyper; u32Frame++) {
+        u16First[u32Frame + 1] += u16First[u32Frame];
+    }
+    for (u32Task = 0; psTable[u32Task].pfFunction != LAST_ENTRY; u32Task++) {
+        u32Period = psTable[u32Task].u32CyclicActivation;
+        if (u32Period != 0) {
+            for (u32Frame = psTable[u32Task].u32FirstActivation % u32Period;
+                    u32Frame < u32Hyper; u32Frame += u32Period) {
+                u16Calls[u16First[u32Frame]++] = (uint16_t) u32Task;
+            }
+        }
+    }
+    /* Filling moved every start index to the next frame, shift back */
+    for (u32Frame = u32Hyper; u32Frame > 0; u32Frame--) {
+        u16First[u32Frame] = u16First[u32Frame - 1];
+    }
+    u16First[0] = 0;
+
+    psCyclicTable = psTable;
+    u32TicksPerFrame = (u32FrameTicks != 0) ? u32FrameTicks : 1;
+    u32CycleReset = u32Hyper;
+
+    sStats.u32Frames = 0;
+    sStats.u32Overruns = 0;
+    sStats.u32MaxOverrunTicks = 0;
+    u32TickCount = 0;
+
+#if CYCLIC_PROFILE
+    vProfileInit(u32Task, u32TicksPerFrame *
+                 (SystemCoreClock / CYCLIC_TICK_RATE_HZ));
+#endif
+    SysTick_Config(SystemCoreClock / CYCLIC_TICK_RATE_HZ);
+
+    return u32Hyper;
+}
+
+/*******************************************************************************
+ *  function :    vCyclicDispatch
+ ******************************************************************************/
+/** \brief        Call the functions due in a frame of the hyperperiod
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Frame  Frame within the hyperperiod
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vCyclicDispatch(uint32_t u32Frame) {
+
+    uint32_t u32Call = u16First[u32Frame];
+    uint32_t u32End = u16First[u32Frame + 1];
+    uint32_t u32Task;
+#if CYCLIC_PROFILE
+    uint32_t u32Start;
+#endif
+
+    while (u32Call < u32End) {
+        u32Task = u16Calls[u32Call++];
+#if CYCLIC_PROFILE
+        u32Start = u32ProfileNow();
+        (*psCyclicTable[u32Task].pfFunction)((void*)0);
+        vProfileEntry(u32Task, u32Start);
+#else
+        (*psCyclicTable[u32Task].pfFunction)((void*)0);
+#endif
+    }
+}
+
+/*******************************************************************************
+ *  function :    vCyclicRun
+ ******************************************************************************/
+/** \brief        Process the table frame by frame, never returns
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vCyclicRun(void) {
+
+    uint32_t u32Cycle = 0;          /* Frame within the hyperperiod */
+    uint32_t u32FrameStart = 0;     /* Tick at which the frame is due */
+    uint32_t u32Late;
+#if CYCLIC_PROFILE
+    uint32_t u32ReportFrames = 0;   /* Frames since the last report */
+    uint8_t  u8Reporting = 0;       /* Report lines are being printed */
+#endif
+
+    while (1) {
+        vWaitForFrame(u32FrameStart);
+#if CYCLIC_PROFILE
+        vProfileFrame(u32ProfileNow());
+#endif
+
+        vCyclicDispatch(u32Cycle);
+
+        /* Prepare next cycle and check if counter has to be reset */
+        u32Cycle++;
+        if (u32Cycle >= u32CycleReset) {
+            u32Cycle = 0;
+        }
+
+        /* Frame still busy when the next one got due? */
+        u32FrameStart += u32TicksPerFrame;
+        u32Late = u32TickCount - u32FrameStart;
+        if ((int32_t) u32Late >= 0) {
+            sStats.u32Overruns++;
+            if (u32Late + 1 > sStats.u32MaxOverrunTicks) {
+                sStats.u32MaxOverrunTicks = u32Late + 1;
+            }
+        }
+        sStats.u32Frames++;
+
+#if CYCLIC_PROFILE
+        /* Print one report line per frame, in the slack after the dispatch */
+        if (++u32ReportFrames >= CYCLIC_REPORT_FRAMES) {
+            u32ReportFrames = 0;
+            u8Reporting = 1;
+        }
+        if (u8Reporting) {
+            u8Reporting = !u8ProfileReport();
+        }
+#endif
+    }
+}
+
+/*******************************************************************************
+ *  function :    vCyclicTick
+ ******************************************************************************/
+/** \brief        Time base of the cyclic executive, called by the SysTick
+ *                interrupt handler
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vCyclicTick(void) {
+
+    u32TickCount++;
+}
+
+/*******************************************************************************
+ *  function :    vCyclicGetStats
+ ******************************************************************************/
+/** \brief        Get a copy of the frame statistics
+ *
+ *  \type         global
+ *
+ *  \param[out]   psStats   Statistics of the cyclic executive
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vCyclicGetStats(CyclicStats *psStats) {
+
+    __disable_irq();
+    *psStats = sStats;
+    __enable_irq();
+}
+
+/*******************************************************************************
+ *  function :    u32Hyperperiod
+ ******************************************************************************/
+/** \brief        Least common multiple of all periods of the table
+ *
+ *  \type         local
+ *
+ *  \param[in]    psTable   Table, terminated by LAST_ENTRY
+ *
+ *  \return       Hyperperiod in minor frames, 0 if it exceeds
+ *                CYCLIC_MAX_FRAMES or the table has too many entries
+ *
+ ******************************************************************************/
+static uint32_t u32Hyperperiod(TableEntry *psTable) {
+
+    uint32_t u32Hyper = 1;
+    uint32_t u32Period;
+    uint32_t u32Task;
+
+    for (u32Task = 0; psTable[u32Task].pfFunction != LAST_ENTRY; u32Task++) {
+        if (u32Task > UINT16_MAX) {
+            return 0;
+        }
+        u32Period = psTable[u32Task].u32CyclicActivation;
+        if (u32Period > CYCLIC_MAX_FRAMES) {
+            return 0;
+        }
+        if (u32Period != 0) {
+            u32Hyper = (u32Hyper / u32Gcd(u32Hyper, u32Period)) * u32Period;
+            if (u32Hyper > CYCLIC_MAX_FRAMES) {
+                return 0;
+            }
+        }
+    }
+    return u32Hyper;
+}
+
+/*******************************************************************************
+ *  function :    u32PeakLoad
+ ******************************************************************************/
+/** \brief        Highest sum of WCETs of all frames of the hyperperiod
+ *
+ *  \type         local
+ *
+ *  \param[in]    psTable   Table, terminated by LAST_ENTRY
+ *  \param[in]    u32Hyper  Hyperperiod of the table
+ *
+ *  \return       Peak frame load in us
+ *
+ ******************************************************************************/
+static uint32_t u32PeakLoad(TableEntry *psTable, uint32_t u32Hyper) {
+
+    uint32_t u32Peak = 0;
+    uint32_t u32Period;
+    uint32_t u32Frame;
+    uint32_t u32Task;
+
+    for (u32Frame = 0; u32Frame < u32Hyper; u32Frame++) {
+        u32Load[u32Frame] = 0;
+    }
+    for (u32Task = 0; psTable[u32Task].pfFunction != LAST_ENTRY; u32Task++) {
+        u32Period = psTable[u32Task].u32CyclicActivation;
+        if (u32Period != 0) {
+            for (u32Frame = psTable[u32Task].u32FirstActivation % u32Period;
+                    u32Frame < u32Hyper; u32Frame += u32Period) {
+                u32Load[u32Frame] += psTable[u32Task].u32Wcet;
+            }
+        }
+    }
+    for (u32Frame = 0; u32Frame < u32Hyper; u32Frame++) {
+        if (u32Load[u32Frame] > u32Peak) {
+            u32Peak = u32Load[u32Frame];
+        }
+    }
+    return u32Peak;
+}
+
+/*******************************************************************************
+ *  function :    u32Gcd
+ ******************************************************************************/
+/** \brief        Greatest common divisor (Euclid)
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32A, u32B    Operands, not both 0
+ *
+ *  \return       gcd(u32A, u32B)
+ *
+ ******************************************************************************/
+static uint32_t u32Gcd(uint32_t u32A, uint32_t u32B) {
+
+    uint32_t u32T;
+
+    while (u32B != 0) {
+        u32T = u32A % u32B;
+        u32A = u32B;
+        u32B = u32T;
+    }
+    return u32A;
+}
+
+/*******************************************************************************
+ *  function :    vWaitForFrame
+ ******************************************************************************/
+/** \brief        Sleep until the frame starting at tick u32FrameStart is due.
+ *                Interrupts are disabled while checking the tick counter, WFI
+ *                still wakes up on the pending SysTick. Like this no tick can
+ *                get lost between the check and the WFI.
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32FrameStart   Tick at which the frame is due
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vWaitForFrame(uint32_t u32FrameStart) {
+
+    __disable_irq();
+    while ((int32_t) (u32TickCount - u32FrameStart) < 0) {
+        __WFI();
+        __enable_irq();     /* Let the pending SysTick run */
+        __disable_irq();
+    }
+    __enable_irq();
+}
@@ -0,0 +1,83 @@
+#ifndef CYCLICEXEC_H_
+#define CYCLICEXEC_H_
+/******************************************************************************/
+/** \file       cyclicExec.h
+ *******************************************************************************
+ *
+ *  \brief      Tick driven cyclic executive. The table is dispatched once per
+ *              minor frame, the CPU sleeps (WFI) between the frames and frames
+ *              which do not finish in time are counted as overruns.
+ *              The dispatch lists of all frames of the hyperperiod are built
+ *              once by u32CyclicInit, CYCLIC_MAX_FRAMES and CYCLIC_MAX_CALLS
+ *              define the space reserved for them.
+ *              With CYCLIC_PROFILE set, every call and every frame start is
+ *              timed (cyclicProfile.h) and a report is printed every
+ *              CYCLIC_REPORT_FRAMES frames.
+ *              u32CyclicBalance chooses the first activations from the
+ *              declared WCETs so that the peak load of a frame is minimal.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    u32CyclicBalance
+ *              u32CyclicInit
+ *              vCyclicDispatch
+ *              vCyclicRun
+ *              vCyclicTick
+ *              vCyclicGetStats
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+//----- Macros -----------------------------------------------------------------
+#define CYCLIC_TICK_RATE_HZ   ( 1000 )  /* SysTick rate, one tick per ms      */
+#define LAST_ENTRY            ( 0 )     /* Last entry for table_entry table[] */
+
+#ifndef CYCLIC_MAX_FRAMES
+#define CYCLIC_MAX_FRAMES     ( 60 )    /* Longest supported hyperperiod      */
+#endif
+#ifndef CYCLIC_MAX_CALLS
+#define CYCLIC_MAX_CALLS      ( 128 )   /* Calls per hyperperiod, all frames  */
+#endif
+
+#ifndef CYCLIC_PROFILE
+#define CYCLIC_PROFILE        ( 1 )     /* Time entries and frame starts      */
+#endif
+#define CYCLIC_REPORT_FRAMES  ( 100 )   /* Frames between profile reports     */
+
+//----- Data types -------------------------------------------------------------
+/* struct describing a table entry for cyclical OS */
+typedef struct   {
+    uint32_t u32FirstActivation;    /* Phase, taken modulo the period */
+    uint32_t u32CyclicActivation;   /* Periodic cycle */
+    void     (*pfFunction)(void*);  /* Function pointer to action */
+    uint32_t u32Wcet;               /* Worst case execution time in us */
+} TableEntry;
+
+/* Peak frame load before and after balancing */
+typedef struct {
+    uint32_t u32PeakBefore;         /* Busiest frame with the given phases, us */
+    uint32_t u32PeakAfter;          /* Busiest frame with balanced phases, us */
+} CyclicBalance;
+
+/* Frame statistics of the cyclic executive */
+typedef struct {
+    uint32_t u32Frames;             /* Number of dispatched minor frames */
+    uint32_t u32Overruns;           /* Frames which ran into the next frame */
+    uint32_t u32MaxOverrunTicks;    /* Worst overrun in (started) ticks */
+} CyclicStats;
+
+//----- Function prototypes ----------------------------------------------------
+extern uint32_t u32CyclicBalance(TableEntry *psTable, CyclicBalance *psResult);
+extern uint32_t u32CyclicInit(TableEntry *psTable, uint32_t u32FrameTicks);
+extern void vCyclicDispatch(uint32_t u32Frame);
+extern void vCyclicRun(void);
+extern void vCyclicTick(void);
+extern void vCyclicGetStats(CyclicStats *psStats);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* CYCLICEXEC_H_ */
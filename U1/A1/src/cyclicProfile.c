@@ -0,0 +1,285 @@
+/******************************************************************************/
+/** \file       cyclicProfile.c
+ *******************************************************************************
+ *
+ *  \brief      Execution time and jitter profiler for the cyclic executive.
+ *              The dispatcher reads the cycle counter before a table entry
+ *              and hands the start time to vProfileEntry after the entry
+ *              returned. Recording a sample costs a few adds and compares
+ *              and one CLZ for the histogram bin, so the profiler can stay
+ *              enabled in production builds.
+ *              u8ProfileReport prints one line per call over the UART
+ *              (printf), so the report can be spread over several frames.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vProfileInit
+ *              vProfileEntry
+ *              vProfileFrame
+ *              vProfileGet
+ *              u8ProfileReport
+ *  functions  local:
+ *              vProfileAdd
+ *              vProfileReset
+ *              u32ProfileUs
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>                      /* Standard Input/Output              */
+
+#include "cyclicProfile.h"
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static void vProfileAdd(ProfileStats *psStats, uint32_t u32Cycles);
+static void vProfileReset(ProfileStats *psStats);
+static uint32_t u32ProfileUs(uint64_t u64Cycles);
+
+//----- Data -------------------------------------------------------------------
+static ProfileStats sProfile[PROFILE_MAX_ENTRIES + 1];  /* Entries + jitter  */
+static uint32_t     u32ProfileEntries;  /* Number of profiled entries        */
+static uint32_t     u32NominalCycles;   /* Nominal distance of frame starts  */
+static uint32_t     u32LastFrame;       /* Cycle counter at last frame start */
+static uint8_t      u8FrameValid;       /* u32LastFrame holds a start        */
+static uint32_t     u32ReportLine;      /* Next line of the report           */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vProfileInit
+ ******************************************************************************/
+/** \brief        Enable the cycle counter and clear all statistics
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Entries      Number of table entries
+ *  \param[in]    u32FrameCycles  Nominal length of a minor frame in cycles
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vProfileInit(uint32_t u32Entries, uint32_t u32FrameCycles) {
+
+    uint32_t u32I;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    u32ProfileEntries = (u32Entries < PROFILE_MAX_ENTRIES) ?
+                        u32Entries : PROFILE_MAX_ENTRIES;
+    u32NominalCycles = u32FrameCycles;
+    u8FrameValid = 0;
+    u32ReportLine = 0;
+    for (u32I = 0; u32I <= PROFILE_MAX_ENTRIES; u32I++) {
+        vProfileReset(&sProfile[u32I]);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vProfileEntry
+ ******************************************************************************/
+/** \brief        Record the execution time of a table entry
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Entry  Index of the entry in the table
+ *  \param[in]    u32Start  Cycle counter before the entry was called
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vProfileEntry(uint32_t u32Entry, uint32_t u32Start) {
+
+    uint32_t u32Cycles = u32ProfileNow() - u32Start;
+
+    if (u32Entry < u32ProfileEntries) {
+        vProfileAdd(&sProfile[u32Entry], u32Cycles);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vProfileFrame
+ ******************************************************************************/
+/** \brief        Record a frame start. The jitter is the deviation of the
+ *                distance to the previous start from the nominal frame length.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Start  Cycle counter at the frame start
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vProfileFrame(uint32_t u32Start) {
+
+    int32_t s32Deviation;
+
+    if (u8FrameValid) {
+        s32Deviation = (int32_t) (u32Start - u32LastFrame - u32NominalCycles);
+        if (s32Deviation < 0) {
+            s32Deviation = -s32Deviation;
+        }
+        vProfileAdd(&sProfile[PROFILE_JITTER], (uint32_t) s32Deviation);
+    }
+    u32LastFrame = u32Start;
+    u8FrameValid = 1;
+}
+
+/*******************************************************************************
+ *  function :    vProfileGet
+ ******************************************************************************/
+/** \brief        Get a copy of the statistics of an entry or of the jitter
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Entry  Index of the entry or PROFILE_JITTER
+ *  \param[out]   psStats   Statistics
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vProfileGet(uint32_t u32Entry, ProfileStats *psStats) {
+
+    if (u32Entry > PROFILE_JITTER) {
+        u32Entry = PROFILE_JITTER;
+    }
+    *psStats = sProfile[u32Entry];
+}
+
+/*******************************************************************************
+ *  function :    u8ProfileReport
+ ******************************************************************************/
+/** \brief        Print the next line of the report. The first line holds the
+ *                jitter, then one line per table entry follows, e.g.
+ *                "e1 n 120 us 3/4/9 h 2:100 3:20" for entry 1 with 120 calls,
+ *                min/mean/max in us and the non empty histogram bins.
+ *
+ *  \type         global
+ *
+ *  \return       1 if the report is complete, 0 if lines are left
+ *
+ ******************************************************************************/
+uint8_t u8ProfileReport(void) {
+
+    ProfileStats *psStats;
+    uint32_t u32Bin;
+
+    if (u32ReportLine == 0) {
+        psStats = &sProfile[PROFILE_JITTER];
+        printf("jit");
+    } else {
+        psStats = &sProfile[u32ReportLine - 1];
+        printf("e%u", (unsigned) (u32ReportLine - 1));
+    }
+
+    printf(" n %u us %u/%u/%u h", (unsigned) psStats->u32Count,
+           (unsigned) u32ProfileUs(psStats->u32Count ? psStats->u32Min : 0),
+           (unsigned) u32ProfileUs(psStats->u32Count ?
+                                   psStats->u64Sum / psStats->u32Count : 0),
+           (unsigned) u32ProfileUs(psStats->u32Max));
+    for (u32Bin = 0; u32Bin < PROFILE_BINS; u32Bin++) {
+        if (psStats->u32Hist[u32Bin] != 0) {
+            printf(" %u:%u", (unsigned) u32Bin,
+                   (unsigned) psStats->u32Hist[u32Bin]);
+        }
+    }
+    printf("\r\n");
+
+    u32ReportLine++;
+    if (u32ReportLine > u32ProfileEntries) {
+        u32ReportLine = 0;
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    vProfileAdd
+ ******************************************************************************/
+/** \brief        Add a sample to the statistics
+ *
+ *  \type         local
+ *
+ *  \param[in]    psStats    Statistics to update
+ *  \param[in]    u32Cycles  Sample in cycles
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vProfileAdd(ProfileStats *psStats, uint32_t u32Cycles) {
+
+    uint32_t u32Bin = u32Cycles >> PROFILE_BIN_SHIFT;
+
+    psStats->u32Count++;
+    psStats->u64Sum += u32Cycles;
+    if (u32Cycles < psStats->u32Min) {
+        psStats->u32Min = u32Cycles;
+    }
+    if (u32Cycles > psStats->u32Max) {
+        psStats->u32Max = u32Cycles;
+    }
+
+    /* Bin = number of significant bits above the shift, one CLZ */
+    u32Bin = (u32Bin != 0) ? (32 - __builtin_clz(u32Bin)) : 0;
+    if (u32Bin >= PROFILE_BINS) {
+        u32Bin = PROFILE_BINS - 1;
+    }
+    psStats->u32Hist[u32Bin]++;
+}
+
+/*******************************************************************************
+ *  function :    vProfileReset
+ ******************************************************************************/
+/** \brief        Clear the statistics
+ *
+ *  \type         local
+ *
+ *  \param[in]    psStats   Statistics to clear
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vProfileReset(ProfileStats *psStats) {
+
+    uint32_t u32Bin;
+
+    psStats->u32Count = 0;
+    psStats->u32Min = UINT32_MAX;
+    psStats->u32Max = 0;
+    psStats->u64Sum = 0;
+    for (u32Bin = 0; u32Bin < PROFILE_BINS; u32Bin++) {
+        psStats->u32Hist[u32Bin] = 0;
+    }
+}
+
+/*******************************************************************************
+ *  function :    u32ProfileUs
+ ******************************************************************************/
+/** \brief        Convert cycles to microseconds
+ *
+ *  \type         local
+ *
+ *  \param[in]    u64Cycles   Core clock cycles
+ *
+ *  \return       us, rounded
+ *
+ ******************************************************************************/
+static uint32_t u32ProfileUs(uint64_t u64Cycles) {
+
+    uint32_t u32CyclesPerUs = SystemCoreClock / 1000000;
+
+    return (uint32_t) ((u64Cycles + (u32CyclesPerUs / 2)) / u32CyclesPerUs);
+}
@@ -0,0 +1,60 @@
+#ifndef CYCLICPROFILE_H_
+#define CYCLICPROFILE_H_
+/******************************************************************************/
+/** \file       cyclicProfile.h
+ *******************************************************************************
+ *
+ *  \brief      Execution time and jitter profiler for the cyclic executive.
+ *              Times are taken with the DWT cycle counter (core clock
+ *              cycles). Every table entry and the frame start jitter get
+ *              min, max, mean and a histogram with power of two bins.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vProfileInit
+ *              u32ProfileNow
+ *              vProfileEntry
+ *              vProfileFrame
+ *              vProfileGet
+ *              u8ProfileReport
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <stm32f4xx.h>                  /* Processor STM32F407IG              */
+
+//----- Macros -----------------------------------------------------------------
+#define PROFILE_MAX_ENTRIES   ( 16 )    /* Profiled table entries             */
+#define PROFILE_JITTER        ( PROFILE_MAX_ENTRIES ) /* Index of the jitter  */
+#define PROFILE_BINS          ( 16 )    /* Histogram bins                     */
+#define PROFILE_BIN_SHIFT     ( 8 )     /* Bin 0: < 256 cycles, then doubling */
+
+//----- Data types -------------------------------------------------------------
+/* Statistics of one measured quantity, in core clock cycles */
+typedef struct {
+    uint32_t u32Count;              /* Number of samples */
+    uint32_t u32Min;                /* Shortest sample */
+    uint32_t u32Max;                /* Longest sample */
+    uint64_t u64Sum;                /* Sum of all samples, for the mean */
+    uint32_t u32Hist[PROFILE_BINS]; /* Bin n: < (1 << (PROFILE_BIN_SHIFT + n)) */
+} ProfileStats;
+
+//----- Function prototypes ----------------------------------------------------
+extern void    vProfileInit(uint32_t u32Entries, uint32_t u32FrameCycles);
+extern void    vProfileEntry(uint32_t u32Entry, uint32_t u32Start);
+extern void    vProfileFrame(uint32_t u32Start);
+extern void    vProfileGet(uint32_t u32Entry, ProfileStats *psStats);
+extern uint8_t u8ProfileReport(void);
+
+//----- Implementation ---------------------------------------------------------
+/* Current value of the cycle counter */
+static inline uint32_t u32ProfileNow(void) {
+    return DWT->CYCCNT;
+}
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* CYCLICPROFILE_H_ */
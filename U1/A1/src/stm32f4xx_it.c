@@ -45,6 +45,7 @@ extern "C" {
 #include <carme.h>                  /* CARME Module                         */
 #include <can.h>                    /* CARME CAN Module                     */
 #include "stm32f4xx_it.h"
+#include "cyclicExec.h"             /* Cyclic executive time base           */
 
 /*----- Macros -------------------------------------------------------------*/
 
@@ -126,6 +127,18 @@ void UsageFault_Handler(void) {
 void DebugMon_Handler(void) {
 }
 
+/**
+ *****************************************************************************
+ * @brief       This function handles the SysTick, time base of the cyclic
+ *              executive.
+ *
+ * @return      None
+ *****************************************************************************
+ */
+void SysTick_Handler(void) {
+    vCyclicTick();
+}
+
 /**
  *****************************************************************************
  * @brief       This function handles the EXTI Lines 9:5.
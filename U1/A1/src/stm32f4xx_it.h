@@ -56,6 +56,7 @@ void MemManage_Handler(void);
 void BusFault_Handler(void);
 void UsageFault_Handler(void);
 void DebugMon_Handler(void);
+void SysTick_Handler(void);
 
 /*----- Data ---------------------------------------------------------------*/
 
@@ -12,6 +12,8 @@
  *               \li wht4, 24.01.2014, Created
  *               \li wht4, 06.01.2015, Migrated to FreeRTOS V8.0.0
  *               \li WBR1, 09.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Starvation watchdog
+ *               \li id101010, 17.10.2026, LEDs through the IO1 shadow
  *
  ******************************************************************************/
 /*
@@ -26,6 +28,7 @@
 //----- Header-Files -----------------------------------------------------------
 #include <carme.h>                      /* CARME Module                       */
 #include <carme_io1.h>                  /* CARMEIO1 Board Support Package     */
+#include <uart.h>                       /* CARME UART, watchdog reports       */
 
 #include <stdio.h>                      /* Standard Input/Output              */
 #include <stdlib.h>                     /* General Utilities                  */
@@ -38,6 +41,9 @@
 #include <timers.h>
 #include <memPoolService.h>
 
+#include "starveWatch.h"
+#include "io1Service.h"
+
 //----- Macros -----------------------------------------------------------------
 #define STACKSIZE_TASK1        ( 256 )
 #define STACKSIZE_TASK2        ( 256 )
@@ -49,6 +55,9 @@
 //#define USE_vWAIT               // TODO: set this compiler switch to use CPU-wait
                                 // instead of vTastDelay
 
+#define DEADLINE_TASK1         ( 500 )  /* ms ready without running: starving */
+#define DEADLINE_TASK2         ( 500 )
+
 //----- Data types -------------------------------------------------------------
 
 //----- Function prototypes ----------------------------------------------------
@@ -76,12 +85,18 @@ static void  vWait(void);
 int  main(void) {
 
     TaskHandle_t taskHandle;
+    USART_InitTypeDef USART_InitStruct;
 
     /* Ensure all priority bits are assigned as preemption priority bits. */
     NVIC_PriorityGroupConfig(NVIC_PriorityGroup_4);
 
-    CARME_IO1_Init();               // Initialize the CARMEIO1
-    CARME_IO1_LED_Set(0, 0xFF);     // Reset led state
+    vIo1Init();                     // Initialize the CARMEIO1, leds off
+
+    /* The starvation watchdog reports on the UART */
+    USART_StructInit(&USART_InitStruct);
+    USART_InitStruct.USART_BaudRate = 115200;
+    CARME_UART_Init(CARME_UART0, &USART_InitStruct);
+    vWatchInit();
 
     xTaskCreate(vAppTask1,
                 "Task1",
@@ -89,6 +104,7 @@ int  main(void) {
                 NULL,
                 PRIORITY_TASK1,
                 &taskHandle);
+    vWatchTask(taskHandle, DEADLINE_TASK1);
 
     xTaskCreate(vAppTask2,
                 "Task2",
@@ -96,6 +112,7 @@ int  main(void) {
                 NULL,
                 PRIORITY_TASK2,
                 &taskHandle);
+    vWatchTask(taskHandle, DEADLINE_TASK2);
 
     vTaskStartScheduler();
 
@@ -119,13 +136,10 @@ int  main(void) {
  ******************************************************************************/
 static void vAppTask1(void *pvData) {
 
-    uint8_t u8Led;
     uint8_t u8LedMask = 0x0F;
 
     while(1) {
-        CARME_IO1_LED_Get(&u8Led);
-        u8Led = u8Led ^ u8LedMask;
-        CARME_IO1_LED_Set(u8Led, u8LedMask);
+        vIo1LedToggle(u8LedMask);       // one atomic update of the shadow
 
 #ifdef USE_vWAIT
         vWait();
@@ -149,13 +163,10 @@ static void vAppTask1(void *pvData) {
  ******************************************************************************/
 static void  vAppTask2(void *pvData) {
 
-    uint8_t u8Led;
     uint8_t u8LedMask = 0xF0;
 
     while(1) {
-        CARME_IO1_LED_Get(&u8Led);
-        u8Led = u8Led ^ u8LedMask;
-        CARME_IO1_LED_Set(u8Led, u8LedMask);
+        vIo1LedToggle(u8LedMask);       // one atomic update of the shadow
 
 #ifdef USE_vWAIT
         vWait();
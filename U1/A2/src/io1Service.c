@@ -0,0 +1,176 @@
+/******************************************************************************/
+/** \file       io1Service.c
+ *******************************************************************************
+ *
+ *  \brief      CARME IO1 front end with a RAM shadow of the LED latch. The
+ *              shadow is a word, so an update is a LDREX/STREX loop and
+ *              needs no critical section.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vIo1Init
+ *              vIo1LedWrite
+ *              vIo1LedToggle
+ *              u8Io1LedGet
+ *              vIo1Snapshot
+ *  functions  local:
+ *              vIo1LedFlush
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>                      /* CARME Module                       */
+
+#include "io1Service.h"
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static void vIo1LedFlush(void);
+
+//----- Data -------------------------------------------------------------------
+static volatile uint32_t u32LedShadow;  /* Value of the LED latch             */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vIo1Init
+ ******************************************************************************/
+/** \brief        Initialize the IO1 board, all LEDs off
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vIo1Init(void) {
+
+    CARME_IO1_Init();
+    u32LedShadow = 0;
+    *CARME_IO1_LED_LATCH = 0;
+}
+
+/*******************************************************************************
+ *  function :    vIo1LedWrite
+ ******************************************************************************/
+/** \brief        Set the LEDs selected by the mask. Safe from any task or
+ *                interrupt.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8Value   LED values
+ *  \param[in]    u8Mask    LEDs to change
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vIo1LedWrite(uint8_t u8Value, uint8_t u8Mask) {
+
+    uint32_t u32Old = u32LedShadow;
+    uint32_t u32New;
+
+    do {
+        u32New = (u32Old & ~(uint32_t) u8Mask) | (u8Value & u8Mask);
+        if (u32New == u32Old) {
+            return;                     /* No change, no bus access */
+        }
+    } while (!__atomic_compare_exchange_n(&u32LedShadow, &u32Old, u32New, 1,
+                                          __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+    vIo1LedFlush();
+}
+
+/*******************************************************************************
+ *  function :    vIo1LedToggle
+ ******************************************************************************/
+/** \brief        Toggle the LEDs selected by the mask. Safe from any task or
+ *                interrupt.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8Mask    LEDs to toggle
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vIo1LedToggle(uint8_t u8Mask) {
+
+    if (u8Mask != 0) {
+        __atomic_fetch_xor(&u32LedShadow, (uint32_t) u8Mask, __ATOMIC_SEQ_CST);
+        vIo1LedFlush();
+    }
+}
+
+/*******************************************************************************
+ *  function :    u8Io1LedGet
+ ******************************************************************************/
+/** \brief        State of the LEDs, read from the shadow
+ *
+ *  \type         global
+ *
+ *  \return       LED bits
+ *
+ ******************************************************************************/
+uint8_t u8Io1LedGet(void) {
+
+    return (uint8_t) u32LedShadow;
+}
+
+/*******************************************************************************
+ *  function :    vIo1Snapshot
+ ******************************************************************************/
+/** \brief        Read switches, buttons and LEDs together. If the LEDs
+ *                change meanwhile, the inputs are read again, so the LEDs
+ *                belong to the moment the inputs were sampled.
+ *
+ *  \type         global
+ *
+ *  \param[out]   psSnapshot    state of the board
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vIo1Snapshot(Io1Snapshot_t *psSnapshot) {
+
+    uint32_t u32Led;
+
+    do {
+        u32Led = u32LedShadow;
+        CARME_IO1_SWITCH_Get(&psSnapshot->u8Switch);
+        CARME_IO1_BUTTON_Get(&psSnapshot->u8Button);
+        psSnapshot->xTick = xTaskGetTickCount();
+    } while (u32LedShadow != u32Led);
+    psSnapshot->u8Led = (uint8_t) u32Led;
+}
+
+/*******************************************************************************
+ *  function :    vIo1LedFlush
+ ******************************************************************************/
+/** \brief        Store the shadow to the latch. A writer preempted between
+ *                reading the shadow and the store may write an old value,
+ *                but every store is followed by this check, so the last
+ *                store on the bus always has the latest value.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vIo1LedFlush(void) {
+
+    uint32_t u32Led;
+
+    do {
+        u32Led = u32LedShadow;
+        *CARME_IO1_LED_LATCH = (uint8_t) u32Led;
+    } while (u32LedShadow != u32Led);
+}
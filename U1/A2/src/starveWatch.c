@@ -0,0 +1,282 @@
+/******************************************************************************/
+/** \file       starveWatch.c
+ *******************************************************************************
+ *
+ *  \brief      Starvation watchdog. Each task has a slot, stored as its task
+ *              number (vTaskSetTaskNumber). Slot 0 collects tasks without
+ *              one. The switch hook only touches the slot arrays, all other
+ *              work is done by the monitor task.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vWatchInit
+ *              vWatchTask
+ *              __wrap_vTaskSwitchContext
+ *  functions  local:
+ *              uxWatchSlot
+ *              vWatchMonitor
+ *              vWatchCheck
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>                      /* CARME Module                       */
+#include <stdio.h>                      /* Standard Input/Output              */
+
+#include "starveWatch.h"
+
+//----- Macros -----------------------------------------------------------------
+#define WATCH_SLOTS           ( WATCH_MAX_TASKS + 1 )
+
+/* Later of two ticks, correct across the wrap-around */
+#define WATCH_LATER(xA, xB)   ( ((TickType_t) ((xA) - (xB)) < ((TickType_t) ~0 >> 1)) ? \
+                                (xA) : (xB) )
+
+//----- Data types -------------------------------------------------------------
+/* Monitor state of a slot */
+typedef struct {
+    const char *pcName;                 /* Task name, 0 for a free slot       */
+    TickType_t  xDeadline;              /* Longest wait, 0: not watched       */
+    TickType_t  xReadySince;            /* Tick the monitor saw it get ready  */
+    TickType_t  xStarvedSince;          /* Start of the reported wait         */
+    TickType_t  xStarvedRun;            /* xLastRun when it was reported      */
+    uint8_t     u8Ready;                /* Ready at the last check            */
+    uint8_t     u8Starving;             /* Reported, not run since            */
+} WatchSlot;
+
+//----- Function prototypes ----------------------------------------------------
+extern void __real_vTaskSwitchContext(void);
+extern void __wrap_vTaskSwitchContext(void);
+
+static UBaseType_t uxWatchSlot(TaskHandle_t xTask, const char *pcName);
+static void vWatchMonitor(void *pvData);
+static void vWatchCheck(TickType_t xNow);
+
+//----- Data -------------------------------------------------------------------
+/* Written by the switch hook */
+static volatile TickType_t xLastRun[WATCH_SLOTS]; /* Tick of the last switch in */
+static volatile uint32_t u32Cycles[WATCH_SLOTS];  /* Cycles run, wraps         */
+static UBaseType_t uxRunning;           /* Slot of the running task           */
+static uint32_t u32SwitchedIn;          /* Cycle counter at the switch in     */
+
+/* Monitor state */
+static WatchSlot sSlots[WATCH_SLOTS];
+static uint32_t u32LastCycles[WATCH_SLOTS]; /* u32Cycles at the last check    */
+static TaskStatus_t sTasks[WATCH_MAX_TASKS + 4];
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vWatchInit
+ ******************************************************************************/
+/** \brief        Start the cycle counter and create the monitor task
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vWatchInit(void) {
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    sSlots[0].pcName = "other";
+    xTaskCreate(vWatchMonitor,
+                "Watch",
+                STACKSIZE_WATCH_TASK,
+                NULL,
+                PRIORITY_WATCH_TASK,
+                NULL);
+}
+
+/*******************************************************************************
+ *  function :    vWatchTask
+ ******************************************************************************/
+/** \brief        Watch a task: report it if it is ready for longer than the
+ *                deadline without running
+ *
+ *  \type         global
+ *
+ *  \param[in]    xTask           task handle
+ *  \param[in]    u32DeadlineMs   longest time ready without running
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vWatchTask(TaskHandle_t xTask, uint32_t u32DeadlineMs) {
+
+    UBaseType_t uxSlot = uxWatchSlot(xTask, pcTaskGetName(xTask));
+
+    if (uxSlot != 0) {
+        sSlots[uxSlot].xDeadline = (TickType_t) (u32DeadlineMs / portTICK_RATE_MS);
+    }
+}
+
+/*******************************************************************************
+ *  function :    __wrap_vTaskSwitchContext
+ ******************************************************************************/
+/** \brief        Replaces the call of vTaskSwitchContext in the port (PendSV).
+ *                Charges the cycles to the outgoing task and records the tick
+ *                at which the incoming task starts (traceTASK_SWITCHED_IN).
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void __wrap_vTaskSwitchContext(void) {
+
+    uint32_t u32Now = DWT->CYCCNT;
+    UBaseType_t uxSlot;
+
+    u32Cycles[uxRunning] += u32Now - u32SwitchedIn;
+    u32SwitchedIn = u32Now;
+
+    __real_vTaskSwitchContext();
+
+    uxSlot = uxTaskGetTaskNumber(xTaskGetCurrentTaskHandle());
+    if (uxSlot > WATCH_MAX_TASKS) {
+        uxSlot = 0;
+    }
+    xLastRun[uxSlot] = xTaskGetTickCountFromISR();
+    uxRunning = uxSlot;
+}
+
+/*******************************************************************************
+ *  function :    uxWatchSlot
+ ******************************************************************************/
+/** \brief        Slot of a task, a free one is assigned on the first call
+ *
+ *  \type         local
+ *
+ *  \param[in]    xTask     task handle
+ *  \param[in]    pcName    task name
+ *
+ *  \return       slot, 0 if all slots are used
+ *
+ ******************************************************************************/
+static UBaseType_t uxWatchSlot(TaskHandle_t xTask, const char *pcName) {
+
+    UBaseType_t uxSlot = uxTaskGetTaskNumber(xTask);
+
+    if ((uxSlot != 0) && (uxSlot <= WATCH_MAX_TASKS)) {
+        return uxSlot;
+    }
+    for (uxSlot = 1; uxSlot <= WATCH_MAX_TASKS; uxSlot++) {
+        if (sSlots[uxSlot].pcName == NULL) {
+            sSlots[uxSlot].pcName = pcName;
+            xLastRun[uxSlot] = xTaskGetTickCount();
+            vTaskSetTaskNumber(xTask, uxSlot);
+            return uxSlot;
+        }
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    vWatchMonitor
+ ******************************************************************************/
+/** \brief        Monitor task, checks every WATCH_PERIOD_MS
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvData    not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vWatchMonitor(void *pvData) {
+
+    TickType_t xLastWake = xTaskGetTickCount();
+
+    for (;;) {
+        vTaskDelayUntil(&xLastWake, WATCH_PERIOD_MS / portTICK_RATE_MS);
+        vWatchCheck(xLastWake);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vWatchCheck
+ ******************************************************************************/
+/** \brief        Find watched tasks which are ready and waiting longer than
+ *                their deadline. The task which used most cycles since the
+ *                last check is reported as the one that took the CPU.
+ *
+ *  \type         local
+ *
+ *  \param[in]    xNow      current tick
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vWatchCheck(TickType_t xNow) {
+
+    UBaseType_t uxTasks;
+    UBaseType_t uxTask;
+    UBaseType_t uxSlot;
+    UBaseType_t uxThief = 0;
+    uint32_t u32Used[WATCH_SLOTS];
+    uint32_t u32Total = 0;
+    TickType_t xSince;
+    WatchSlot *psSlot;
+
+    /* Cycles per slot since the last check */
+    for (uxSlot = 0; uxSlot < WATCH_SLOTS; uxSlot++) {
+        u32Used[uxSlot] = u32Cycles[uxSlot] - u32LastCycles[uxSlot];
+        u32LastCycles[uxSlot] += u32Used[uxSlot];
+        u32Total += u32Used[uxSlot];
+        if (u32Used[uxSlot] > u32Used[uxThief]) {
+            uxThief = uxSlot;
+        }
+    }
+
+    uxTasks = uxTaskGetSystemState(sTasks, sizeof(sTasks) / sizeof(sTasks[0]), NULL);
+    for (uxTask = 0; uxTask < uxTasks; uxTask++) {
+        uxSlot = uxWatchSlot(sTasks[uxTask].xHandle, sTasks[uxTask].pcTaskName);
+        psSlot = &sSlots[uxSlot];
+        if ((uxSlot == 0) || (psSlot->xDeadline == 0)) {
+            continue;
+        }
+
+        if (sTasks[uxTask].eCurrentState != eReady) {
+            psSlot->u8Ready = 0;
+        } else if (psSlot->u8Ready == 0) {
+            psSlot->u8Ready = 1;
+            psSlot->xReadySince = xNow;
+        }
+
+        if (psSlot->u8Starving != 0) {
+            if (xLastRun[uxSlot] != psSlot->xStarvedRun) {
+                printf("watch: %s ran again after %u ms\r\n", psSlot->pcName,
+                       (unsigned) ((xLastRun[uxSlot] - psSlot->xStarvedSince) *
+                                   portTICK_RATE_MS));
+                psSlot->u8Starving = 0;
+            }
+            continue;
+        }
+
+        /* Waiting since it got ready or last ran, whichever is later */
+        xSince = WATCH_LATER(psSlot->xReadySince, xLastRun[uxSlot]);
+        if ((psSlot->u8Ready != 0) && ((TickType_t) (xNow - xSince) > psSlot->xDeadline)) {
+            printf("watch: %s starving for %u ms, CPU taken by %s (%u%%)\r\n",
+                   psSlot->pcName,
+                   (unsigned) ((xNow - xSince) * portTICK_RATE_MS),
+                   sSlots[uxThief].pcName,
+                   (unsigned) ((u32Total != 0) ?
+                               ((uint64_t) u32Used[uxThief] * 100 / u32Total) : 0));
+            psSlot->u8Starving = 1;
+            psSlot->xStarvedSince = xSince;
+            psSlot->xStarvedRun = xLastRun[uxSlot];
+        }
+    }
+}
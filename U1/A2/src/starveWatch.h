@@ -0,0 +1,48 @@
+#ifndef STARVEWATCH_H_
+#define STARVEWATCH_H_
+/******************************************************************************/
+/** \file       starveWatch.h
+ *******************************************************************************
+ *
+ *  \brief      Starvation watchdog. Every context switch records the tick at
+ *              which the incoming task started and the cycles used by the
+ *              outgoing task. A monitor task of the highest priority checks
+ *              every WATCH_PERIOD_MS for watched tasks which are ready but
+ *              have not run within their deadline, and reports on the UART
+ *              the starving task, the task which used the CPU meanwhile and
+ *              the duration.
+ *
+ *              The kernel is a prebuilt library, traceTASK_SWITCHED_IN can
+ *              not be defined for it. The switch is hooked by linking with
+ *              -Wl,--wrap=vTaskSwitchContext instead.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vWatchInit
+ *              vWatchTask
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+
+//----- Macros -----------------------------------------------------------------
+#define WATCH_MAX_TASKS       ( 8 )     /* Tasks with a slot, more share 0    */
+#define WATCH_PERIOD_MS       ( 50 )    /* Check period of the monitor        */
+#define PRIORITY_WATCH_TASK   ( configMAX_PRIORITIES - 1 )
+#define STACKSIZE_WATCH_TASK  ( 256 )
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern void  vWatchInit(void);
+extern void  vWatchTask(TaskHandle_t xTask, uint32_t u32DeadlineMs);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* STARVEWATCH_H_ */
@@ -12,6 +12,9 @@
  *               \li wht4, 24.01.2014, Created
  *               \li wht4, 06.01.2015, Migrated to FreeRTOS V8.0.0
  *               \li WBR1, 09.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Poti from the DMA ADC service
+ *               \li id101010, 17.10.2026, Speed in a lock-free shared cell
+ *               \li id101010, 17.10.2026, LEDs through the IO1 shadow
  *
  ******************************************************************************/
 /*
@@ -25,7 +28,7 @@
 
 //----- Header-Files -----------------------------------------------------------
 #include <carme.h>                      /* CARME Module                       */
-//#include <carme_io1.h>                /* CARMEIO1 Board Support Package     */
+#include <carme_io1.h>                  /* CARMEIO1 Board Support Package     */
 #include <carme_io2.h>
 
 #include <stdio.h>                      /* Standard Input/Output              */
@@ -39,6 +42,10 @@
 #include <timers.h>
 #include <memPoolService.h>
 
+#include "adcService.h"
+#include "sharedState.h"
+#include "io1Service.h"
+
 //----- Macros -----------------------------------------------------------------
 #define STACKSIZE_TASK1        ( 256 )
 #define STACKSIZE_TASK2        ( 256 )
@@ -53,7 +60,7 @@ static void  vAppTask1(void *pvData);
 static void  vAppTask2(void *pvData);
 
 //----- Data -------------------------------------------------------------------
-uint16_t u16Speed = 100;
+SharedWord_t sSpeed = { 100 };          /* Delay of the chaser in ticks       */
 
 //----- Implementation ---------------------------------------------------------
 
@@ -74,9 +81,9 @@ int  main(void) {
     /* Ensure all priority bits are assigned as preemption priority bits. */
     NVIC_PriorityGroupConfig(NVIC_PriorityGroup_4);
 
-    CARME_IO1_Init();
+    vIo1Init();
     CARME_IO2_Init();
-    CARME_IO1_LED_Set(0x01, 0xFF);  // Turn on LED 1 and 8
+    vIo1LedWrite(0x01, 0xFF);       // Turn on LED 1 and 8
 
     xTaskCreate(vAppTask1,
                 "Task1",
@@ -92,6 +99,9 @@ int  main(void) {
                 PRIORITY_TASK2,
                 &taskHandle);
 
+    /* Continuous poti acquisition, Task2 gets the results */
+    vAdcInit(taskHandle);
+
     vTaskStartScheduler();
 
     /* code never reached */
@@ -118,12 +128,12 @@ static void vAppTask1(void *pvData) {
     uint8_t     u8LED1to8;
     uint8_t     u8Led = 0;
 
-    u16Speed = 100;
+    vSharedPublish(&sSpeed, 100);
 
     while(1){
 
         /* Get LED state, shift left, check overflow and show again */
-        CARME_IO1_LED_Get(&u8Led);
+        u8Led = u8Io1LedGet();
      
         u8LED1to8 = u8Led & 0b11111111;          /* Mask all bits */
      
@@ -133,16 +143,17 @@ static void vAppTask1(void *pvData) {
             u8LED1to8 <<= 1;                     /* Shift LED left one position */
         }
      
-        CARME_IO1_LED_Set(u8LED1to8, 0xFF);
+        vIo1LedWrite(u8LED1to8, 0xFF);
    
-        vTaskDelay(u16Speed);
+        vTaskDelay(u32SharedRead(&sSpeed));
     }
 }
 
 /*******************************************************************************
  *  function :    AppTask2
  ******************************************************************************/
-/** \brief        reads the potentiometer
+/** \brief        reads the potentiometer, woken by the ADC service for
+ *                every averaged result
  *
  *  \type         local
  *
@@ -153,10 +164,14 @@ static void vAppTask1(void *pvData) {
  ******************************************************************************/
 static void  vAppTask2(void *pvData) {
 
+    uint16_t u16Adc[ADC_CHANNELS];
     uint16_t potiValue;
 
     while(1) {
-        CARME_IO2_ADC_Get(CARME_IO2_ADC_PORT0, &potiValue);
+        if (xAdcRead(u16Adc, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        potiValue = u16Adc[CARME_IO2_ADC_PORT0];
 
         if(potiValue < 50){
             potiValue = 50;
@@ -165,10 +180,6 @@ static void  vAppTask2(void *pvData) {
           potiValue = 999;
         }
 
-        taskENTER_CRITICAL();
-        u16Speed = potiValue;
-        taskEXIT_CRITICAL();
-     
-        vTaskDelay(u16Speed);
+        vSharedPublish(&sSpeed, potiValue);
     }
 }
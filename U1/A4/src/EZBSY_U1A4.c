@@ -12,6 +12,10 @@
  *               \li wht4, 24.01.2014, Created
  *               \li wht4, 06.01.2015, Migrated to FreeRTOS V8.0.0
  *               \li WBR1, 09.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, One IO1 snapshot instead of two tasks
+ *               \li id101010, 17.10.2026, Values through the frame buffer
+ *               \li id101010, 17.10.2026, Lines padded by the format width
+ *               \li id101010, 17.10.2026, Snapshot handed over as one cell
  *
  ******************************************************************************/
 /*
@@ -19,7 +23,7 @@
  *              main
  *  functions  local:
  *              vAppTask1
- *              vAppTask2
+ *              vAppTask3
  *
  ******************************************************************************/
 
@@ -40,14 +44,16 @@
 #include <timers.h>
 #include <memPoolService.h>
 
+#include "io1Service.h"
+#include "sharedState.h"
+#include "frameBuffer.h"
+
 //----- Macros -----------------------------------------------------------------
 #define STACKSIZE_TASK1        ( 256 )
-#define STACKSIZE_TASK2        ( 256 )
 #define STACKSIZE_TASK3        ( 256 )
 
 #define SPEED                  ( 200 )
 #define PRIORITY_TASK1         ( 1 )
-#define PRIORITY_TASK2         ( 1 )
 #define PRIORITY_TASK3         ( 1 )
 
 #define Y_HEADERLINE  ( 1 )     /* Pixel y-pos for headerline                 */
@@ -55,6 +61,9 @@
 #define Y_INSTR1      ( 180 )   /* Pixel y-pos for instruction1 text          */
 #define Y_INSTR2      ( 200 )   /* Pixel y-pos for instruction2 text          */
 #define X_BORDER      ( 18 )    /* Pixel x-pos for border                     */
+#define LINE_BUTTONS  ( 10 )    /* Text line of the buttons                   */
+#define LINE_SWITCHES ( 11 )    /* Text line of the switches                  */
+#define LINE_BUS      ( 13 )    /* Text line of the bus writes per frame      */
 
 #define BUTTON_T0     ( 0x01 )  /* Value returned if Button T0 is pushed      */
 #define BUTTON_T1     ( 0x02 )  /* Value returned if Button T1 is pushed      */
@@ -62,18 +71,18 @@
 #define BUTTON_T3     ( 0x08 )  /* Value returned if Button T3 is pushed      */
 
 //----- Data types -------------------------------------------------------------
+typedef SHARED_SNAP_T(Io1Snapshot_t) KitSnap_t;
 
 //----- Function prototypes ----------------------------------------------------
 static void  vAppTask1(void *pvData);
-static void  vAppTask2(void *pvData);
 static void  vAppTask3(void *pvData);
 
 //----- Data -------------------------------------------------------------------
-static uint8_t u8SwitchState;
-static uint8_t u8ButtonState;
+static KitSnap_t sKit = SHARED_SNAP_INIT({ 0 }); /* Board state, by Task1    */
 static const char *pcHello = "EZBSY U1A4";
-static const char *pcButtonsValueText = "Buttons = %d";
-static const char *pcSwitchesValueText = "Switches = %d";
+/* Lines of one width, a shorter value overwrites all of a longer one */
+static const char *pcButtonsValueText = "Buttons = %-4d";
+static const char *pcSwitchesValueText = "Switches = %-3d";
 
 //----- Implementation ---------------------------------------------------------
 
@@ -94,15 +103,17 @@ int  main(void) {
     /* Ensure all priority bits are assigned as preemption priority bits. */
     NVIC_PriorityGroupConfig(NVIC_PriorityGroup_4);
 
-    CARME_IO1_Init();
+    vIo1Init();
     CARME_IO2_Init();
     CARME_Init();
-    CARME_IO1_LED_Set(0x01, 0xFF);  // Turn on LED 1 and 8
+    vIo1LedWrite(0x01, 0xFF);       // Turn on LED 1 and 8
 
     LCD_Init();
+    vFbInit();
     LCD_SetFont(&font_8x16B);
-    LCD_DisplayStringCenterLine(Y_HEADERLINE, pcHello);
+    vFbDisplayStringCenterLine(Y_HEADERLINE, pcHello);
     LCD_SetFont(&font_8x13);
+    vFbFlush();
 
 
     xTaskCreate(vAppTask1,
@@ -112,13 +123,6 @@ int  main(void) {
                 PRIORITY_TASK1,
                 &taskHandle);
 
-    xTaskCreate(vAppTask2,
-                "Task2",
-                STACKSIZE_TASK2,
-                NULL,
-                PRIORITY_TASK2,
-                &taskHandle);
-    
     xTaskCreate(vAppTask3,
                 "Task3",
                 STACKSIZE_TASK3,
@@ -138,7 +142,8 @@ int  main(void) {
 /*******************************************************************************
  *  function :    AppTask1
  ******************************************************************************/
-/** \brief        reads the switches
+/** \brief        reads switches and buttons in one snapshot and publishes
+ *                it as a whole in sKit
  *
  *  \type         local
  *
@@ -149,32 +154,13 @@ int  main(void) {
  ******************************************************************************/
 static void vAppTask1(void *pvData) {
 
-    while(1){
-
-        /* Get switch states */
-        CARME_IO1_SWITCH_Get(&u8SwitchState);
-        vTaskDelay(SPEED);
-    }
-}
-
-/*******************************************************************************
- *  function :    AppTask2
- ******************************************************************************/
-/** \brief        reads the buttons
- *
- *  \type         local
- *
- *  \param[in]    pvData    not used
- *
- *  \return       void
- *
- ******************************************************************************/
-static void  vAppTask2(void *pvData) {
+    Io1Snapshot_t sSnapshot;
 
-    while(1) {
+    while(1){
 
-        /* Get button states */
-        CARME_IO1_BUTTON_Get(&u8ButtonState);
+        /* Get switch and button states */
+        vIo1Snapshot(&sSnapshot);
+        SHARED_SNAP_WRITE(&sKit, &sSnapshot);
         vTaskDelay(SPEED);
     }
 }
@@ -182,7 +168,10 @@ static void  vAppTask2(void *pvData) {
 /*******************************************************************************
  *  function :    AppTask3
  ******************************************************************************/
-/** \brief        Prints the values on the lcd
+/** \brief        Prints the values on the lcd, buttons and switches of one
+ *                snapshot. The lines are padded to
+ *                one width and drawn into the frame buffer, the flush sends
+ *                only the digits which changed.
  *
  *  \type         local
  *
@@ -194,14 +183,24 @@ static void  vAppTask2(void *pvData) {
 static void  vAppTask3(void *pvData) {
 
     char cBuffer[64];
+    FbStats_t sBus;
+    Io1Snapshot_t sSnapshot;
 
     while(1) {
-        sprintf(cBuffer, pcButtonsValueText, (int) u8ButtonState);
-        LCD_DisplayStringCenterLine(10, "              ");
-        LCD_DisplayStringCenterLine(10, cBuffer);
-        sprintf(cBuffer, pcSwitchesValueText, (int) u8SwitchState);
-        LCD_DisplayStringCenterLine(11, "              ");
-        LCD_DisplayStringCenterLine(11, cBuffer);
+        SHARED_SNAP_READ(&sKit, &sSnapshot);
+        sprintf(cBuffer, pcButtonsValueText, (int) sSnapshot.u8Button);
+        vFbDisplayStringCenterLine(LINE_BUTTONS, cBuffer);
+
+        sprintf(cBuffer, pcSwitchesValueText, (int) sSnapshot.u8Switch);
+        vFbDisplayStringCenterLine(LINE_SWITCHES, cBuffer);
+
+        /* Bus writes of the last frame: through sGUI and as flushed */
+        vFbGetStats(&sBus);
+        sprintf(cBuffer, "Bus: sGUI %-6d fb %-8d", (int) sBus.u32Direct,
+                (int) sBus.u32Flushed);
+        vFbDisplayStringCenterLine(LINE_BUS, cBuffer);
+
+        vFbFlush();
 
         vTaskDelay(SPEED);
     }
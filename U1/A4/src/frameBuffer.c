@@ -0,0 +1,542 @@
+/******************************************************************************/
+/** \file       frameBuffer.c
+ *******************************************************************************
+ *
+ *  \brief      Shadow framebuffer with dirty rectangles. The glyphs are
+ *              expanded like LCD_DisplayCharXY does: one word per column
+ *              of datasize bytes, bit height-1 is the top row.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Flush through lcdDma with FB_DMA
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vFbInit
+ *              vFbSetTextColor
+ *              vFbSetBackColor
+ *              vFbFillArea
+ *              vFbDisplayStringXY
+ *              vFbDisplayStringCenterLine
+ *              vFbFlush
+ *              vFbGetStats
+ *  functions  local:
+ *              vFbPixel
+ *              vFbChar
+ *              vFbUnion
+ *              u32FbArea
+ *              vFbAddRect
+ *              vFbSync
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <string.h>                     /* String handling                    */
+
+#include "frameBuffer.h"
+
+#ifdef FB_DMA
+#include "lcdDma.h"
+#endif
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    uint16_t u16X1, u16Y1;              /* Upper left corner, inclusive       */
+    uint16_t u16X2, u16Y2;              /* Lower right corner, inclusive      */
+} FbRect_t;                             /* Empty while u16X1 > u16X2          */
+
+//----- Function prototypes ----------------------------------------------------
+static void     vFbPixel(uint16_t u16X, uint16_t u16Y, LCDCOLOR Color,
+                         FbRect_t *psChanged);
+static void     vFbChar(uint16_t u16X, uint16_t u16Y, char cChar,
+                        const FONT_T *psFont, FbRect_t *psChanged);
+static void     vFbUnion(FbRect_t *psDst, const FbRect_t *psA, const FbRect_t *psB);
+static uint32_t u32FbArea(const FbRect_t *psRect);
+static void     vFbAddRect(const FbRect_t *psRect);
+static void     vFbSync(void);
+
+//----- Data -------------------------------------------------------------------
+static uint16_t *pu16Frame;             /* FB_WIDTH * FB_HEIGHT pixels        */
+#ifdef FB_DMA
+static uint8_t   u8Pending;             /* Flush may still read the buffer    */
+#else
+static uint16_t  u16Stage[FB_STAGE_PIXELS]; /* Window sent by the flush       */
+#endif
+static FbRect_t  sRects[FB_MAX_RECTS];  /* Changed since the last flush       */
+static uint8_t   u8Rects;
+static LCDCOLOR  TextColor = GUI_COLOR_WHITE;
+static LCDCOLOR  BackColor = GUI_COLOR_BLACK;
+static uint32_t  u32Direct;             /* sGUI cost of the current frame     */
+static FbStats_t sStats;                /* Last frame                         */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vFbInit
+ ******************************************************************************/
+/** \brief        Clear the buffer and the display. With FB_DMA the
+ *                display is cleared by a DMA job, the scheduler may not run
+ *                yet.
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vFbInit(void) {
+
+    uint32_t u32Pixel;
+
+    pu16Frame = FB_MEMORY;
+    for (u32Pixel = 0; u32Pixel < (uint32_t) FB_WIDTH * FB_HEIGHT; u32Pixel++) {
+        pu16Frame[u32Pixel] = GUI_COLOR_BLACK;
+    }
+    u8Rects = 0;
+    u32Direct = 0;
+#ifdef FB_DMA
+    vLcdDmaInit();
+    xLcdDmaFillArea(0, 0, FB_WIDTH - 1, FB_HEIGHT - 1, GUI_COLOR_BLACK,
+                    portMAX_DELAY);
+    u8Pending = 0;
+#else
+    LCD_Clear(GUI_COLOR_BLACK);
+#endif
+}
+
+/*******************************************************************************
+ *  function :    vFbSetTextColor
+ ******************************************************************************/
+/** \brief        Set the text color
+ *
+ *  \type         global
+ *
+ *  \param[in]    Color     RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vFbSetTextColor(LCDCOLOR Color) {
+
+    TextColor = Color;
+}
+
+/*******************************************************************************
+ *  function :    vFbSetBackColor
+ ******************************************************************************/
+/** \brief        Set the text background color
+ *
+ *  \type         global
+ *
+ *  \param[in]    Color     RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vFbSetBackColor(LCDCOLOR Color) {
+
+    BackColor = Color;
+}
+
+/*******************************************************************************
+ *  function :    vFbFillArea
+ ******************************************************************************/
+/** \brief        Fill a window, corners are inclusive and clipped
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16X1, u16Y1  upper left corner
+ *  \param[in]    u16X2, u16Y2  lower right corner
+ *  \param[in]    Color         RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vFbFillArea(uint16_t u16X1, uint16_t u16Y1,
+                 uint16_t u16X2, uint16_t u16Y2, LCDCOLOR Color) {
+
+    FbRect_t sChanged = { FB_WIDTH, FB_HEIGHT, 0, 0 };
+    uint16_t u16X, u16Y;
+
+    if ((u16X1 > u16X2) || (u16Y1 > u16Y2)) {
+        return;
+    }
+    vFbSync();
+    u32Direct += FB_WINDOW_WRITES +
+                 (uint32_t) (u16X2 - u16X1 + 1) * (u16Y2 - u16Y1 + 1);
+
+    for (u16Y = u16Y1; (u16Y <= u16Y2) && (u16Y < FB_HEIGHT); u16Y++) {
+        for (u16X = u16X1; (u16X <= u16X2) && (u16X < FB_WIDTH); u16X++) {
+            vFbPixel(u16X, u16Y, Color, &sChanged);
+        }
+    }
+    vFbAddRect(&sChanged);
+}
+
+/*******************************************************************************
+ *  function :    vFbDisplayStringXY
+ ******************************************************************************/
+/** \brief        Draw a string with the current sGUI font, like
+ *                LCD_DisplayStringXY
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16X, u16Y    upper left corner
+ *  \param[in]    pcText        string
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vFbDisplayStringXY(uint16_t u16X, uint16_t u16Y, const char *pcText) {
+
+    FbRect_t sChanged = { FB_WIDTH, FB_HEIGHT, 0, 0 };
+    const FONT_T *psFont = LCD_GetFont();
+
+    vFbSync();
+    while (*pcText != '\0') {
+        vFbChar(u16X, u16Y, *pcText++, psFont, &sChanged);
+        u32Direct += FB_WINDOW_WRITES + (uint32_t) psFont->width * psFont->height;
+        u16X += psFont->width;
+    }
+    vFbAddRect(&sChanged);
+}
+
+/*******************************************************************************
+ *  function :    vFbDisplayStringCenterLine
+ ******************************************************************************/
+/** \brief        Draw a string centered on a text line, like
+ *                LCD_DisplayStringCenterLine
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8Line    text line
+ *  \param[in]    pcText    string
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vFbDisplayStringCenterLine(uint8_t u8Line, const char *pcText) {
+
+    const FONT_T *psFont = LCD_GetFont();
+    uint16_t u16Width = 0;
+    uint8_t u8Chars = 0;
+
+    while ((u8Chars < FB_WIDTH / psFont->width) && (pcText[u8Chars] != '\0')) {
+        u16Width += psFont->width;
+        u8Chars++;
+    }
+    vFbDisplayStringXY((FB_WIDTH - u16Width) / 2,
+                       (uint16_t) (u8Line * psFont->height), pcText);
+}
+
+/*******************************************************************************
+ *  function :    vFbFlush
+ ******************************************************************************/
+/** \brief        Send the dirty rectangles to the display and end the frame.
+ *                Each rectangle is copied row by row into u16Stage and sent
+ *                as one window per FB_STAGE_PIXELS. With FB_DMA every
+ *                rectangle is one DMA job straight from the buffer, the
+ *                function returns before the display is updated and the
+ *                next drawing call waits for the end of the jobs.
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vFbFlush(void) {
+
+    uint32_t u32Flushed = 0;
+    uint16_t u16Windows = 0;
+    uint16_t u16Width;
+    uint8_t  u8Rect;
+#ifdef FB_DMA
+    LcdDmaJob_t sJob = { 0 };
+#else
+    uint16_t u16Rows;
+    uint16_t u16Y, u16Row, u16Last;
+    uint16_t *pu16Dst;
+#endif
+
+    for (u8Rect = 0; u8Rect < u8Rects; u8Rect++) {
+        u16Width = sRects[u8Rect].u16X2 - sRects[u8Rect].u16X1 + 1;
+#ifdef FB_DMA
+        sJob.u16X1 = sRects[u8Rect].u16X1;
+        sJob.u16Y1 = sRects[u8Rect].u16Y1;
+        sJob.u16X2 = sRects[u8Rect].u16X2;
+        sJob.u16Y2 = sRects[u8Rect].u16Y2;
+        sJob.pu16Data = &pu16Frame[sJob.u16Y1 * FB_WIDTH + sJob.u16X1];
+        sJob.u16Stride = FB_WIDTH;
+        xLcdDmaSubmit(&sJob, portMAX_DELAY);
+        u8Pending = 1;
+
+        u32Flushed += FB_WINDOW_WRITES + (uint32_t) u16Width *
+                      (sRects[u8Rect].u16Y2 - sRects[u8Rect].u16Y1 + 1);
+        u16Windows++;
+#else
+        u16Rows = FB_STAGE_PIXELS / u16Width;
+
+        for (u16Y = sRects[u8Rect].u16Y1; u16Y <= sRects[u8Rect].u16Y2;
+                u16Y = u16Last + 1) {
+            u16Last = u16Y + u16Rows - 1;
+            if (u16Last > sRects[u8Rect].u16Y2) {
+                u16Last = sRects[u8Rect].u16Y2;
+            }
+
+            pu16Dst = u16Stage;
+            for (u16Row = u16Y; u16Row <= u16Last; u16Row++) {
+                memcpy(pu16Dst,
+                       &pu16Frame[u16Row * FB_WIDTH + sRects[u8Rect].u16X1],
+                       u16Width * sizeof(uint16_t));
+                pu16Dst += u16Width;
+            }
+            LCD_WriteArea(sRects[u8Rect].u16X1, u16Y,
+                          sRects[u8Rect].u16X2, u16Last, u16Stage);
+
+            u32Flushed += FB_WINDOW_WRITES +
+                          (uint32_t) u16Width * (u16Last - u16Y + 1);
+            u16Windows++;
+        }
+#endif
+    }
+    u8Rects = 0;
+
+    sStats.u32Direct = u32Direct;
+    sStats.u32Flushed = u32Flushed;
+    sStats.u16Windows = u16Windows;
+    u32Direct = 0;
+}
+
+/*******************************************************************************
+ *  function :    vFbGetStats
+ ******************************************************************************/
+/** \brief        Bus writes of the last flushed frame
+ *
+ *  \type         global
+ *
+ *  \param[out]   psStats   statistics
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vFbGetStats(FbStats_t *psStats) {
+
+    *psStats = sStats;
+}
+
+/*******************************************************************************
+ *  function :    vFbPixel
+ ******************************************************************************/
+/** \brief        Set one pixel, grow the changed rectangle if it differs
+ *
+ *  \type         local
+ *
+ *  \param[in]    u16X, u16Y    position, clipped
+ *  \param[in]    Color         RGB565 color
+ *  \param[inout] psChanged     changed pixels of the current call
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vFbPixel(uint16_t u16X, uint16_t u16Y, LCDCOLOR Color,
+                     FbRect_t *psChanged) {
+
+    uint16_t *pu16Pixel;
+
+    if ((u16X >= FB_WIDTH) || (u16Y >= FB_HEIGHT)) {
+        return;
+    }
+    pu16Pixel = &pu16Frame[u16Y * FB_WIDTH + u16X];
+    if (*pu16Pixel == Color) {
+        return;
+    }
+    *pu16Pixel = Color;
+
+    if (u16X < psChanged->u16X1) {
+        psChanged->u16X1 = u16X;
+    }
+    if (u16X > psChanged->u16X2) {
+        psChanged->u16X2 = u16X;
+    }
+    if (u16Y < psChanged->u16Y1) {
+        psChanged->u16Y1 = u16Y;
+    }
+    if (u16Y > psChanged->u16Y2) {
+        psChanged->u16Y2 = u16Y;
+    }
+}
+
+/*******************************************************************************
+ *  function :    vFbChar
+ ******************************************************************************/
+/** \brief        Expand one glyph into the buffer. Characters outside of
+ *                ' '..'~' are drawn as blank. A font without bitmaps (host
+ *                simulation) is drawn as a box, like simLcd.c does.
+ *
+ *  \type         local
+ *
+ *  \param[in]    u16X, u16Y    upper left corner
+ *  \param[in]    cChar         character
+ *  \param[in]    psFont        font
+ *  \param[inout] psChanged     changed pixels of the current call
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vFbChar(uint16_t u16X, uint16_t u16Y, char cChar,
+                    const FONT_T *psFont, FbRect_t *psChanged) {
+
+    const uint8_t *pu8Column = NULL;
+    uint32_t u32Column;
+    uint32_t u32Top = 1UL << (psFont->height - 1);
+    uint8_t  u8Col, u8Row, u8Byte;
+
+    if ((cChar < ' ') || (cChar > '~')) {
+        cChar = ' ';
+    }
+    if (psFont->data != NULL) {
+        pu8Column = (const uint8_t *) psFont->data +
+                    (cChar - ' ') * psFont->width * psFont->datasize;
+    }
+
+    for (u8Col = 0; u8Col < psFont->width; u8Col++) {
+        u32Column = 0;
+        if (pu8Column != NULL) {
+            for (u8Byte = psFont->datasize; u8Byte > 0; u8Byte--) {
+                u32Column = (u32Column << 8) | pu8Column[u8Byte - 1];
+            }
+            pu8Column += psFont->datasize;
+        } else if ((cChar != ' ') && (u8Col > 0) && (u8Col < psFont->width - 1)) {
+            u32Column = (u32Top - 1) & ~1UL;
+        }
+
+        for (u8Row = 0; u8Row < psFont->height; u8Row++) {
+            vFbPixel(u16X + u8Col, u16Y + u8Row,
+                     (u32Column & (u32Top >> u8Row)) ? TextColor : BackColor,
+                     psChanged);
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    vFbUnion
+ ******************************************************************************/
+/** \brief        Bounding rectangle of two rectangles
+ *
+ *  \type         local
+ *
+ *  \param[out]   psDst     union
+ *  \param[in]    psA, psB  rectangles, not empty
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vFbUnion(FbRect_t *psDst, const FbRect_t *psA, const FbRect_t *psB) {
+
+    psDst->u16X1 = (psA->u16X1 < psB->u16X1) ? psA->u16X1 : psB->u16X1;
+    psDst->u16Y1 = (psA->u16Y1 < psB->u16Y1) ? psA->u16Y1 : psB->u16Y1;
+    psDst->u16X2 = (psA->u16X2 > psB->u16X2) ? psA->u16X2 : psB->u16X2;
+    psDst->u16Y2 = (psA->u16Y2 > psB->u16Y2) ? psA->u16Y2 : psB->u16Y2;
+}
+
+/*******************************************************************************
+ *  function :    u32FbArea
+ ******************************************************************************/
+/** \brief        Number of pixels of a rectangle
+ *
+ *  \type         local
+ *
+ *  \param[in]    psRect    rectangle, not empty
+ *
+ *  \return       pixels
+ *
+ ******************************************************************************/
+static uint32_t u32FbArea(const FbRect_t *psRect) {
+
+    return (uint32_t) (psRect->u16X2 - psRect->u16X1 + 1) *
+           (psRect->u16Y2 - psRect->u16Y1 + 1);
+}
+
+/*******************************************************************************
+ *  function :    vFbAddRect
+ ******************************************************************************/
+/** \brief        Add a changed rectangle to the dirty list. It is merged
+ *                with every rectangle whose union costs less than a window
+ *                of its own. If the list is full, it is merged with the
+ *                rectangle giving the smallest union.
+ *
+ *  \type         local
+ *
+ *  \param[in]    psRect    changed pixels, may be empty
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vFbAddRect(const FbRect_t *psRect) {
+
+    FbRect_t sNew = *psRect;
+    FbRect_t sUnion;
+    uint32_t u32Area;
+    uint32_t u32Best = UINT32_MAX;
+    uint8_t  u8Best = 0;
+    uint8_t  u8Rect = 0;
+
+    if (sNew.u16X1 > sNew.u16X2) {
+        return;                         /* Nothing changed */
+    }
+
+    while (u8Rect < u8Rects) {
+        vFbUnion(&sUnion, &sRects[u8Rect], &sNew);
+        if (u32FbArea(&sUnion) <= u32FbArea(&sRects[u8Rect]) +
+                u32FbArea(&sNew) + FB_WINDOW_WRITES) {
+            /* The union may reach rectangles checked before */
+            sNew = sUnion;
+            sRects[u8Rect] = sRects[--u8Rects];
+            u8Rect = 0;
+        } else {
+            u8Rect++;
+        }
+    }
+
+    if (u8Rects == FB_MAX_RECTS) {
+        for (u8Rect = 0; u8Rect < u8Rects; u8Rect++) {
+            vFbUnion(&sUnion, &sRects[u8Rect], &sNew);
+            u32Area = u32FbArea(&sUnion);
+            if (u32Area < u32Best) {
+                u32Best = u32Area;
+                u8Best = u8Rect;
+            }
+        }
+        vFbUnion(&sNew, &sRects[u8Best], &sNew);
+        sRects[u8Best] = sRects[--u8Rects];
+    }
+    sRects[u8Rects++] = sNew;
+}
+
+/*******************************************************************************
+ *  function :    vFbSync
+ ******************************************************************************/
+/** \brief        Wait until the DMA of the last flush has read the buffer,
+ *                before it is changed. Without FB_DMA there is nothing to
+ *                wait for.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vFbSync(void) {
+
+#ifdef FB_DMA
+    if (u8Pending != 0) {
+        xLcdDmaWaitIdle(portMAX_DELAY);
+        u8Pending = 0;
+    }
+#endif
+}
@@ -0,0 +1,76 @@
+#ifndef FRAMEBUFFER_H_
+#define FRAMEBUFFER_H_
+/******************************************************************************/
+/** \file       frameBuffer.h
+ *******************************************************************************
+ *
+ *  \brief      Off-screen RGB565 copy of the display for the sGUI text
+ *              functions. Drawing goes to the buffer in the external PSRAM
+ *              and only collects the rectangles whose pixels really changed,
+ *              so redrawing an unchanged text costs nothing. vFbFlush merges
+ *              the rectangles and sends them with LCD_WriteArea, the screen
+ *              changes once per frame without the flicker of clear and
+ *              redraw. The bus writes of every frame are counted, together
+ *              with what the same calls would have cost through sGUI.
+ *              With FB_DMA the rectangles are DMA jobs of lcdDma, the
+ *              flush returns at once and the CPU is free while they run.
+ *              The buffer is not locked, one task draws and flushes.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vFbInit
+ *              vFbSetTextColor
+ *              vFbSetBackColor
+ *              vFbFillArea
+ *              vFbDisplayStringXY
+ *              vFbDisplayStringCenterLine
+ *              vFbFlush
+ *              vFbGetStats
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <carme.h>                      /* CARME Module                       */
+#include <lcd.h>
+
+//----- Macros -----------------------------------------------------------------
+//#define FB_DMA                        /* Flush with the DMA jobs of lcdDma  */
+
+#ifndef FB_MEMORY
+/* Mapped by CARME_Init from the startup code, 150 KB do not fit the SRAM */
+#define FB_MEMORY             ( ( uint16_t * ) FSMC_PSRAM_BASE )
+#endif
+
+#define FB_WIDTH              ( LCD_HOR_RESOLUTION )
+#define FB_HEIGHT             ( LCD_VER_RESOLUTION )
+#define FB_MAX_RECTS          ( 8 )     /* Dirty rectangles kept apart        */
+#define FB_STAGE_PIXELS       ( 2 * 1024 ) /* SRAM buffer for one window      */
+
+/* Bus writes to open a SSD1963 window: column and page address with four
+ * parameters each, memory write command. Every pixel is one more write. */
+#define FB_WINDOW_WRITES      ( 11 )
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    uint32_t u32Direct;                 /* Writes through sGUI directly       */
+    uint32_t u32Flushed;                /* Writes of the flush                */
+    uint16_t u16Windows;                /* Windows of the flush               */
+} FbStats_t;
+
+//----- Function prototypes ----------------------------------------------------
+extern void vFbInit(void);
+extern void vFbSetTextColor(LCDCOLOR Color);
+extern void vFbSetBackColor(LCDCOLOR Color);
+extern void vFbFillArea(uint16_t u16X1, uint16_t u16Y1,
+                        uint16_t u16X2, uint16_t u16Y2, LCDCOLOR Color);
+extern void vFbDisplayStringXY(uint16_t u16X, uint16_t u16Y, const char *pcText);
+extern void vFbDisplayStringCenterLine(uint8_t u8Line, const char *pcText);
+extern void vFbFlush(void);
+extern void vFbGetStats(FbStats_t *psStats);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* FRAMEBUFFER_H_ */
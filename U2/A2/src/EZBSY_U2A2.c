@@ -12,6 +12,14 @@
  *               \li wht4, 24.01.2014, Created
  *               \li wht4, 06.01.2015, Migrated to FreeRTOS V8.0.0
  *               \li WBR1, 09.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Task 3 shows a top view of all tasks
+ *               \li id101010, 17.10.2026, Poti from the DMA ADC service
+ *               \li id101010, 17.10.2026, Speed in a lock-free shared cell
+ *               \li id101010, 17.10.2026, LEDs through the IO1 shadow
+ *               \li id101010, 17.10.2026, Screen from a shadow frame buffer
+ *               \li id101010, 17.10.2026, Values padded by the format width
+ *               \li id101010, 17.10.2026, Check the tasks fit the top view
+ *               \li id101010, 17.10.2026, TOP_PROFILE
  *
  ******************************************************************************/
 /*
@@ -21,6 +29,7 @@
  *              vAppTask1
  *              vAppTask2
  *              vAppTask3
+ *              vAppProfile
  *
  ******************************************************************************/
 
@@ -41,6 +50,13 @@
 #include <timers.h>
 #include <memPoolService.h>
 
+#include "adcService.h"
+#include "sharedState.h"
+#include "taskStats.h"
+#include "topView.h"
+#include "io1Service.h"
+#include "frameBuffer.h"
+
 //----- Macros -----------------------------------------------------------------
 #define STACKSIZE_TASK1        ( 256 )
 #define STACKSIZE_TASK2        ( 256 )
@@ -50,16 +66,17 @@
 #define PRIORITY_TASK2         ( 1 )
 #define PRIORITY_TASK3         ( 1 )
 
+#define KERNEL_TASKS           ( 1 + configUSE_TIMERS ) /* Idle, timer task   */
+#define TOP_PROFILE_COUNT      ( 32 )   /* Rounds per profile report          */
+
+/* Compiler switch to measure the cost of the view */
+//#define TOP_PROFILE                   /* Set to show cycles and stack       */
+
 /* GUI Definitions */
-#define Y_NBR_OF_TASKS    ( 10 )   /* pixel y-pos to put the number of tasks  */
-#define Y_HEAP_LOAD       ( 30 )   /* pixel y-pos to put the heap load        */
-#define Y_TITLE           ( 55 )   /* pixel y-pos where to put the stack title*/
-#define Y_STACK           ( 80 )   /* pixel y-pos where to put the startline  */
-#define Y_INCREMENT       ( 16 )   /* pixel increment for each task           */
-#define Y_SPEED           ( 170 )  /* pixel y-pos where to put the speedline  */
-#define Y_HELP            ( 190 )  /* pixel y-pos where to put the helpline   */
-#define X_VALUE1          ( 100 )  /* pixel x-pos where to put the values     */
-#define X_VALUE2          ( 160 )  /* pixel x-pos where to put the values     */
+#define Y_TOP             ( 10 )   /* pixel y-pos of the task view            */
+#define Y_SPEED           ( Y_TOP + TOP_HEIGHT + 10 ) /* y-pos of speedline   */
+#define X_VALUE2          ( 80 )   /* pixel x-pos where to put the values     */
+#define X_BUS             ( 120 )  /* pixel x-pos of the bus writes per frame */
 #define X_COMMENT         ( 16 )   /* pixel x-pos where to put the comment    */
 
 //----- Data types -------------------------------------------------------------
@@ -68,27 +85,16 @@
 static void vAppTask1(void *pvData);
 static void vAppTask2(void *pvData);
 static void vAppTask3(void *pvData);
-static void vGetStackInfo(char* pcBuffer, xTaskHandle pTaskHandle);
+#ifdef TOP_PROFILE
+static void vAppProfile(uint32_t u32Top, uint32_t u32Fmt);
+#endif
 
 //----- Data -------------------------------------------------------------------
-TaskHandle_t   taskLED;      /* handles to tasks to read stack info    */
-TaskHandle_t   taskPoti;
-TaskHandle_t   taskLCD;
-
-uint16_t u16Speed = 100;
+SharedWord_t sSpeed = { 100 };          /* Delay of the chaser in ticks       */
 
 /* GUI Stuff */
-static const char* pcNumberOfTasks = "Number of Tasks: ";/* Number of Task text*/
-static const char* pcHeapLoad      = "Free Heap: ";       /* Free Heap storage */
-static const char* pcTitle         = "Task-Stack   Free stack space";/* Title text */
-static const char* pcLine          = "------------------------";/* Line text */
-static const char* pcLEDTask       = "LED Task";         /* LED task text */
-static const char* pcPotiTask      = "Poti Task";        /* Poti task text */
-static const char* pcLCDTask       = "LCD Task";         /* LCD task text */
 static const char* pcPotiSpeed     = "Speed = ";         /* Poti speed text */
 
-static const char* pcStackData     = "  %d byte"; /* Stack data fromating */
-
 //----- Implementation ---------------------------------------------------------
 
 /*******************************************************************************
@@ -103,45 +109,53 @@ static const char* pcStackData     = "  %d byte"; /* Stack data fromating */
  ******************************************************************************/
 int  main(void) {
 
+    TaskHandle_t taskHandle;
+
     /* Ensure all priority bits are assigned as preemption priority bits. */
     NVIC_PriorityGroupConfig(NVIC_PriorityGroup_4);
 
-    CARME_IO1_Init();
+    vIo1Init();
     CARME_IO2_Init();
-    CARME_IO1_LED_Set(0x01, 0xFF);  // Turn on LED 1 and 8
+    vIo1LedWrite(0x01, 0xFF);       // Turn on LED 1 and 8
     LCD_Init();
+    vFbInit();
 
     /* Print static text */
     LCD_SetFont(&font_8x13);
-    LCD_DisplayStringXY(X_COMMENT, Y_NBR_OF_TASKS, pcNumberOfTasks);
-    LCD_DisplayStringXY(X_COMMENT, Y_HEAP_LOAD, pcHeapLoad);
-    LCD_DisplayStringXY(X_COMMENT, Y_TITLE, pcTitle);
-    LCD_DisplayStringXY(X_COMMENT, Y_TITLE+16, pcLine);
-    LCD_DisplayStringXY(X_COMMENT, Y_STACK, pcLEDTask);
-    LCD_DisplayStringXY(X_COMMENT, Y_STACK + Y_INCREMENT, pcPotiTask);
-    LCD_DisplayStringXY(X_COMMENT, Y_STACK + 2 * Y_INCREMENT, pcLCDTask);
-    LCD_DisplayStringXY(X_COMMENT, Y_SPEED, pcPotiSpeed);
+    vTopInit(X_COMMENT, Y_TOP);
+    vFbDisplayStringXY(X_COMMENT, Y_SPEED, pcPotiSpeed);
+    vFbFlush();
+
+    /* Run time counter for the CPU load of the tasks */
+    vTaskStatsInit();
 
     xTaskCreate(vAppTask1,
                 "Task1",
                 STACKSIZE_TASK1,
                 NULL,
                 PRIORITY_TASK1,
-                &taskLED);
+                NULL);
 
     xTaskCreate(vAppTask2,
                 "Task2",
                 STACKSIZE_TASK2,
                 NULL,
                 PRIORITY_TASK2,
-                &taskPoti);
+                &taskHandle);
+
+    /* Continuous poti acquisition, Task2 gets the results */
+    vAdcInit(taskHandle);
 
     xTaskCreate(vAppTask3,
                 "Task3",
                 STACKSIZE_TASK3,
                 NULL,
                 PRIORITY_TASK3,
-                &taskLCD);
+                NULL);
+
+    /* The top view and the run time counters cover TASKSTATS_MAX_TASKS */
+    configASSERT(uxTaskGetNumberOfTasks() + KERNEL_TASKS <=
+                 TASKSTATS_MAX_TASKS);
 
     vTaskStartScheduler();
 
@@ -169,12 +183,12 @@ static void vAppTask1(void *pvData) {
     uint8_t     u8LED1to8;
     uint8_t     u8Led = 0;
 
-    u16Speed = 100;
+    vSharedPublish(&sSpeed, 100);
 
     while(1){
 
         /* Get LED state, shift left, check overflow and show again */
-        CARME_IO1_LED_Get(&u8Led);
+        u8Led = u8Io1LedGet();
      
         u8LED1to8 = u8Led & 0b11111111;          /* Mask all bits */
      
@@ -184,16 +198,17 @@ static void vAppTask1(void *pvData) {
             u8LED1to8 <<= 1;                     /* Shift LED left one position */
         }
      
-        CARME_IO1_LED_Set(u8LED1to8, 0xFF);
+        vIo1LedWrite(u8LED1to8, 0xFF);
    
-        vTaskDelay(u16Speed);
+        vTaskDelay(u32SharedRead(&sSpeed));
     }
 }
 
 /*******************************************************************************
  *  function :    AppTask2
  ******************************************************************************/
-/** \brief        reads the potentiometer
+/** \brief        reads the potentiometer, woken by the ADC service for
+ *                every averaged result
  *
  *  \type         local
  *
@@ -204,10 +219,14 @@ static void vAppTask1(void *pvData) {
  ******************************************************************************/
 static void vAppTask2(void *pvData) {
 
+    uint16_t u16Adc[ADC_CHANNELS];
     uint16_t potiValue;
 
     while(1) {
-        CARME_IO2_ADC_Get(CARME_IO2_ADC_PORT0, &potiValue);
+        if (xAdcRead(u16Adc, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        potiValue = u16Adc[CARME_IO2_ADC_PORT0];
 
         if(potiValue < 50){
             potiValue = 50;
@@ -216,88 +235,129 @@ static void vAppTask2(void *pvData) {
           potiValue = 999;
         }
 
-        taskENTER_CRITICAL();
-        u16Speed = potiValue;
-        taskEXIT_CRITICAL();
-     
-        vTaskDelay(u16Speed);
+        vSharedPublish(&sSpeed, potiValue);
     }
 }
 
 /*******************************************************************************
- *  function :    vGetStackInfo
+ *  function :    AppTask3
  ******************************************************************************/
-/** \brief        Get the stack information of a task
+/** \brief        prints the state of all tasks and the speed on the lcd.
+ *                The bus writes of the last frame are shown as
+ *                "sGUI <direct> fb <flushed>": what the calls would have
+ *                cost through sGUI and what the frame buffer sent. With
+ *                TOP_PROFILE the line shows vAppProfile instead.
  *
- *  \type         global
+ *  \type         local
  *
- *  \param[in]	  pcBuffer    Formatted information of stack load
- *  \param[in]    pTaskHandle Handle of the task of which we would like stack
- *                            information
+ *  \param[in]    pvData    not used
  *
  *  \return       void
  *
  ******************************************************************************/
-static void vGetStackInfo(char* pcBuffer, xTaskHandle pTaskHandle) {
-
-    uint32_t u32FreeMemory = 0;
+static void vAppTask3(void *pvData) {
 
-    /* read statistics and store them in string */
-    u32FreeMemory = uxTaskGetStackHighWaterMark(pTaskHandle);
+    char cBuffer[42];
+    uint16_t ledSpeed;
+    FbStats_t sBus;
+#ifdef TOP_PROFILE
+    uint32_t u32Start;
+    uint32_t u32Top;
 
-    sprintf(pcBuffer, pcStackData, (int)(u32FreeMemory << 2));
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
 
+    while(1) {    
+        /* Update the changed parts of the task view */
+#ifdef TOP_PROFILE
+        u32Start = DWT->CYCCNT;
+#endif
+        vTopUpdate();
+#ifdef TOP_PROFILE
+        u32Top = DWT->CYCCNT - u32Start;
+#endif
+
+        ledSpeed = (uint16_t) u32SharedRead(&sSpeed);
+
+        sprintf(cBuffer, "%-4d", (int) ledSpeed);
+        vFbDisplayStringXY(X_VALUE2, Y_SPEED, cBuffer);
+
+        /* Cost of the last frame, sent with the next one */
+        vFbGetStats(&sBus);
+#ifdef TOP_PROFILE
+        u32Start = DWT->CYCCNT;
+#endif
+        sprintf(cBuffer, "sGUI %-7d fb %-8d", (int) sBus.u32Direct,
+                (int) sBus.u32Flushed);
+#ifdef TOP_PROFILE
+        vAppProfile(u32Top, DWT->CYCCNT - u32Start);
+#else
+        vFbDisplayStringXY(X_BUS, Y_SPEED, cBuffer);
+#endif
+
+        vFbFlush();
+
+        vTaskDelay(TOP_REFRESH_MS / portTICK_RATE_MS);
+    }
 }
 
-
+#ifdef TOP_PROFILE
 /*******************************************************************************
- *  function :    AppTask3
+ *  function :    vAppProfile
  ******************************************************************************/
-/** \brief        prints stack information on the lcd
+/** \brief        Count one round of task 3 and show every TOP_PROFILE_COUNT
+ *                rounds "top <cycles> fmt <cycles> st <words>": the largest
+ *                cycles of vTopUpdate, which formats the stack and CPU
+ *                figures of every task, and of the sprintf of the bus
+ *                line, and the stack high water mark of task 3. The host
+ *                simulation also prints the averages.
  *
  *  \type         local
  *
- *  \param[in]    pvData    not used
+ *  \param[in]    u32Top    core clock cycles of vTopUpdate
+ *  \param[in]    u32Fmt    core clock cycles of the sprintf
  *
  *  \return       void
  *
  ******************************************************************************/
-static void vAppTask3(void *pvData) {
-
-    char cBuffer[42];
-    uint32_t u32Temp;
-    uint16_t ledSpeed;
-
-    while(1) {    
-        /* Get the number of tasks and display them */
-        u32Temp = uxTaskGetNumberOfTasks();
-        sprintf(cBuffer, "%d", (int) u32Temp);
-        LCD_DisplayStringXY(X_VALUE2, Y_NBR_OF_TASKS, cBuffer);
-
-        /* Get the available Heap */
-        u32Temp = xPortGetFreeHeapSize();
-        sprintf(cBuffer, pcStackData, (int) u32Temp);
-        LCD_DisplayStringXY(X_VALUE2, Y_HEAP_LOAD, cBuffer);
-
-        /* Get and display stack information of LED task */
-        vGetStackInfo(cBuffer, taskLED);
-        LCD_DisplayStringXY(X_VALUE1, Y_STACK, cBuffer);
-
-        /* Get and display stack information of Poti task */
-        vGetStackInfo(cBuffer, taskPoti);
-        LCD_DisplayStringXY(X_VALUE1, Y_STACK + Y_INCREMENT, cBuffer);
-
-        /* Get and display stack information of LCD task */
-        vGetStackInfo(cBuffer, taskLCD);
-        LCD_DisplayStringXY(X_VALUE1, Y_STACK + 2 * Y_INCREMENT, cBuffer);
-
-        taskENTER_CRITICAL();   /* disable interrupts */
-        ledSpeed = u16Speed; /* access critical section */
-        taskEXIT_CRITICAL();    /* enable interrupts again */
-
-        sprintf(cBuffer, "%d", (int) ledSpeed);
-        LCD_DisplayStringXY(X_VALUE2, Y_SPEED, cBuffer);
-
-        vTaskDelay(u16Speed);
+static void vAppProfile(uint32_t u32Top, uint32_t u32Fmt) {
+
+    static uint32_t u32Rounds;
+    static uint32_t u32TopSum;
+    static uint32_t u32TopMax;
+    static uint32_t u32FmtSum;
+    static uint32_t u32FmtMax;
+    char            cLine[26];          /* 25 characters from X_BUS           */
+    UBaseType_t     uxStack;
+
+    u32Rounds++;
+    u32TopSum += u32Top;
+    u32FmtSum += u32Fmt;
+    if (u32Top > u32TopMax) {
+        u32TopMax = u32Top;
+    }
+    if (u32Fmt > u32FmtMax) {
+        u32FmtMax = u32Fmt;
     }
+    if (u32Rounds < TOP_PROFILE_COUNT) {
+        return;
+    }
+
+    uxStack = uxTaskGetStackHighWaterMark(NULL);
+    snprintf(cLine, sizeof(cLine), "top %-5u fmt %-4u st %-3u",
+             (unsigned int) u32TopMax, (unsigned int) u32FmtMax,
+             (unsigned int) uxStack);
+    vFbDisplayStringXY(X_BUS, Y_SPEED, cLine);
+#ifdef CARME_SIM
+    printf("top cycles max %u avg %u, sprintf cycles max %u avg %u, "
+           "stack min %u words\n", (unsigned int) u32TopMax,
+           (unsigned int) (u32TopSum / u32Rounds), (unsigned int) u32FmtMax,
+           (unsigned int) (u32FmtSum / u32Rounds), (unsigned int) uxStack);
+#endif
+    u32Rounds = 0;
+    u32TopSum = 0;
+    u32TopMax = 0;
+    u32FmtSum = 0;
+    u32FmtMax = 0;
 }
+#endif
@@ -0,0 +1,220 @@
+/******************************************************************************/
+/** \file       adcService.c
+ *******************************************************************************
+ *
+ *  \brief      Continuous acquisition of the CARME IO2 ADC ports with
+ *              TIM3 -> ADC1 -> DMA2 stream 0 in circular mode. The CPU is
+ *              only involved once per half buffer.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vAdcInit
+ *              xAdcRead
+ *              u32AdcGetOverruns
+ *              DMA2_Stream0_IRQHandler
+ *  functions  local:
+ *              .
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>                      /* CARME Module                       */
+
+#include "adcService.h"
+
+//----- Macros -----------------------------------------------------------------
+#if ( ADC_CHANNELS < 1 ) || ( ADC_CHANNELS > 3 )
+#error "ADC_CHANNELS: the IO2 board has 3 ADC ports"
+#endif
+
+#define ADC_BUFFER_SIZE       ( 2 * ADC_OVERSAMPLE * ADC_CHANNELS )
+#define ADC_IRQ_PRIORITY      ( configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1 )
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+
+//----- Data -------------------------------------------------------------------
+/* ADC1 channels of the IO2 ports 0 (poti), 1 and 2 */
+static const uint8_t u8IoChannel[3] = {
+    ADC_Channel_8, ADC_Channel_10, ADC_Channel_12
+};
+
+/* Written by the DMA: two halves of ADC_OVERSAMPLE scans */
+static volatile uint16_t u16Buffer[2][ADC_OVERSAMPLE][ADC_CHANNELS];
+
+static TaskHandle_t     xAdcConsumer;   /* Notified per half buffer           */
+static volatile uint8_t u8ReadyHalf;    /* Half the DMA has just filled       */
+static uint32_t         u32Overruns;    /* Half buffers not read in time      */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vAdcInit
+ ******************************************************************************/
+/** \brief        Set up TIM3, ADC1 and DMA2 and start the acquisition. Call
+ *                before the scheduler, after CARME_IO2_Init.
+ *
+ *  \type         global
+ *
+ *  \param[in]    xConsumer   task notified when a result is ready
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vAdcInit(TaskHandle_t xConsumer) {
+
+    DMA_InitTypeDef sDma;
+    NVIC_InitTypeDef sNvic;
+    ADC_InitTypeDef sAdc;
+    TIM_TimeBaseInitTypeDef sTimeBase;
+    uint8_t u8Rank;
+
+    xAdcConsumer = xConsumer;
+
+    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3, ENABLE);
+
+    /* DMA2 stream 0 channel 0 serves ADC1, wraps around at the end */
+    DMA_DeInit(DMA2_Stream0);
+    DMA_StructInit(&sDma);
+    sDma.DMA_Channel = DMA_Channel_0;
+    sDma.DMA_PeripheralBaseAddr = (uintptr_t) &ADC1->DR;
+    sDma.DMA_Memory0BaseAddr = (uintptr_t) &u16Buffer[0][0][0];
+    sDma.DMA_DIR = DMA_DIR_PeripheralToMemory;
+    sDma.DMA_BufferSize = ADC_BUFFER_SIZE;
+    sDma.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    sDma.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    sDma.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    sDma.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+    sDma.DMA_Mode = DMA_Mode_Circular;
+    sDma.DMA_Priority = DMA_Priority_High;
+    DMA_Init(DMA2_Stream0, &sDma);
+    DMA_ITConfig(DMA2_Stream0, DMA_IT_HT | DMA_IT_TC, ENABLE);
+
+    /* The handler uses the FreeRTOS API */
+    sNvic.NVIC_IRQChannel = DMA2_Stream0_IRQn;
+    sNvic.NVIC_IRQChannelPreemptionPriority = ADC_IRQ_PRIORITY;
+    sNvic.NVIC_IRQChannelSubPriority = 0;
+    sNvic.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&sNvic);
+    DMA_Cmd(DMA2_Stream0, ENABLE);
+
+    /* ADC1 from single software conversions to scans started by TIM3 */
+    ADC_Cmd(ADC1, DISABLE);
+    ADC_StructInit(&sAdc);
+    sAdc.ADC_Resolution = ADC_Resolution_10b;   /* as CARME_IO2_ADC_Get     */
+    sAdc.ADC_ScanConvMode = ENABLE;
+    sAdc.ADC_ContinuousConvMode = DISABLE;
+    sAdc.ADC_ExternalTrigConvEdge = ADC_ExternalTrigConvEdge_Rising;
+    sAdc.ADC_ExternalTrigConv = ADC_ExternalTrigConv_T3_TRGO;
+    sAdc.ADC_DataAlign = ADC_DataAlign_Right;
+    sAdc.ADC_NbrOfConversion = ADC_CHANNELS;
+    ADC_Init(ADC1, &sAdc);
+    for (u8Rank = 0; u8Rank < ADC_CHANNELS; u8Rank++) {
+        ADC_RegularChannelConfig(ADC1, u8IoChannel[u8Rank], u8Rank + 1,
+                                 ADC_SampleTime_480Cycles);
+    }
+    ADC_DMARequestAfterLastTransferCmd(ADC1, ENABLE);
+    ADC_DMACmd(ADC1, ENABLE);
+    ADC_Cmd(ADC1, ENABLE);
+
+    /* TIM3 runs at the APB1 timer clock, SystemCoreClock / 2 */
+    TIM_TimeBaseStructInit(&sTimeBase);
+    sTimeBase.TIM_Prescaler = (uint16_t) (SystemCoreClock / 2 / ADC_TIMER_CLOCK_HZ - 1);
+    sTimeBase.TIM_Period = ADC_TIMER_CLOCK_HZ / ADC_SAMPLE_RATE_HZ - 1;
+    TIM_TimeBaseInit(TIM3, &sTimeBase);
+    TIM_SelectOutputTrigger(TIM3, TIM_TRGOSource_Update);
+    TIM_Cmd(TIM3, ENABLE);
+}
+
+/*******************************************************************************
+ *  function :    xAdcRead
+ ******************************************************************************/
+/** \brief        Wait for the next half buffer and average it. Only the
+ *                consumer task given to vAdcInit may call this.
+ *
+ *  \type         global
+ *
+ *  \param[out]   pu16Values    ADC_CHANNELS averaged values, 10 bit
+ *  \param[in]    xTimeout      ticks to wait for a result
+ *
+ *  \return       pdTRUE if values were read, pdFALSE on timeout
+ *
+ ******************************************************************************/
+BaseType_t xAdcRead(uint16_t *pu16Values, TickType_t xTimeout) {
+
+    uint32_t u32Ready;
+    uint32_t u32Sum;
+    uint8_t  u8Half;
+    uint8_t  u8Channel;
+    uint8_t  u8Scan;
+
+    u32Ready = ulTaskNotifyTake(pdTRUE, xTimeout);
+    if (u32Ready == 0) {
+        return pdFALSE;
+    }
+
+    /* More than one notification: older halves were overwritten already */
+    u32Overruns += u32Ready - 1;
+
+    u8Half = u8ReadyHalf;
+    for (u8Channel = 0; u8Channel < ADC_CHANNELS; u8Channel++) {
+        u32Sum = 0;
+        for (u8Scan = 0; u8Scan < ADC_OVERSAMPLE; u8Scan++) {
+            u32Sum += u16Buffer[u8Half][u8Scan][u8Channel];
+        }
+        pu16Values[u8Channel] = (uint16_t) ((u32Sum + ADC_OVERSAMPLE / 2) / ADC_OVERSAMPLE);
+    }
+    return pdTRUE;
+}
+
+/*******************************************************************************
+ *  function :    u32AdcGetOverruns
+ ******************************************************************************/
+/** \brief        Number of half buffers the consumer missed
+ *
+ *  \type         global
+ *
+ *  \return       missed half buffers since start
+ *
+ ******************************************************************************/
+uint32_t u32AdcGetOverruns(void) {
+
+    return u32Overruns;
+}
+
+/*******************************************************************************
+ *  function :    DMA2_Stream0_IRQHandler
+ ******************************************************************************/
+/** \brief        Half transfer and transfer complete of the ADC buffer
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void DMA2_Stream0_IRQHandler(void) {
+
+    BaseType_t xWoken = pdFALSE;
+
+    if (DMA_GetITStatus(DMA2_Stream0, DMA_IT_HTIF0) != RESET) {
+        DMA_ClearITPendingBit(DMA2_Stream0, DMA_IT_HTIF0);
+        u8ReadyHalf = 0;
+        vTaskNotifyGiveFromISR(xAdcConsumer, &xWoken);
+    }
+    if (DMA_GetITStatus(DMA2_Stream0, DMA_IT_TCIF0) != RESET) {
+        DMA_ClearITPendingBit(DMA2_Stream0, DMA_IT_TCIF0);
+        u8ReadyHalf = 1;
+        vTaskNotifyGiveFromISR(xAdcConsumer, &xWoken);
+    }
+    portYIELD_FROM_ISR(xWoken);
+}
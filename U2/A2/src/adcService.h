@@ -0,0 +1,51 @@
+#ifndef ADCSERVICE_H_
+#define ADCSERVICE_H_
+/******************************************************************************/
+/** \file       adcService.h
+ *******************************************************************************
+ *
+ *  \brief      Continuous acquisition of the CARME IO2 ADC ports. TIM3 TRGO
+ *              starts a scan over ADC_CHANNELS channels of ADC1 at
+ *              ADC_SAMPLE_RATE_HZ, DMA2 stream 0 writes the results into a
+ *              circular buffer of two halves. Each half holds ADC_OVERSAMPLE
+ *              scans, the consumer task is notified when a half is full and
+ *              reads the average of every channel with xAdcRead.
+ *              CARME_IO2_Init has to be called first, it sets up the pins
+ *              and the ADC clock.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vAdcInit
+ *              xAdcRead
+ *              u32AdcGetOverruns
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <stm32f4xx.h>                  /* Processor STM32F407IG              */
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+
+//----- Macros -----------------------------------------------------------------
+#define ADC_CHANNELS          ( 3 )     /* IO2 ports scanned, PORT0 first     */
+#define ADC_OVERSAMPLE        ( 16 )    /* Scans averaged per result          */
+#define ADC_SAMPLE_RATE_HZ    ( 1000 )  /* Scans per second                   */
+#define ADC_TIMER_CLOCK_HZ    ( 1000000 ) /* TIM3 counter clock               */
+
+/* Time between two results */
+#define ADC_RESULT_MS         ( ADC_OVERSAMPLE * 1000 / ADC_SAMPLE_RATE_HZ )
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern void       vAdcInit(TaskHandle_t xConsumer);
+extern BaseType_t xAdcRead(uint16_t *pu16Values, TickType_t xTimeout);
+extern uint32_t   u32AdcGetOverruns(void);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* ADCSERVICE_H_ */
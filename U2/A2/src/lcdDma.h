@@ -0,0 +1,68 @@
+#ifndef LCDDMA_H_
+#define LCDDMA_H_
+/******************************************************************************/
+/** \file       lcdDma.h
+ *******************************************************************************
+ *
+ *  \brief      Asynchronous LCD transfers with DMA2 stream 1 in memory to
+ *              memory mode. After the CPU has opened the SSD1963 window the
+ *              DMA copies the pixels into the data register, the caller
+ *              goes on at once. Jobs are queued and started one after the
+ *              other from the transfer complete interrupt, at the end of
+ *              each job its callback is called in the interrupt.
+ *              While a job runs nothing else may access the display, use
+ *              xLcdDmaWaitIdle before drawing with sGUI.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vLcdDmaInit
+ *              xLcdDmaSubmit
+ *              xLcdDmaFillArea
+ *              xLcdDmaWriteArea
+ *              xLcdDmaWaitIdle
+ *              vLcdDmaNotifyTask
+ *              DMA2_Stream1_IRQHandler
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+
+//----- Macros -----------------------------------------------------------------
+#define LCD_DMA_QUEUE         ( 16 )    /* Jobs waiting behind the running one*/
+#define LCD_DMA_CHUNK         ( 65535 ) /* Pixels per DMA transfer, NDTR      */
+
+//----- Data types -------------------------------------------------------------
+/* Called in the interrupt at the end of a job */
+typedef void (*LcdDmaDone_t)(void *pvContext, BaseType_t *pxWoken);
+
+typedef struct {
+    uint16_t        u16X1, u16Y1;       /* Window, corners inclusive          */
+    uint16_t        u16X2, u16Y2;
+    const uint16_t *pu16Data;           /* First pixel, NULL to fill          */
+    uint16_t        u16Stride;          /* Pixels from row to row in pu16Data */
+    uint16_t        u16Color;           /* Fill colour if pu16Data is NULL    */
+    LcdDmaDone_t    pfDone;             /* NULL if not needed                 */
+    void           *pvContext;          /* Argument of pfDone                 */
+} LcdDmaJob_t;
+
+//----- Function prototypes ----------------------------------------------------
+extern void       vLcdDmaInit(void);
+extern BaseType_t xLcdDmaSubmit(const LcdDmaJob_t *psJob, TickType_t xWait);
+extern BaseType_t xLcdDmaFillArea(uint16_t u16X1, uint16_t u16Y1,
+                                  uint16_t u16X2, uint16_t u16Y2,
+                                  uint16_t u16Color, TickType_t xWait);
+extern BaseType_t xLcdDmaWriteArea(uint16_t u16X1, uint16_t u16Y1,
+                                   uint16_t u16X2, uint16_t u16Y2,
+                                   const uint16_t *pu16Data, TickType_t xWait);
+extern BaseType_t xLcdDmaWaitIdle(TickType_t xWait);
+extern void       vLcdDmaNotifyTask(void *pvContext, BaseType_t *pxWoken);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* LCDDMA_H_ */
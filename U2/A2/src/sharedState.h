@@ -0,0 +1,103 @@
+#ifndef SHAREDSTATE_H_
+#define SHAREDSTATE_H_
+/******************************************************************************/
+/** \file       sharedState.h
+ *******************************************************************************
+ *
+ *  \brief      State shared between tasks, timer callbacks and interrupts
+ *              without disabling the interrupts.
+ *              - SharedWord_t: one scalar up to 32 bit. An aligned word
+ *                store or load is atomic on the Cortex-M4, so publish and
+ *                read are plain accesses.
+ *              - SHARED_SNAP_T(type): a snapshot of several fields. The
+ *                writer updates two copies in turn and counts a sequence
+ *                number, a reader takes the copy which is not being written
+ *                and retries only if a write finished meanwhile. A reader
+ *                that interrupts the writer never waits for it.
+ *              A cell must have one writer at a time (e.g. one task, or
+ *              callbacks of the same timer task), readers are unlimited.
+ *              Build with SHARED_USE_CRITICAL=1 to get the former
+ *              taskENTER_CRITICAL protection back, e.g. to compare the
+ *              interrupt latency; tasks only in that mode.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vSharedPublish
+ *              u32SharedRead
+ *              vSharedSnapWrite
+ *              vSharedSnapRead
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <stddef.h>
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+
+//----- Macros -----------------------------------------------------------------
+#ifndef SHARED_USE_CRITICAL
+#define SHARED_USE_CRITICAL   ( 0 )     /* 1: disable interrupts as before    */
+#endif
+
+/* Snapshot of a type: sequence number and two copies */
+#define SHARED_SNAP_T(type)                                                    \
+    struct {                                                                   \
+        volatile uint32_t u32Sequence;                                         \
+        type xCopy[2];                                                         \
+    }
+
+/* Static initializer of a snapshot */
+#define SHARED_SNAP_INIT(...)   { 0, { __VA_ARGS__, __VA_ARGS__ } }
+
+/* Write or read a whole snapshot, pxData points to a variable of the type */
+#define SHARED_SNAP_WRITE(psSnap, pxData)                                      \
+    vSharedSnapWrite(&(psSnap)->u32Sequence, (psSnap)->xCopy, (pxData),        \
+                     sizeof((psSnap)->xCopy[0]))
+#define SHARED_SNAP_READ(psSnap, pxData)                                       \
+    vSharedSnapRead(&(psSnap)->u32Sequence, (psSnap)->xCopy, (pxData),         \
+                    sizeof((psSnap)->xCopy[0]))
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    volatile uint32_t u32Value;
+} SharedWord_t;
+
+//----- Function prototypes ----------------------------------------------------
+extern void vSharedSnapWrite(volatile uint32_t *pu32Sequence, void *pvCopies,
+                             const void *pvData, size_t xSize);
+extern void vSharedSnapRead(volatile uint32_t *pu32Sequence, const void *pvCopies,
+                            void *pvData, size_t xSize);
+
+//----- Implementation ---------------------------------------------------------
+/* Publish a new value, the readers see either the old or the new one */
+static inline void vSharedPublish(SharedWord_t *psCell, uint32_t u32Value) {
+#if SHARED_USE_CRITICAL
+    taskENTER_CRITICAL();
+    psCell->u32Value = u32Value;
+    taskEXIT_CRITICAL();
+#else
+    psCell->u32Value = u32Value;
+#endif
+}
+
+/* Latest published value */
+static inline uint32_t u32SharedRead(SharedWord_t *psCell) {
+#if SHARED_USE_CRITICAL
+    uint32_t u32Value;
+
+    taskENTER_CRITICAL();
+    u32Value = psCell->u32Value;
+    taskEXIT_CRITICAL();
+    return u32Value;
+#else
+    return psCell->u32Value;
+#endif
+}
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* SHAREDSTATE_H_ */
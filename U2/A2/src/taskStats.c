@@ -0,0 +1,132 @@
+/******************************************************************************/
+/** \file       taskStats.c
+ *******************************************************************************
+ *
+ *  \brief      Run time of every task. The time between two context switches
+ *              is added to the task that was running.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vTaskStatsInit
+ *              u32TaskStatsGet
+ *              __wrap_vTaskSwitchContext
+ *  functions  local:
+ *              .
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>                      /* CARME Module                       */
+
+#include "taskStats.h"
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern void __real_vTaskSwitchContext(void);
+extern void __wrap_vTaskSwitchContext(void);
+
+//----- Data -------------------------------------------------------------------
+static uint32_t u32RunTime[TASKSTATS_MAX_TASKS]; /* Counter ticks per slot    */
+static uint32_t u32SwitchedIn;          /* Counter when the task was started  */
+static UBaseType_t uxSlots;             /* Used slots                         */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vTaskStatsInit
+ ******************************************************************************/
+/** \brief        Start TIM2 at TASKSTATS_CLOCK_HZ, before the scheduler
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vTaskStatsInit(void) {
+
+    TIM_TimeBaseInitTypeDef sTimeBase;
+
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM2, ENABLE);
+
+    /* TIM2 runs at the APB1 timer clock, SystemCoreClock / 2 */
+    TIM_TimeBaseStructInit(&sTimeBase);
+    sTimeBase.TIM_Prescaler = (uint16_t) (SystemCoreClock / 2 / TASKSTATS_CLOCK_HZ - 1);
+    sTimeBase.TIM_Period = 0xFFFFFFFF;
+    TIM_TimeBaseInit(TIM2, &sTimeBase);
+    TIM_Cmd(TIM2, ENABLE);
+
+    u32SwitchedIn = u32TaskStatsNow();
+}
+
+/*******************************************************************************
+ *  function :    u32TaskStatsGet
+ ******************************************************************************/
+/** \brief        Run time of a task, including the current run if it is the
+ *                calling task. Only differences are meaningful, the counter
+ *                wraps.
+ *
+ *  \type         global
+ *
+ *  \param[in]    xTask     task handle
+ *
+ *  \return       run time in counter ticks, 0 for a task without slot
+ *
+ ******************************************************************************/
+uint32_t u32TaskStatsGet(TaskHandle_t xTask) {
+
+    UBaseType_t uxSlot = uxTaskGetTaskNumber(xTask);
+    uint32_t u32Time = 0;
+
+    if ((uxSlot == 0) || (uxSlot > TASKSTATS_MAX_TASKS)) {
+        return 0;
+    }
+
+    taskENTER_CRITICAL();
+    u32Time = u32RunTime[uxSlot - 1];
+    if (xTask == xTaskGetCurrentTaskHandle()) {
+        u32Time += u32TaskStatsNow() - u32SwitchedIn;
+    }
+    taskEXIT_CRITICAL();
+
+    return u32Time;
+}
+
+/*******************************************************************************
+ *  function :    __wrap_vTaskSwitchContext
+ ******************************************************************************/
+/** \brief        Replaces the call of vTaskSwitchContext in the port (PendSV).
+ *                Charges the time since the last switch to the outgoing task.
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void __wrap_vTaskSwitchContext(void) {
+
+    TaskHandle_t xTask = xTaskGetCurrentTaskHandle();
+    UBaseType_t uxSlot = uxTaskGetTaskNumber(xTask);
+    uint32_t u32Now = u32TaskStatsNow();
+
+    if ((uxSlot == 0) && (uxSlots < TASKSTATS_MAX_TASKS)) {
+        uxSlot = ++uxSlots;
+        vTaskSetTaskNumber(xTask, uxSlot);
+    }
+    if ((uxSlot != 0) && (uxSlot <= TASKSTATS_MAX_TASKS)) {
+        u32RunTime[uxSlot - 1] += u32Now - u32SwitchedIn;
+    }
+    u32SwitchedIn = u32Now;
+
+    __real_vTaskSwitchContext();
+}
@@ -0,0 +1,49 @@
+#ifndef TASKSTATS_H_
+#define TASKSTATS_H_
+/******************************************************************************/
+/** \file       taskStats.h
+ *******************************************************************************
+ *
+ *  \brief      Run time of every task, measured with TIM2 as free-running
+ *              32 bit counter. The kernel is a prebuilt library without
+ *              configGENERATE_RUN_TIME_STATS, so the scheduler is hooked by
+ *              linking with -Wl,--wrap=vTaskSwitchContext. Each task gets a
+ *              slot in its task number (vTaskSetTaskNumber) the first time
+ *              it is switched out.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vTaskStatsInit
+ *              u32TaskStatsNow
+ *              u32TaskStatsGet
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <stm32f4xx.h>                  /* Processor STM32F407IG              */
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+
+//----- Macros -----------------------------------------------------------------
+#define TASKSTATS_CLOCK_HZ    ( 1000000 ) /* Counter clock, wraps after 71 min*/
+#define TASKSTATS_MAX_TASKS   ( 16 )    /* Tasks with a run time counter      */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern void     vTaskStatsInit(void);
+extern uint32_t u32TaskStatsGet(TaskHandle_t xTask);
+
+//----- Implementation ---------------------------------------------------------
+/* Current value of the run time counter */
+static inline uint32_t u32TaskStatsNow(void) {
+    return TIM2->CNT;
+}
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* TASKSTATS_H_ */
@@ -6,7 +6,7 @@
 **  Abstract    : Atollic TrueSTUDIO Minimal iprintf/siprintf/fiprintf
 **                and puts/fputs.
 **                Provides aliased declarations for printf/sprintf/fprintf
-**                pointing to *iprintf variants.
+**                and snprintf/vsnprintf pointing to *iprintf variants.
 **
 **                The argument contains a format string that may include
 **                conversion specifications. Each conversion specification
@@ -14,18 +14,38 @@
 **                conversion specifier.
 **
 **                The following conversion specifiers are supported
-**                cdisuxX%
+**                cdiouxXps%
 **
 **                Usage:
 **                c    character
-**                d,i  signed integer (-sign added, + sign not supported)
-**                s    character string
+**                d,i  signed integer as decimal
+**                o    unsigned integer as octal
 **                u    unsigned integer as decimal
-**                x,X  unsigned integer as hexadecimal (uppercase letter)
+**                x,X  unsigned integer as hexadecimal (lower/upper case)
+**                p    pointer as 0x and hexadecimal
+**                s    character string, (null) for NULL
 **                %    % is written (conversion specification is '%%')
 **
+**                Between % and the specifier may follow, in this order:
+**                flags      - left justified, 0 padded with zeros,
+**                           + sign also when positive, ' ' blank when
+**                           positive, # 0x prefix (x) or leading 0 (o)
+**                width      minimum characters, digits or *
+**                precision  . and digits or *, minimum digits of an
+**                           integer or maximum characters of a string
+**                length     hh, h, l or z. l and z take long and size_t,
+**                           32 bit on the target like int. ll and
+**                           floating point are not supported.
+**
 **                Note:
-**                Character padding is not supported
+**                Decimal digits are converted two at a time with a table,
+**                hexadecimal and octal ones by shift and mask.
+**
+**                The output is formatted in one pass. printf and fprintf
+**                collect it in a chunk of TS_CHUNK characters on the stack
+**                and pass every full chunk to _write, the stack use does not
+**                depend on the length of the output. snprintf and vsnprintf
+**                write at most size - 1 characters and the terminating 0.
 **
 **  Environment : Atollic TrueSTUDIO
 **
@@ -45,179 +65,532 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#include <limits.h>
+
+/* Characters collected on the stack before they are passed to _write */
+#define TS_CHUNK 64
+
+/* Flags of a conversion specification */
+#define TS_LEFT   0x01  /* '-' left justified */
+#define TS_ZERO   0x02  /* '0' padded with zeros */
+#define TS_PLUS   0x04  /* '+' sign also when positive */
+#define TS_SPACE  0x08  /* ' ' blank when positive */
+#define TS_ALT    0x10  /* '#' 0x prefix or leading 0 */
+#define TS_UPPER  0x20  /* Upper case hexadecimal digits */
 
 /* Create aliases for *printf to integer variants *iprintf */
 __attribute__ ((alias("iprintf"))) int printf(const char *fmt, ...);
 __attribute__ ((alias("fiprintf"))) int fprintf(FILE* fp, const char *fmt, ...);
 __attribute__ ((alias("siprintf"))) int sprintf(char* str, const char *fmt, ...);
+__attribute__ ((alias("sniprintf"))) int snprintf(char* str, size_t size, const char *fmt, ...);
+__attribute__ ((alias("vsniprintf"))) int vsnprintf(char* str, size_t size, const char *fmt, va_list va);
 
 /* External function prototypes (defined in syscalls.c) */
 extern int _write(int fd, char *str, int len);
 
+/* Private types */
+typedef struct {
+    char *buf;      /* String or chunk */
+    int   size;     /* Characters buf takes, without a terminating 0 */
+    int   pos;      /* Characters in buf */
+    int   count;    /* Characters formatted */
+    int   written;  /* Characters taken by _write */
+    int   fd;       /* File of the chunk, -1 for a string */
+} ts_out;
+
 /* Private function prototypes */
-void ts_itoa(char **buf, unsigned int d, int base);
-int ts_formatstring(char *buf, const char *fmt, va_list va);
-int ts_formatlength(const char *fmt, va_list va);
+char *ts_itoa(char *end, unsigned int d, int base, int flags);
+int ts_format(ts_out *out, const char *fmt, va_list va);
+void ts_putc(ts_out *out, char c);
+void ts_write(ts_out *out, const char *str, int len);
+void ts_pad(ts_out *out, char c, int n);
+void ts_field(ts_out *out, int flags, int width, const char *prefix,
+              int zeros, const char *str, int len);
+void ts_flush(ts_out *out);
+
+/* Private data */
+static const char ts_dec[] =
+    "00010203040506070809101112131415161718192021222324"
+    "25262728293031323334353637383940414243444546474849"
+    "50515253545556575859606162636465666768697071727374"
+    "75767778798081828384858687888990919293949596979899";
 
 /* Private functions */
 
 /**
 **---------------------------------------------------------------------------
-**  Abstract: Convert integer to ascii
-**  Returns:  void
+**  Abstract: Convert integer to ascii, the digits are written backwards and
+**            end before end. Base 10 takes two digits per division, base
+**            16 and 8 shift and mask.
+**  Returns:  First digit
 **---------------------------------------------------------------------------
 */
-void ts_itoa(char **buf, unsigned int d, int base)
+char *ts_itoa(char *end, unsigned int d, int base, int flags)
 {
-    int div = 1;
-    while (d/div >= base)
-        div *= base;
+    const char *digits;
+    const char *pair;
+    unsigned int shift;
+    unsigned int q;
 
-    while (div != 0)
+    if (base == 10)
     {
-        int num = d/div;
-        d = d%div;
-        div /= base;
-        if (num > 9)
-            *((*buf)++) = (num-10) + 'A';
+        while (d >= 100)
+        {
+            q = d / 100;
+            pair = &ts_dec[(d - q * 100) * 2];
+            *--end = pair[1];
+            *--end = pair[0];
+            d = q;
+        }
+        if (d >= 10)
+        {
+            *--end = ts_dec[d * 2 + 1];
+            *--end = ts_dec[d * 2];
+        }
         else
-            *((*buf)++) = num + '0';
+        {
+            *--end = (char)('0' + d);
+        }
+    }
+    else
+    {
+        digits = (flags & TS_UPPER) ? "0123456789ABCDEF" : "0123456789abcdef";
+        shift = (base == 16) ? 4 : 3;
+        do
+        {
+            *--end = digits[d & (base - 1)];
+            d >>= shift;
+        } while (d != 0);
     }
+    return end;
 }
 
 /**
 **---------------------------------------------------------------------------
-**  Abstract: Writes arguments va to buffer buf according to format fmt
-**  Returns:  Length of string
+**  Abstract: Put one character into the string or the chunk, a full chunk
+**            is written first
+**  Returns:  void
 **---------------------------------------------------------------------------
 */
-int ts_formatstring(char *buf, const char *fmt, va_list va)
+void ts_putc(ts_out *out, char c)
 {
-    char *start_buf = buf;
-    while(*fmt)
+    if ((out->pos == out->size) && (out->fd >= 0))
+    {
+        ts_flush(out);
+    }
+    if (out->pos < out->size)
+    {
+        out->buf[out->pos++] = c;
+    }
+    ++out->count;
+}
+
+/**
+**---------------------------------------------------------------------------
+**  Abstract: Put len characters of str, copied in pieces up to the end of
+**            the string or the chunk
+**  Returns:  void
+**---------------------------------------------------------------------------
+*/
+void ts_write(ts_out *out, const char *str, int len)
+{
+    int n;
+
+    out->count += len;
+    while (len > 0)
+    {
+        if ((out->pos == out->size) && (out->fd >= 0))
+        {
+            ts_flush(out);
+        }
+        n = out->size - out->pos;
+        if (n <= 0)
+        {
+            break;
+        }
+        if (n > len)
+        {
+            n = len;
+        }
+        memcpy(&out->buf[out->pos], str, n);
+        out->pos += n;
+        str += n;
+        len -= n;
+    }
+}
+
+/**
+**---------------------------------------------------------------------------
+**  Abstract: Put n times the character c
+**  Returns:  void
+**---------------------------------------------------------------------------
+*/
+void ts_pad(ts_out *out, char c, int n)
+{
+    while (n-- > 0)
+    {
+        ts_putc(out, c);
+    }
+}
+
+/**
+**---------------------------------------------------------------------------
+**  Abstract: Put a field of at least width characters: prefix (sign, 0x),
+**            zeros, len characters of str. It is padded with blanks, or
+**            with zeros after the prefix for TS_ZERO.
+**  Returns:  void
+**---------------------------------------------------------------------------
+*/
+void ts_field(ts_out *out, int flags, int width, const char *prefix,
+              int zeros, const char *str, int len)
+{
+    int pad = width - (int)strlen(prefix) - zeros - len;
+
+    if ((flags & (TS_LEFT | TS_ZERO)) == 0)
+    {
+        ts_pad(out, ' ', pad);
+    }
+    ts_write(out, prefix, (int)strlen(prefix));
+    if ((flags & (TS_LEFT | TS_ZERO)) == TS_ZERO)
+    {
+        ts_pad(out, '0', pad);
+    }
+    ts_pad(out, '0', zeros);
+    ts_write(out, str, len);
+    if (flags & TS_LEFT)
+    {
+        ts_pad(out, ' ', pad);
+    }
+}
+
+/**
+**---------------------------------------------------------------------------
+**  Abstract: Write the characters of the chunk
+**  Returns:  void
+**---------------------------------------------------------------------------
+*/
+void ts_flush(ts_out *out)
+{
+    int len;
+    if (out->pos > 0)
+    {
+        len = _write(out->fd, out->buf, out->pos);
+        if (len > 0)
+        {
+            out->written += len;
+        }
+        out->pos = 0;
+    }
+}
+
+/**
+**---------------------------------------------------------------------------
+**  Abstract: Writes arguments va to out according to format fmt, in one
+**            pass over the format
+**  Returns:  Number of characters formatted
+**---------------------------------------------------------------------------
+*/
+int ts_format(ts_out *out, const char *fmt, va_list va)
+{
+    char num[12];       /* 32 bit integer as octal */
+    char *end = num + sizeof(num);
+    char *digits;
+    const char *prefix;
+    int flags;
+    int width;
+    int prec;
+    int size;
+    int base;
+    int zeros;
+    int len;
+    unsigned int val;
+
+    while (*fmt)
     {
         /* Character needs formating? */
         if (*fmt == '%')
         {
-            switch (*(++fmt))
+            /* Flags */
+            flags = 0;
+            for (;;)
+            {
+                ++fmt;
+                if (*fmt == '-')
+                {
+                    flags |= TS_LEFT;
+                }
+                else if (*fmt == '0')
+                {
+                    flags |= TS_ZERO;
+                }
+                else if (*fmt == '+')
+                {
+                    flags |= TS_PLUS;
+                }
+                else if (*fmt == ' ')
+                {
+                    flags |= TS_SPACE;
+                }
+                else if (*fmt == '#')
+                {
+                    flags |= TS_ALT;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            /* Width */
+            width = 0;
+            if (*fmt == '*')
+            {
+                width = va_arg(va, int);
+                if (width < 0)
+                {
+                    flags |= TS_LEFT;
+                    width = -width;
+                }
+                fmt++;
+            }
+            else
+            {
+                while ((*fmt >= '0') && (*fmt <= '9'))
+                {
+                    width = width * 10 + (*fmt++ - '0');
+                }
+            }
+            /* Precision, negative if none */
+            prec = -1;
+            if (*fmt == '.')
+            {
+                prec = 0;
+                if (*(++fmt) == '*')
+                {
+                    prec = va_arg(va, int);
+                    fmt++;
+                }
+                else
+                {
+                    while ((*fmt >= '0') && (*fmt <= '9'))
+                    {
+                        prec = prec * 10 + (*fmt++ - '0');
+                    }
+                }
+            }
+            /* Length, 'H' for hh */
+            size = 0;
+            if ((*fmt == 'h') || (*fmt == 'l') || (*fmt == 'z'))
+            {
+                size = *fmt++;
+                if ((size == 'h') && (*fmt == 'h'))
+                {
+                    size = 'H';
+                    fmt++;
+                }
+            }
+            prefix = "";
+            base = 10;
+            switch (*fmt)
             {
               case 'c':
-                *buf++ = va_arg(va, int);
+                num[0] = (char)va_arg(va, int);
+                ts_field(out, flags & TS_LEFT, width, "", 0, num, 1);
                 break;
               case 'd':
               case 'i':
+              case 'o':
+              case 'u':
+              case 'x':
+              case 'X':
+              case 'p':
+                if (*fmt == 'p')
+                {
+                    val = (unsigned int)(size_t)va_arg(va, void *);
+                }
+                else if (size == 'l')
+                {
+                    val = (unsigned int)va_arg(va, unsigned long);
+                }
+                else if (size == 'z')
+                {
+                    val = (unsigned int)va_arg(va, size_t);
+                }
+                else
+                {
+                    val = va_arg(va, unsigned int);
+                }
+                if ((*fmt == 'd') || (*fmt == 'i'))
+                {
+                    if (size == 'h')
+                    {
+                        val = (unsigned int)(short)val;
+                    }
+                    else if (size == 'H')
+                    {
+                        val = (unsigned int)(signed char)val;
+                    }
+                    if ((int)val < 0)
+                    {
+                        prefix = "-";
+                        val = 0U - val;
+                    }
+                    else if (flags & TS_PLUS)
+                    {
+                        prefix = "+";
+                    }
+                    else if (flags & TS_SPACE)
+                    {
+                        prefix = " ";
+                    }
+                }
+                else
                 {
-                    signed int val = va_arg(va, signed int);
-                    if (val < 0)
+                    if (size == 'h')
                     {
-                        val *= -1;
-                        *buf++ = '-';
+                        val = (unsigned short)val;
+                    }
+                    else if (size == 'H')
+                    {
+                        val = (unsigned char)val;
+                    }
+                    if (*fmt == 'o')
+                    {
+                        base = 8;
+                    }
+                    else if (*fmt == 'p')
+                    {
+                        base = 16;
+                        prefix = "0x";
+                    }
+                    else if (*fmt != 'u')
+                    {
+                        base = 16;
+                        if (*fmt == 'X')
+                        {
+                            flags |= TS_UPPER;
+                        }
+                        if ((flags & TS_ALT) && (val != 0))
+                        {
+                            prefix = (flags & TS_UPPER) ? "0X" : "0x";
+                        }
+                    }
+                }
+                digits = ts_itoa(end, val, base, flags);
+                len = (int)(end - digits);
+                zeros = 0;
+                if (prec >= 0)
+                {
+                    flags &= ~TS_ZERO;
+                    if ((prec == 0) && (val == 0))
+                    {
+                        len = 0;
+                    }
+                    if (prec > len)
+                    {
+                        zeros = prec - len;
                     }
-                    ts_itoa(&buf, val, 10);
                 }
+                if ((base == 8) && (flags & TS_ALT) && (zeros == 0) &&
+                        ((len == 0) || (*digits != '0')))
+                {
+                    zeros = 1;
+                }
+                ts_field(out, flags, width, prefix, zeros, digits, len);
                 break;
               case 's':
                 {
-                    char * arg = va_arg(va, char *);
-                    while (*arg)
+                    const char * arg = va_arg(va, const char *);
+                    if (arg == NULL)
+                    {
+                        arg = "(null)";
+                    }
+                    for (len = 0; (len != prec) && arg[len]; len++)
                     {
-                        *buf++ = *arg++;
                     }
+                    ts_field(out, flags & TS_LEFT, width, "", 0, arg, len);
                 }
                 break;
-              case 'u':
-                    ts_itoa(&buf, va_arg(va, unsigned int), 10);
+              case '%':
+                ts_putc(out, '%');
                 break;
-              case 'x':
-              case 'X':
-                    ts_itoa(&buf, va_arg(va, int), 16);
+              case '\0':
+                /* '%' at the end of the format */
+                --fmt;
                 break;
-              case '%':
-                  *buf++ = '%';
-                  break;
             }
             fmt++;
         }
-        /* Else just copy */
+        /* Else just copy, up to the next '%' */
         else
         {
-            *buf++ = *fmt++;
+            for (len = 1; fmt[len] && (fmt[len] != '%'); len++)
+            {
+            }
+            ts_write(out, fmt, len);
+            fmt += len;
         }
     }
-    *buf = 0;
 
-    return (int)(buf - start_buf);
+    return out->count;
 }
 
+/**
+**===========================================================================
+**  Abstract: Loads data from the given locations and writes them to the
+**            given character string according to the format parameter.
+**  Returns:  Number of bytes written
+**===========================================================================
+*/
+int siprintf(char *buf, const char *fmt, ...)
+{
+    ts_out out = { buf, INT_MAX, 0, 0, 0, -1 };
+    va_list va;
+    va_start(va, fmt);
+    ts_format(&out, fmt, va);
+    va_end(va);
+    buf[out.pos] = 0;
+    return out.count;
+}
 
 /**
-**---------------------------------------------------------------------------
-**  Abstract: Calculate maximum length of the resulting string from the
-**            format string and va_list va
-**  Returns:  Maximum length
-**---------------------------------------------------------------------------
+**===========================================================================
+**  Abstract: Writes at most size - 1 characters according to the format
+**            parameter and the terminating 0 to the character string.
+**  Returns:  Number of bytes the whole output has, without the 0
+**===========================================================================
 */
-int ts_formatlength(const char *fmt, va_list va)
+int vsniprintf(char *buf, size_t size, const char *fmt, va_list va)
 {
-    int length = 0;
-    while (*fmt)
+    ts_out out = { buf, 0, 0, 0, 0, -1 };
+    if (size > (size_t)INT_MAX)
     {
-        if (*fmt == '%')
-        {
-            ++fmt;
-            switch (*fmt)
-            {
-              case 'c':
-                  va_arg(va, int);
-                  ++length;
-                  break;
-              case 'd':
-              case 'i':
-              case 'u':
-                  /* 32 bits integer is max 11 characters with minus sign */
-                  length += 11;
-                  va_arg(va, int);
-                  break;
-              case 's':
-                  {
-                      char * str = va_arg(va, char *);
-                      while (*str++)
-                          ++length;
-                  }
-                  break;
-              case 'x':
-              case 'X':
-                  /* 32 bits integer as hex is max 8 characters */
-                  length += 8;
-                  va_arg(va, unsigned int);
-                  break;
-              default:
-                  ++length;
-                  break;
-            }
-        }
-        else
-        {
-            ++length;
-        }
-        ++fmt;
+        out.size = INT_MAX;
     }
-    return length;
+    else if (size > 0)
+    {
+        out.size = (int)size - 1;
+    }
+    ts_format(&out, fmt, va);
+    if (size > 0)
+    {
+        buf[out.pos] = 0;
+    }
+    return out.count;
 }
 
 /**
 **===========================================================================
-**  Abstract: Loads data from the given locations and writes them to the
-**            given character string according to the format parameter.
-**  Returns:  Number of bytes written
+**  Abstract: Writes at most size - 1 characters according to the format
+**            parameter and the terminating 0 to the character string.
+**  Returns:  Number of bytes the whole output has, without the 0
 **===========================================================================
 */
-int siprintf(char *buf, const char *fmt, ...)
+int sniprintf(char *buf, size_t size, const char *fmt, ...)
 {
     int length;
     va_list va;
     va_start(va, fmt);
-    length = ts_formatstring(buf, fmt, va);
+    length = vsniprintf(buf, size, fmt, va);
     va_end(va);
     return length;
 }
@@ -231,19 +604,14 @@ int siprintf(char *buf, const char *fmt, ...)
 */
 int fiprintf(FILE * stream, const char *fmt, ...)
 {
-    int length = 0;
+    char chunk[TS_CHUNK];
+    ts_out out = { chunk, TS_CHUNK, 0, 0, 0, stream->_file };
     va_list va;
     va_start(va, fmt);
-    length = ts_formatlength(fmt, va);
+    ts_format(&out, fmt, va);
     va_end(va);
-    {
-        char buf[length];
-        va_start(va, fmt);
-        length = ts_formatstring(buf, fmt, va);
-        length = _write(stream->_file, buf, length);
-        va_end(va);
-    }
-    return length;
+    ts_flush(&out);
+    return out.written;
 }
 
 /**
@@ -256,19 +624,14 @@ int fiprintf(FILE * stream, const char *fmt, ...)
 */
 int iprintf(const char *fmt, ...)
 {
-    int length = 0;
+    char chunk[TS_CHUNK];
+    ts_out out = { chunk, TS_CHUNK, 0, 0, 0, 1 };
     va_list va;
     va_start(va, fmt);
-    length = ts_formatlength(fmt, va);
+    ts_format(&out, fmt, va);
     va_end(va);
-    {
-        char buf[length];
-        va_start(va, fmt);
-        length = ts_formatstring(buf, fmt, va);
-        length = _write(1, buf, length);
-        va_end(va);
-    }
-    return length;
+    ts_flush(&out);
+    return out.written;
 }
 
 /**
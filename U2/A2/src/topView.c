@@ -0,0 +1,348 @@
+/******************************************************************************/
+/** \file       topView.c
+ *******************************************************************************
+ *
+ *  \brief      "top" like LCD view of all tasks. The tasks are listed in the
+ *              order of creation, so rows do not move between updates.
+ *
+ *              Task      S P    CPU% Stack
+ *              Task1     B 1    0.4%   804
+ *
+ *              S: X running, R ready, B blocked, S suspended, D deleted,
+ *              Stack: free stack in bytes (high water mark)
+ *
+ *              With more tasks than rows, or than TASKSTATS_MAX_TASKS, the
+ *              last row shown tells how many tasks are not listed.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Drawn into the frame buffer
+ *               \li id101010, 17.10.2026, Row for the tasks not listed
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vTopInit
+ *              vTopUpdate
+ *  functions  local:
+ *              vTopSort
+ *              pcTopText
+ *              pcTopNumber
+ *              vTopRow
+ *              vTopMore
+ *              vTopShow
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <lcd.h>
+#include <string.h>                     /* String handling                    */
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+
+#include "taskStats.h"
+#include "topView.h"
+#include "frameBuffer.h"
+
+//----- Macros -----------------------------------------------------------------
+#define TOP_LINE_SUMMARY      ( 0 )     /* Number of tasks and free heap      */
+#define TOP_LINE_TITLE        ( 1 )
+#define TOP_LINE_RULE         ( 2 )
+#define TOP_LINE_TASKS        ( 3 )     /* First task row                     */
+#define TOP_LINES             ( TOP_LINE_TASKS + TOP_MAX_ROWS )
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static void  vTopSort(UBaseType_t uxTasks);
+static char *pcTopText(char *pcDst, const char *pcText, uint8_t u8Width);
+static char *pcTopNumber(char *pcDst, uint32_t u32Value, uint8_t u8Width);
+static void  vTopRow(char *pcRow, const TaskStatus_t *psTask, uint32_t u32Elapsed);
+static void  vTopMore(char *pcRow, UBaseType_t uxMore);
+static void  vTopShow(uint8_t u8Line, const char *pcText);
+
+//----- Data -------------------------------------------------------------------
+static const char *pcTitle = "Task      S P    CPU% Stack";
+static const char *pcRule  = "---------------------------";
+static const char  cState[] = { 'X', 'R', 'B', 'S', 'D' }; /* eTaskState    */
+
+static TaskStatus_t sTasks[TASKSTATS_MAX_TASKS];
+static uint32_t u32LastRun[TASKSTATS_MAX_TASKS + 1]; /* Run time by slot      */
+static uint32_t u32LastNow;             /* Run time counter of the last update*/
+static char     cShown[TOP_LINES][TOP_COLUMNS + 1]; /* Text on the display    */
+static uint16_t u16TopX;
+static uint16_t u16TopY;
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vTopInit
+ ******************************************************************************/
+/** \brief        Place the view and draw the title. The area must be clear.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16X      pixel x-pos of the view
+ *  \param[in]    u16Y      pixel y-pos of the view
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vTopInit(uint16_t u16X, uint16_t u16Y) {
+
+    char cLine[TOP_COLUMNS + 1];
+    uint8_t u8Line;
+
+    u16TopX = u16X;
+    u16TopY = u16Y;
+    for (u8Line = 0; u8Line < TOP_LINES; u8Line++) {
+        memset(cShown[u8Line], ' ', TOP_COLUMNS);
+        cShown[u8Line][TOP_COLUMNS] = '\0';
+    }
+
+    *pcTopText(cLine, pcTitle, TOP_COLUMNS) = '\0';
+    vTopShow(TOP_LINE_TITLE, cLine);
+    *pcTopText(cLine, pcRule, TOP_COLUMNS) = '\0';
+    vTopShow(TOP_LINE_RULE, cLine);
+    u32LastNow = u32TaskStatsNow();
+}
+
+/*******************************************************************************
+ *  function :    vTopUpdate
+ ******************************************************************************/
+/** \brief        Read the state of all tasks and update the view. If they
+ *                do not all fit, the last row shows how many are missing.
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vTopUpdate(void) {
+
+    char cLine[TOP_COLUMNS + 1];
+    char *pcEnd;
+    UBaseType_t uxTotal = uxTaskGetNumberOfTasks();
+    UBaseType_t uxTasks = 0;
+    UBaseType_t uxRows;
+    UBaseType_t uxTask;
+    uint32_t u32Now = u32TaskStatsNow();
+    uint32_t u32Elapsed = u32Now - u32LastNow;
+
+    u32LastNow = u32Now;
+    /* uxTaskGetSystemState fills nothing if sTasks is too small */
+    if (uxTotal <= TASKSTATS_MAX_TASKS) {
+        uxTasks = uxTaskGetSystemState(sTasks, TASKSTATS_MAX_TASKS, NULL);
+        vTopSort(uxTasks);
+    }
+    uxRows = uxTasks;
+    if ((uxTasks < uxTotal) || (uxTasks > TOP_MAX_ROWS)) {
+        uxRows = (uxTasks < TOP_MAX_ROWS) ? uxTasks : TOP_MAX_ROWS - 1;
+    }
+
+    pcEnd = pcTopText(cLine, "Tasks:", 6);
+    pcEnd = pcTopNumber(pcEnd, uxTotal, 3);
+    pcEnd = pcTopText(pcEnd, "  Free heap:", 12);
+    pcEnd = pcTopNumber(pcEnd, xPortGetFreeHeapSize(), 6);
+    *pcTopText(pcEnd, "", (uint8_t) (TOP_COLUMNS - (pcEnd - cLine))) = '\0';
+    vTopShow(TOP_LINE_SUMMARY, cLine);
+
+    for (uxTask = 0; uxTask < TOP_MAX_ROWS; uxTask++) {
+        if (uxTask < uxRows) {
+            vTopRow(cLine, &sTasks[uxTask], u32Elapsed);
+        } else if ((uxTask == uxRows) && (uxRows < uxTotal)) {
+            vTopMore(cLine, uxTotal - uxRows);
+        } else {
+            *pcTopText(cLine, "", TOP_COLUMNS) = '\0';
+        }
+        vTopShow((uint8_t) (TOP_LINE_TASKS + uxTask), cLine);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vTopSort
+ ******************************************************************************/
+/** \brief        Sort the task list by task number (order of creation)
+ *
+ *  \type         local
+ *
+ *  \param[in]    uxTasks   number of entries in sTasks
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vTopSort(UBaseType_t uxTasks) {
+
+    TaskStatus_t sTask;
+    UBaseType_t uxI, uxJ;
+
+    for (uxI = 1; uxI < uxTasks; uxI++) {
+        sTask = sTasks[uxI];
+        for (uxJ = uxI; (uxJ > 0) &&
+                (sTasks[uxJ - 1].xTaskNumber > sTask.xTaskNumber); uxJ--) {
+            sTasks[uxJ] = sTasks[uxJ - 1];
+        }
+        sTasks[uxJ] = sTask;
+    }
+}
+
+/*******************************************************************************
+ *  function :    pcTopText
+ ******************************************************************************/
+/** \brief        Copy a text left aligned into a field, padded with blanks
+ *
+ *  \type         local
+ *
+ *  \param[out]   pcDst     field
+ *  \param[in]    pcText    text, cut at u8Width
+ *  \param[in]    u8Width   width of the field
+ *
+ *  \return       end of the field
+ *
+ ******************************************************************************/
+static char *pcTopText(char *pcDst, const char *pcText, uint8_t u8Width) {
+
+    while (u8Width-- > 0) {
+        *pcDst++ = (*pcText != '\0') ? *pcText++ : ' ';
+    }
+    return pcDst;
+}
+
+/*******************************************************************************
+ *  function :    pcTopNumber
+ ******************************************************************************/
+/** \brief        Write a number right aligned into a field
+ *
+ *  \type         local
+ *
+ *  \param[out]   pcDst     field
+ *  \param[in]    u32Value  number, the high digits are cut at u8Width
+ *  \param[in]    u8Width   width of the field
+ *
+ *  \return       end of the field
+ *
+ ******************************************************************************/
+static char *pcTopNumber(char *pcDst, uint32_t u32Value, uint8_t u8Width) {
+
+    char *pcEnd = pcDst + u8Width;
+    char *pcDigit = pcEnd;
+
+    do {
+        *--pcDigit = (char) ('0' + u32Value % 10);
+        u32Value /= 10;
+    } while ((u32Value != 0) && (pcDigit > pcDst));
+
+    while (pcDigit > pcDst) {
+        *--pcDigit = ' ';
+    }
+    return pcEnd;
+}
+
+/*******************************************************************************
+ *  function :    vTopRow
+ ******************************************************************************/
+/** \brief        Format the line of a task
+ *
+ *  \type         local
+ *
+ *  \param[out]   pcRow       TOP_COLUMNS characters and terminator
+ *  \param[in]    psTask      task state
+ *  \param[in]    u32Elapsed  run time counter ticks since the last update
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vTopRow(char *pcRow, const TaskStatus_t *psTask, uint32_t u32Elapsed) {
+
+    UBaseType_t uxSlot = uxTaskGetTaskNumber(psTask->xHandle);
+    uint32_t u32Run = u32TaskStatsGet(psTask->xHandle);
+    uint32_t u32Permille = 0;
+    char *pcEnd;
+
+    if ((uxSlot != 0) && (uxSlot <= TASKSTATS_MAX_TASKS)) {
+        if (u32Elapsed != 0) {
+            u32Permille = (uint32_t) (((uint64_t) (u32Run - u32LastRun[uxSlot]) * 1000) /
+                                      u32Elapsed);
+        }
+        u32LastRun[uxSlot] = u32Run;
+    }
+
+    pcEnd = pcTopText(pcRow, psTask->pcTaskName, configMAX_TASK_NAME_LEN);
+    *pcEnd++ = (psTask->eCurrentState < sizeof(cState)) ?
+               cState[psTask->eCurrentState] : '?';
+    *pcEnd++ = ' ';
+    pcEnd = pcTopNumber(pcEnd, psTask->uxCurrentPriority, 1);
+    pcEnd = pcTopNumber(pcEnd, u32Permille / 10, 5);
+    *pcEnd++ = '.';
+    pcEnd = pcTopNumber(pcEnd, u32Permille % 10, 1);
+    *pcEnd++ = '%';
+    pcEnd = pcTopNumber(pcEnd, (uint32_t) psTask->usStackHighWaterMark *
+                        sizeof(StackType_t), 6);
+    *pcTopText(pcEnd, "", (uint8_t) (TOP_COLUMNS - (pcEnd - pcRow))) = '\0';
+}
+
+/*******************************************************************************
+ *  function :    vTopMore
+ ******************************************************************************/
+/** \brief        Format the line of the tasks which are not listed
+ *
+ *  \type         local
+ *
+ *  \param[out]   pcRow       TOP_COLUMNS characters and terminator
+ *  \param[in]    uxMore      number of tasks not listed
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vTopMore(char *pcRow, UBaseType_t uxMore) {
+
+    char *pcEnd;
+
+    pcEnd = pcTopText(pcRow, "...", 4);
+    pcEnd = pcTopNumber(pcEnd, uxMore, 3);
+    pcEnd = pcTopText(pcEnd, " tasks not listed", 17);
+    *pcTopText(pcEnd, "", (uint8_t) (TOP_COLUMNS - (pcEnd - pcRow))) = '\0';
+}
+
+/*******************************************************************************
+ *  function :    vTopShow
+ ******************************************************************************/
+/** \brief        Draw the characters of a line which differ from the frame
+ *                buffer
+ *
+ *  \type         local
+ *
+ *  \param[in]    u8Line    line of the view
+ *  \param[in]    pcText    TOP_COLUMNS characters
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vTopShow(uint8_t u8Line, const char *pcText) {
+
+    char cSpan[TOP_COLUMNS + 1];
+    char *pcShown = cShown[u8Line];
+    uint8_t u8First = 0;
+    uint8_t u8Last = TOP_COLUMNS;
+
+    while ((u8First < TOP_COLUMNS) && (pcShown[u8First] == pcText[u8First])) {
+        u8First++;
+    }
+    if (u8First == TOP_COLUMNS) {
+        return;                         /* Nothing changed */
+    }
+    while (pcShown[u8Last - 1] == pcText[u8Last - 1]) {
+        u8Last--;
+    }
+
+    memcpy(cSpan, &pcText[u8First], u8Last - u8First);
+    cSpan[u8Last - u8First] = '\0';
+    memcpy(&pcShown[u8First], cSpan, u8Last - u8First);
+    vFbDisplayStringXY(u16TopX + u8First * TOP_FONT_WIDTH,
+                       u16TopY + u8Line * TOP_LINE_HEIGHT, cSpan);
+}
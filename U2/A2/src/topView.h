@@ -0,0 +1,41 @@
+#ifndef TOPVIEW_H_
+#define TOPVIEW_H_
+/******************************************************************************/
+/** \file       topView.h
+ *******************************************************************************
+ *
+ *  \brief      "top" like LCD view of all tasks, including the idle and the
+ *              timer service task: state, priority, CPU load since the last
+ *              update and free stack. Only the characters which changed
+ *              since the last update are drawn into the frame buffer, the
+ *              caller sends them with vFbFlush.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vTopInit
+ *              vTopUpdate
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+//----- Macros -----------------------------------------------------------------
+#define TOP_REFRESH_MS        ( 500 )   /* Update period of the view          */
+#define TOP_MAX_ROWS          ( 10 )    /* Tasks shown                        */
+#define TOP_COLUMNS           ( 30 )    /* Characters per line                */
+#define TOP_FONT_WIDTH        ( 8 )     /* font_8x13, set by the caller       */
+#define TOP_LINE_HEIGHT       ( 15 )    /* pixel per line                     */
+#define TOP_HEIGHT            ( (TOP_MAX_ROWS + 3) * TOP_LINE_HEIGHT )
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern void  vTopInit(uint16_t u16X, uint16_t u16Y);
+extern void  vTopUpdate(void);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* TOPVIEW_H_ */
@@ -16,6 +16,8 @@
  *               \li wht4, 24.01.2014, Adapted to CARME-M4
  *               \li wht4, 06.01.2015, Migrated to FreeRTOS V8.0.0
  *               \li WBR1, 21.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Lock-free kit state, IRQ latency
+ *               \li id101010, 17.10.2026, Button events by interrupt
  *
  ******************************************************************************/
 /*
@@ -25,7 +27,6 @@
  *              vCreateTasks
  *              vCreateTimers
  *              SwitchCallback
- *              ButtonCallback
  *              LedCallback
  *
  ******************************************************************************/
@@ -43,6 +44,9 @@
 #include <memPoolService.h>
 
 #include "lcdTask.h"
+#include "irqLatency.h"
+#include "sharedState.h"
+#include "buttonService.h"
 
 //----- Macros -----------------------------------------------------------------
 #define PRIORITY_LCDTASK       ( 3 )      /* Priority of LCD Task             */
@@ -55,10 +59,11 @@
 static void vCreateTasks(void);
 static void vCreateTimers(void);
 static void SwitchCallback(xTimerHandle pxTimer);
-static void ButtonCallback(xTimerHandle pxTimer);
 static void LedCallback(xTimerHandle pxTimer);
 
 //----- Data -------------------------------------------------------------------
+static KitState_t sKitLatest;           /* Timer task only, published copy    */
+static TaskHandle_t xLcdTask;           /* Subscriber of the button events    */
 
 //----- Implementation ---------------------------------------------------------
 
@@ -81,8 +86,14 @@ int  main(void) {
     CARME_IO2_Init();
     CARME_IO1_LED_Set(0x00, 0xff);
 
+    /* Worst-case interrupt latency, shown by the LCD task */
+    vLatencyInit();
+
     vCreateTasks();
     vCreateTimers();
+
+    /* Button edges are sent to the LCD task, no polling */
+    vButtonInit(xLcdTask);
     vTaskStartScheduler();
 
     /* code never reached */
@@ -108,7 +119,7 @@ static void vCreateTasks(void)  {
                 STACKSIZE_LCDTASK,
                 NULL,
                 PRIORITY_LCDTASK,
-                NULL);
+                &xLcdTask);
 }
 
 /*******************************************************************************
@@ -135,16 +146,6 @@ static void vCreateTimers(void)  {
         xTimerStart(timerHandle, 0);
     }
 
-    /* Create and start timer for button state */
-    timerHandle = xTimerCreate("Button Timer",
-                               50 / portTICK_RATE_MS,
-                               pdTRUE,
-                               NULL,
-                               ButtonCallback);
-    if(timerHandle != NULL) {
-        xTimerStart(timerHandle, 0);
-    }
-
     /* Create and start timer for led chaser light */
     timerHandle = xTimerCreate("LED Timer",
                                400 / portTICK_RATE_MS,
@@ -160,8 +161,8 @@ static void vCreateTimers(void)  {
 /*******************************************************************************
  *  function :    SwitchCallback
  ******************************************************************************/
-/** \brief        Reads periodically switch state and stores them in global
- *                variable u8SwitchState. Called by software timer!
+/** \brief        Reads periodically switch state and publishes it in the
+ *                global snapshot sKitState. Called by software timer!
  *
  *  \type         local
  *
@@ -174,45 +175,19 @@ static void SwitchCallback(xTimerHandle pxTimer) {
     uint8_t switchState;
 
     CARME_IO1_SWITCH_Get(&switchState);
-    /* copy switchState global variable u8SwitchState, this is an access to a
-	 * critical section, so disable interrupts while reading the variable
-	 */
-	taskENTER_CRITICAL();	/* disable interrupts */
-	u8SwitchState = switchState; /* access critical section */
-	taskEXIT_CRITICAL();	/* enable interrupts again */
-}
-
-
-/*******************************************************************************
- *  function :    ButtonCallback
- ******************************************************************************/
-/** \brief        Reads button state and stores them in global variable
- *                u8ButtonState. Called by software timer!
- *
- *  \type         local
- *
- *  \param[in]    unused
- *
- *  \return       error code
- *
- ******************************************************************************/
-static void ButtonCallback(xTimerHandle pxTimer) {
-    uint8_t buttonState;
-
-    CARME_IO1_BUTTON_Get(&buttonState);
-    /* copy buttonState to global variable u8ButtonState, this is an access to a
-	 * critical section, so disable interrupts while writing to the variable
+    /* publish switch and LED state together, both callbacks run in the
+	 * timer task, so there is only one writer
 	 */
-	taskENTER_CRITICAL();	/* disable interrupts */
-	u8ButtonState = buttonState; /* access critical section */
-	taskEXIT_CRITICAL();	/* enable interrupts again */
+	sKitLatest.u8Switch = switchState;
+	SHARED_SNAP_WRITE(&sKitState, &sKitLatest);
 }
 
 
 /*******************************************************************************
  *  function :    LedCallback
  ******************************************************************************/
-/** \brief        Implements a LED chaser. Called by software timer!
+/** \brief        Implements a LED chaser and publishes the LEDs in the
+ *                global snapshot sKitState. Called by software timer!
  *
  *  \type         local
  *
@@ -230,6 +205,9 @@ static void LedCallback(xTimerHandle pxTimer) {
     }
     u8Led <<= 1;
     CARME_IO1_LED_Set(u8Led, 0xff);
+
+    sKitLatest.u8Led = u8Led;
+    SHARED_SNAP_WRITE(&sKitState, &sKitLatest);
 }
 
 
@@ -0,0 +1,261 @@
+/******************************************************************************/
+/** \file       buttonService.c
+ *******************************************************************************
+ *
+ *  \brief      Button events from the EXTI interrupts of the CARME IO1
+ *              buttons, debounced with a one-shot software timer.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vButtonInit
+ *              xButtonGetEvent
+ *              u8ButtonGetState
+ *              u32ButtonGetLost
+ *              vButtonIrqHandler
+ *  functions  local:
+ *              vButtonDebounced
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>                      /* CARME Module                       */
+#include <carme_io1.h>                  /* CARMEIO1 Board Support Package     */
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+#include <queue.h>
+#include <timers.h>
+
+#include "buttonService.h"
+
+//----- Macros -----------------------------------------------------------------
+/* EXTI lines of the buttons: T0 PC7, T1 PB15, T2 PB14, T3 PI0 */
+#define BUTTON_LINES    ( EXTI_Line7 | EXTI_Line15 | EXTI_Line14 | EXTI_Line0 )
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static void vButtonDebounced(TimerHandle_t xTimer);
+
+//----- Data -------------------------------------------------------------------
+static const uint32_t u32ButtonLine[BUTTON_COUNT] = {
+    EXTI_Line7, EXTI_Line15, EXTI_Line14, EXTI_Line0
+};
+
+static QueueHandle_t xEventQueue;       /* ButtonEvent_t to the subscriber    */
+static TimerHandle_t xDebounceTimer;    /* Unmasks the lines again            */
+static TaskHandle_t  xButtonSubscriber; /* Notified on every event            */
+
+/* Last reported state of every button. Written by the interrupt handler while
+ * the line of the button is unmasked, by the timer callback while it is
+ * masked, so there is one writer at a time. */
+static volatile uint8_t  u8Level[BUTTON_COUNT];
+
+static volatile uint32_t u32LostIrq;    /* Queue full in the handler          */
+static volatile uint32_t u32LostTimer;  /* Queue full in the timer callback   */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vButtonInit
+ ******************************************************************************/
+/** \brief        Create the event queue and the debounce timer, enable the
+ *                button interrupts. Call before the scheduler is started.
+ *
+ *  \type         global
+ *
+ *  \param[in]    xSubscriber   task notified on button events
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vButtonInit(TaskHandle_t xSubscriber) {
+
+    uint8_t u8State;
+    uint8_t u8Button;
+
+    xButtonSubscriber = xSubscriber;
+    xEventQueue = xQueueCreate(BUTTON_QUEUE_LENGTH, sizeof(ButtonEvent_t));
+    vQueueAddToRegistry(xEventQueue, "ButtonQueue");
+    xDebounceTimer = xTimerCreate("Debounce",
+                                  BUTTON_DEBOUNCE_MS / portTICK_RATE_MS,
+                                  pdFALSE,
+                                  NULL,
+                                  vButtonDebounced);
+
+    /* No events for buttons held at start-up */
+    CARME_IO1_BUTTON_Get(&u8State);
+    for (u8Button = 0; u8Button < BUTTON_COUNT; u8Button++) {
+        u8Level[u8Button] = (u8State >> u8Button) & 0x01;
+    }
+
+    /* Both edges at the lowest priority, the handler uses the FromISR API */
+    CARME_IO1_BUTTON_Interrupt(ENABLE);
+}
+
+/*******************************************************************************
+ *  function :    xButtonGetEvent
+ ******************************************************************************/
+/** \brief        Take the oldest button event
+ *
+ *  \type         global
+ *
+ *  \param[out]   psEvent   event
+ *  \param[in]    xTimeout  ticks to wait for an event
+ *
+ *  \return       pdTRUE if an event was taken
+ *
+ ******************************************************************************/
+BaseType_t xButtonGetEvent(ButtonEvent_t *psEvent, TickType_t xTimeout) {
+
+    return xQueueReceive(xEventQueue, psEvent, xTimeout);
+}
+
+/*******************************************************************************
+ *  function :    u8ButtonGetState
+ ******************************************************************************/
+/** \brief        Debounced state of the buttons, as reported by the events
+ *
+ *  \type         global
+ *
+ *  \return       button bits like CARME_IO1_BUTTON_Get
+ *
+ ******************************************************************************/
+uint8_t u8ButtonGetState(void) {
+
+    uint8_t u8State = 0;
+    uint8_t u8Button;
+
+    for (u8Button = 0; u8Button < BUTTON_COUNT; u8Button++) {
+        u8State |= (uint8_t) (u8Level[u8Button] << u8Button);
+    }
+    return u8State;
+}
+
+/*******************************************************************************
+ *  function :    u32ButtonGetLost
+ ******************************************************************************/
+/** \brief        Number of events dropped because the queue was full
+ *
+ *  \type         global
+ *
+ *  \return       lost events since start
+ *
+ ******************************************************************************/
+uint32_t u32ButtonGetLost(void) {
+
+    return u32LostIrq + u32LostTimer;
+}
+
+/*******************************************************************************
+ *  function :    vButtonIrqHandler
+ ******************************************************************************/
+/** \brief        EXTI interrupt of the buttons. Queues the edges of the
+ *                pending buttons, notifies the subscriber and masks the
+ *                lines until the debounce timer expires.
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vButtonIrqHandler(void) {
+
+    BaseType_t xWoken = pdFALSE;
+    uint32_t u32Pending = EXTI->PR & EXTI->IMR & BUTTON_LINES;
+    uint32_t u32Notify = 0;
+    ButtonEvent_t sEvent;
+    uint8_t u8State;
+    uint8_t u8Button;
+
+    if (u32Pending == 0) {
+        return;
+    }
+
+    /* Ignore the bounces until the timer expires */
+    EXTI->IMR &= ~u32Pending;
+    EXTI_ClearITPendingBit(u32Pending);
+
+    CARME_IO1_BUTTON_Get(&u8State);
+    sEvent.xTick = xTaskGetTickCountFromISR();
+    for (u8Button = 0; u8Button < BUTTON_COUNT; u8Button++) {
+        sEvent.u8Edge = (u8State >> u8Button) & 0x01;
+        if (((u32Pending & u32ButtonLine[u8Button]) == 0) ||
+                (sEvent.u8Edge == u8Level[u8Button])) {
+            continue;
+        }
+        u8Level[u8Button] = sEvent.u8Edge;
+        sEvent.u8Button = u8Button;
+        if (xQueueSendFromISR(xEventQueue, &sEvent, &xWoken) != pdTRUE) {
+            u32LostIrq++;
+        }
+        u32Notify |= BUTTON_NOTIFY_BIT(u8Button);
+    }
+
+    if (xTimerResetFromISR(xDebounceTimer, &xWoken) != pdPASS) {
+        /* Timer queue full: rather no debouncing than a dead button */
+        EXTI->IMR |= u32Pending;
+    }
+    if ((u32Notify != 0) && (xButtonSubscriber != NULL)) {
+        xTaskNotifyFromISR(xButtonSubscriber, u32Notify, eSetBits, &xWoken);
+    }
+    portYIELD_FROM_ISR(xWoken);
+}
+
+/*******************************************************************************
+ *  function :    vButtonDebounced
+ ******************************************************************************/
+/** \brief        The buttons have settled. Queues the edges the bounces hid
+ *                and unmasks the lines. Called by software timer!
+ *
+ *  \type         local
+ *
+ *  \param[in]    xTimer    unused
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vButtonDebounced(TimerHandle_t xTimer) {
+
+    uint32_t u32Masked = BUTTON_LINES & ~EXTI->IMR;
+    uint32_t u32Notify = 0;
+    ButtonEvent_t sEvent;
+    uint8_t u8State;
+    uint8_t u8Button;
+
+    /* Edges from now on are pending and interrupt as soon as unmasked */
+    EXTI_ClearITPendingBit(u32Masked);
+
+    CARME_IO1_BUTTON_Get(&u8State);
+    sEvent.xTick = xTaskGetTickCount();
+    for (u8Button = 0; u8Button < BUTTON_COUNT; u8Button++) {
+        sEvent.u8Edge = (u8State >> u8Button) & 0x01;
+        if (((u32Masked & u32ButtonLine[u8Button]) == 0) ||
+                (sEvent.u8Edge == u8Level[u8Button])) {
+            continue;
+        }
+        u8Level[u8Button] = sEvent.u8Edge;
+        sEvent.u8Button = u8Button;
+        if (xQueueSend(xEventQueue, &sEvent, 0) != pdTRUE) {
+            u32LostTimer++;
+        }
+        u32Notify |= BUTTON_NOTIFY_BIT(u8Button);
+    }
+
+    /* The handler masks other lines meanwhile */
+    taskENTER_CRITICAL();
+    EXTI->IMR |= u32Masked;
+    taskEXIT_CRITICAL();
+
+    if ((u32Notify != 0) && (xButtonSubscriber != NULL)) {
+        xTaskNotify(xButtonSubscriber, u32Notify, eSetBits);
+    }
+}
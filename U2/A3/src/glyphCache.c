@@ -0,0 +1,385 @@
+/******************************************************************************/
+/** \file       glyphCache.c
+ *******************************************************************************
+ *
+ *  \brief      Glyph cache and whole-string windows. The glyphs are expanded
+ *              like LCD_DisplayCharXY does: one word per column of datasize
+ *              bytes, bit height-1 is the top row. The entries are found
+ *              through a hash table and kept in a list from the newest to
+ *              the oldest use, the oldest one is replaced when all slots
+ *              are taken.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vGcInit
+ *              vGcSetTextColor
+ *              vGcSetBackColor
+ *              vGcDisplayStringXY
+ *              vGcGetStats
+ *  functions  local:
+ *              pu16GcLookup
+ *              vGcExpand
+ *              vGcUnlink
+ *              vGcPushNewest
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <string.h>                     /* String handling                    */
+
+#include "glyphCache.h"
+
+//----- Macros -----------------------------------------------------------------
+#define GC_NONE               ( 0xFF )  /* End of a list                      */
+#define GC_BUCKETS            ( 64 )    /* Hash table size, power of two      */
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    const FONT_T *psFont;               /* Key                                */
+    LCDCOLOR      Text;
+    LCDCOLOR      Back;
+    char          cChar;
+    uint8_t       u8Newer;              /* Use list                           */
+    uint8_t       u8Older;
+    uint8_t       u8Hash;               /* Bucket of the entry                */
+    uint8_t       u8Chain;              /* Next entry of the same bucket      */
+} GcEntry_t;
+
+//----- Function prototypes ----------------------------------------------------
+static const uint16_t *pu16GcLookup(char cChar, const FONT_T *psFont);
+static void vGcExpand(char cChar, const FONT_T *psFont,
+                      uint16_t *pu16Dst, uint16_t u16Stride);
+static void vGcUnlink(uint8_t u8Slot);
+static void vGcPushNewest(uint8_t u8Slot);
+
+//----- Data -------------------------------------------------------------------
+static GcEntry_t sEntries[GC_SLOTS];
+static uint16_t  u16Glyphs[GC_SLOTS][GC_GLYPH_PIXELS];
+static uint16_t  u16Stage[GC_STAGE_PIXELS]; /* Window of the current string   */
+static uint8_t   u8Bucket[GC_BUCKETS];  /* First entry of each bucket         */
+static uint8_t   u8Newest = GC_NONE;
+static uint8_t   u8Oldest = GC_NONE;
+static uint8_t   u8Used;                /* Slots taken so far                 */
+static LCDCOLOR  TextColor = GUI_COLOR_WHITE;
+static LCDCOLOR  BackColor = GUI_COLOR_BLACK;
+static GcStats_t sStats;
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vGcInit
+ ******************************************************************************/
+/** \brief        Empty the cache and clear the statistics
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vGcInit(void) {
+
+    memset(u8Bucket, GC_NONE, sizeof(u8Bucket));
+    u8Newest = GC_NONE;
+    u8Oldest = GC_NONE;
+    u8Used = 0;
+    memset(&sStats, 0, sizeof(sStats));
+}
+
+/*******************************************************************************
+ *  function :    vGcSetTextColor
+ ******************************************************************************/
+/** \brief        Text colour of the following strings
+ *
+ *  \type         global
+ *
+ *  \param[in]    Color     RGB565 colour
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vGcSetTextColor(LCDCOLOR Color) {
+
+    TextColor = Color;
+}
+
+/*******************************************************************************
+ *  function :    vGcSetBackColor
+ ******************************************************************************/
+/** \brief        Back colour of the following strings
+ *
+ *  \type         global
+ *
+ *  \param[in]    Color     RGB565 colour
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vGcSetBackColor(LCDCOLOR Color) {
+
+    BackColor = Color;
+}
+
+/*******************************************************************************
+ *  function :    vGcDisplayStringXY
+ ******************************************************************************/
+/** \brief        Draw a string with the current sGUI font, like
+ *                LCD_DisplayStringXY. The string is sent as one window, or
+ *                one per GC_STAGE_PIXELS. Characters beyond the right edge
+ *                of the screen are dropped instead of wrapping around.
+ *                vGcInit has to be called first.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16X, u16Y    upper left corner
+ *  \param[in]    pcText        string
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vGcDisplayStringXY(uint16_t u16X, uint16_t u16Y, const char *pcText) {
+
+    const FONT_T   *psFont = LCD_GetFont();
+    const uint16_t *pu16Glyph;
+    uint16_t u16Glyph = (uint16_t) psFont->width * psFont->height;
+    uint16_t u16Fit;
+    uint16_t u16Chars;
+    uint16_t u16Stride;
+    uint16_t u16Char;
+    uint8_t  u8Row;
+
+    if ((u16Glyph > GC_STAGE_PIXELS) || (u16X >= LCD_HOR_RESOLUTION)) {
+        return;
+    }
+    u16Fit = (LCD_HOR_RESOLUTION - u16X) / psFont->width;
+
+    while ((*pcText != '\0') && (u16Fit > 0)) {
+        u16Chars = 0;
+        while ((pcText[u16Chars] != '\0') && (u16Chars < u16Fit) &&
+                (u16Chars < GC_STAGE_PIXELS / u16Glyph)) {
+            u16Chars++;
+        }
+        u16Stride = u16Chars * psFont->width;
+
+        for (u16Char = 0; u16Char < u16Chars; u16Char++) {
+            if (u16Glyph > GC_GLYPH_PIXELS) {
+                vGcExpand(pcText[u16Char], psFont,
+                          &u16Stage[u16Char * psFont->width], u16Stride);
+                continue;
+            }
+            pu16Glyph = pu16GcLookup(pcText[u16Char], psFont);
+            for (u8Row = 0; u8Row < psFont->height; u8Row++) {
+                memcpy(&u16Stage[u8Row * u16Stride + u16Char * psFont->width],
+                       &pu16Glyph[u8Row * psFont->width],
+                       psFont->width * sizeof(uint16_t));
+            }
+        }
+        LCD_WriteArea(u16X, u16Y, u16X + u16Stride - 1,
+                      u16Y + psFont->height - 1, u16Stage);
+        sStats.u32Windows++;
+
+        pcText += u16Chars;
+        u16X += u16Stride;
+        u16Fit -= u16Chars;
+    }
+}
+
+/*******************************************************************************
+ *  function :    vGcGetStats
+ ******************************************************************************/
+/** \brief        Cache statistics since vGcInit
+ *
+ *  \type         global
+ *
+ *  \param[out]   psStats   statistics
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vGcGetStats(GcStats_t *psStats) {
+
+    *psStats = sStats;
+}
+
+/*******************************************************************************
+ *  function :    pu16GcLookup
+ ******************************************************************************/
+/** \brief        Find the glyph in the current colours, expand it into a
+ *                free or the oldest slot if missing. The glyph becomes the
+ *                newest entry.
+ *
+ *  \type         local
+ *
+ *  \param[in]    cChar     character
+ *  \param[in]    psFont    font, glyph not bigger than GC_GLYPH_PIXELS
+ *
+ *  \return       width * height pixels, row by row
+ *
+ ******************************************************************************/
+static const uint16_t *pu16GcLookup(char cChar, const FONT_T *psFont) {
+
+    uint32_t u32Hash;
+    uint8_t  u8Slot;
+    uint8_t  *pu8Link;
+
+    if ((cChar < ' ') || (cChar > '~')) {
+        cChar = ' ';
+    }
+    u32Hash = (uint8_t) cChar;
+    u32Hash = u32Hash * 31 + (uint32_t) ((uintptr_t) psFont >> 2);
+    u32Hash = u32Hash * 31 + TextColor;
+    u32Hash = u32Hash * 31 + BackColor;
+    u32Hash = (u32Hash ^ (u32Hash >> 8)) & (GC_BUCKETS - 1);
+
+    for (u8Slot = u8Bucket[u32Hash]; u8Slot != GC_NONE;
+            u8Slot = sEntries[u8Slot].u8Chain) {
+        if ((sEntries[u8Slot].cChar == cChar) &&
+                (sEntries[u8Slot].psFont == psFont) &&
+                (sEntries[u8Slot].Text == TextColor) &&
+                (sEntries[u8Slot].Back == BackColor)) {
+            sStats.u32Hits++;
+            if (u8Slot != u8Newest) {
+                vGcUnlink(u8Slot);
+                vGcPushNewest(u8Slot);
+            }
+            return u16Glyphs[u8Slot];
+        }
+    }
+
+    /* Miss: take a free slot or replace the oldest glyph */
+    sStats.u32Misses++;
+    if (u8Used < GC_SLOTS) {
+        u8Slot = u8Used++;
+    } else {
+        u8Slot = u8Oldest;
+        vGcUnlink(u8Slot);
+        pu8Link = &u8Bucket[sEntries[u8Slot].u8Hash];
+        while (*pu8Link != u8Slot) {
+            pu8Link = &sEntries[*pu8Link].u8Chain;
+        }
+        *pu8Link = sEntries[u8Slot].u8Chain;
+        sStats.u32Evictions++;
+    }
+
+    sEntries[u8Slot].psFont = psFont;
+    sEntries[u8Slot].Text = TextColor;
+    sEntries[u8Slot].Back = BackColor;
+    sEntries[u8Slot].cChar = cChar;
+    sEntries[u8Slot].u8Hash = (uint8_t) u32Hash;
+    sEntries[u8Slot].u8Chain = u8Bucket[u32Hash];
+    u8Bucket[u32Hash] = u8Slot;
+    vGcPushNewest(u8Slot);
+
+    vGcExpand(cChar, psFont, u16Glyphs[u8Slot], psFont->width);
+    return u16Glyphs[u8Slot];
+}
+
+/*******************************************************************************
+ *  function :    vGcExpand
+ ******************************************************************************/
+/** \brief        Expand one glyph in the current colours. Characters outside
+ *                of ' '..'~' are drawn as blank. A font without bitmaps
+ *                (host simulation) is drawn as a box, like simLcd.c does.
+ *
+ *  \type         local
+ *
+ *  \param[in]    cChar      character
+ *  \param[in]    psFont     font
+ *  \param[out]   pu16Dst    upper left pixel of the glyph
+ *  \param[in]    u16Stride  pixels from one row to the next in pu16Dst
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vGcExpand(char cChar, const FONT_T *psFont,
+                      uint16_t *pu16Dst, uint16_t u16Stride) {
+
+    const uint8_t *pu8Column = NULL;
+    uint32_t u32Column;
+    uint32_t u32Top = 1UL << (psFont->height - 1);
+    uint8_t  u8Col, u8Row, u8Byte;
+
+    if ((cChar < ' ') || (cChar > '~')) {
+        cChar = ' ';
+    }
+    if (psFont->data != NULL) {
+        pu8Column = (const uint8_t *) psFont->data +
+                    (cChar - ' ') * psFont->width * psFont->datasize;
+    }
+
+    for (u8Col = 0; u8Col < psFont->width; u8Col++) {
+        u32Column = 0;
+        if (pu8Column != NULL) {
+            for (u8Byte = psFont->datasize; u8Byte > 0; u8Byte--) {
+                u32Column = (u32Column << 8) | pu8Column[u8Byte - 1];
+            }
+            pu8Column += psFont->datasize;
+        } else if ((cChar != ' ') && (u8Col > 0) && (u8Col < psFont->width - 1)) {
+            u32Column = (u32Top - 1) & ~1UL;
+        }
+
+        for (u8Row = 0; u8Row < psFont->height; u8Row++) {
+            pu16Dst[u8Row * u16Stride + u8Col] =
+                (u32Column & (u32Top >> u8Row)) ? TextColor : BackColor;
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    vGcUnlink
+ ******************************************************************************/
+/** \brief        Remove an entry from the use list
+ *
+ *  \type         local
+ *
+ *  \param[in]    u8Slot    entry
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vGcUnlink(uint8_t u8Slot) {
+
+    GcEntry_t *psEntry = &sEntries[u8Slot];
+
+    if (psEntry->u8Newer != GC_NONE) {
+        sEntries[psEntry->u8Newer].u8Older = psEntry->u8Older;
+    } else {
+        u8Newest = psEntry->u8Older;
+    }
+    if (psEntry->u8Older != GC_NONE) {
+        sEntries[psEntry->u8Older].u8Newer = psEntry->u8Newer;
+    } else {
+        u8Oldest = psEntry->u8Newer;
+    }
+}
+
+/*******************************************************************************
+ *  function :    vGcPushNewest
+ ******************************************************************************/
+/** \brief        Insert an entry at the newest end of the use list
+ *
+ *  \type         local
+ *
+ *  \param[in]    u8Slot    entry, not in the list
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vGcPushNewest(uint8_t u8Slot) {
+
+    sEntries[u8Slot].u8Newer = GC_NONE;
+    sEntries[u8Slot].u8Older = u8Newest;
+    if (u8Newest != GC_NONE) {
+        sEntries[u8Newest].u8Newer = u8Slot;
+    } else {
+        u8Oldest = u8Slot;
+    }
+    u8Newest = u8Slot;
+}
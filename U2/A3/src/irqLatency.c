@@ -0,0 +1,134 @@
+/******************************************************************************/
+/** \file       irqLatency.c
+ *******************************************************************************
+ *
+ *  \brief      Worst-case interrupt latency, measured with the update
+ *              interrupt of TIM4.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vLatencyInit
+ *              u32LatencyGetMaxNs
+ *              u32LatencyGetSamples
+ *              TIM4_IRQHandler
+ *  functions  local:
+ *              .
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>                      /* CARME Module                       */
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+
+#include "irqLatency.h"
+#include "sharedState.h"
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+
+//----- Data -------------------------------------------------------------------
+static SharedWord_t sMaxCount;          /* Longest latency in counter ticks   */
+static SharedWord_t sSamples;           /* Number of measurements             */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vLatencyInit
+ ******************************************************************************/
+/** \brief        Start TIM4 and its update interrupt
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vLatencyInit(void) {
+
+    TIM_TimeBaseInitTypeDef sTimeBase;
+    NVIC_InitTypeDef sNvic;
+
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM4, ENABLE);
+
+    /* TIM4 runs at the APB1 timer clock, SystemCoreClock / 2 */
+    TIM_TimeBaseStructInit(&sTimeBase);
+    sTimeBase.TIM_Prescaler = (uint16_t) (SystemCoreClock / 2 / LATENCY_CLOCK_HZ - 1);
+    sTimeBase.TIM_Period = LATENCY_CLOCK_HZ / 1000000 * LATENCY_PERIOD_US - 1;
+    TIM_TimeBaseInit(TIM4, &sTimeBase);
+    TIM_ClearITPendingBit(TIM4, TIM_IT_Update);
+    TIM_ITConfig(TIM4, TIM_IT_Update, ENABLE);
+
+    /* Highest priority still masked by the kernel */
+    sNvic.NVIC_IRQChannel = TIM4_IRQn;
+    sNvic.NVIC_IRQChannelPreemptionPriority = configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY;
+    sNvic.NVIC_IRQChannelSubPriority = 0;
+    sNvic.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&sNvic);
+
+    TIM_Cmd(TIM4, ENABLE);
+}
+
+/*******************************************************************************
+ *  function :    u32LatencyGetMaxNs
+ ******************************************************************************/
+/** \brief        Longest latency since start
+ *
+ *  \type         global
+ *
+ *  \return       latency in ns
+ *
+ ******************************************************************************/
+uint32_t u32LatencyGetMaxNs(void) {
+
+    return (uint32_t) (((uint64_t) u32SharedRead(&sMaxCount) * 1000000000U) /
+                       LATENCY_CLOCK_HZ);
+}
+
+/*******************************************************************************
+ *  function :    u32LatencyGetSamples
+ ******************************************************************************/
+/** \brief        Number of measurements, 0 if the interrupt never ran
+ *
+ *  \type         global
+ *
+ *  \return       measurements since start
+ *
+ ******************************************************************************/
+uint32_t u32LatencyGetSamples(void) {
+
+    return u32SharedRead(&sSamples);
+}
+
+/*******************************************************************************
+ *  function :    TIM4_IRQHandler
+ ******************************************************************************/
+/** \brief        Update interrupt, the counter is the latency
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void TIM4_IRQHandler(void) {
+
+    uint32_t u32Count = TIM4->CNT;
+
+    TIM_ClearITPendingBit(TIM4, TIM_IT_Update);
+
+    /* Only this handler writes, plain read-modify-write is fine */
+    if (u32Count > sMaxCount.u32Value) {
+        sMaxCount.u32Value = u32Count;
+    }
+    sSamples.u32Value++;
+}
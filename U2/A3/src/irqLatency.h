@@ -0,0 +1,41 @@
+#ifndef IRQLATENCY_H_
+#define IRQLATENCY_H_
+/******************************************************************************/
+/** \file       irqLatency.h
+ *******************************************************************************
+ *
+ *  \brief      Worst-case interrupt latency. The update event of TIM4 raises
+ *              an interrupt every LATENCY_PERIOD_US, the handler reads the
+ *              counter which restarted at 0 with the event: the count is the
+ *              time from the event to the handler. The interrupt has the
+ *              highest priority that taskENTER_CRITICAL masks, so every
+ *              critical section of the application and the kernel adds to
+ *              the result. The host simulation has no update interrupts.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vLatencyInit
+ *              u32LatencyGetMaxNs
+ *              u32LatencyGetSamples
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+//----- Macros -----------------------------------------------------------------
+#define LATENCY_CLOCK_HZ      ( 42000000 ) /* TIM4 counter clock, 23.8 ns     */
+#define LATENCY_PERIOD_US     ( 1000 )  /* Time between two measurements      */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern void     vLatencyInit(void);
+extern uint32_t u32LatencyGetMaxNs(void);
+extern uint32_t u32LatencyGetSamples(void);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* IRQLATENCY_H_ */
@@ -2,9 +2,9 @@
 /** \file       lcdTask.c
  *******************************************************************************
  *
- *  \brief      Display the state of the buttons and the switches. This
- *              Information is obtained out of the global variables
- *              u8SwitchState and u8ButtonState.
+ *  \brief      Display the state of the buttons, the switches and the LEDs.
+ *              Switches and LEDs are obtained out of the global snapshot
+ *              sKitState, the buttons from the button events.
  *
  *  \author     wht4
  *
@@ -14,13 +14,18 @@
  *               \li wht4, 24.08.2011, Created
  *               \li wht4, 24.01.2014, Adapted to CARME-M4
  *               \li WBR1, 21.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Lock-free snapshot, IRQ latency
+ *               \li id101010, 17.10.2026, Button events, LED state
+ *               \li id101010, 17.10.2026, Values in a text grid
  *
  ******************************************************************************/
 /*
  *  functions  global:
  *              vLCDTask
  *  functions  local:
- *              .
+ *              vShowBits
+ *              vShowBus
+ *              Number2BinaryString
  *
  ******************************************************************************/
 
@@ -30,6 +35,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <FreeRTOS.h>                   /* All freeRTOS headers               */
 #include <task.h>
@@ -38,16 +44,40 @@
 #include <timers.h>
 #include <memPoolService.h>
 
+#include "lcdTask.h"
+#include "irqLatency.h"
+#include "buttonService.h"
+#include "glyphCache.h"
+#include "textGrid.h"
+
 //----- Macros -----------------------------------------------------------------
 #define Y_HEADERLINE    ( 1 )          /* Pixel y-pos for headerline          */
 #define Y_SWITCH        ( 80 )         /* Pixel y-pos for the switch state    */
 #define Y_BUTTON        ( 100 )        /* Pixel y-pos for the button state    */
+#define Y_LATENCY       ( 120 )        /* Pixel y-pos for the IRQ latency     */
+#define Y_LED           ( 140 )        /* Pixel y-pos for the LED state       */
+#define Y_EVENT         ( 160 )        /* Pixel y-pos for the last button edge*/
+#define Y_BUS           ( 180 )        /* Pixel y-pos for the bus writes      */
 #define X_BORDER        ( 10 )         /* Pixel x-pos for normal boarder      */
 #define X_VALUE         ( 100 )        /* Pixel x-pos where to put the values */
 
+/* Text grid of the values, one row per line above */
+#define VALUE_CHARS     ( 27 )         /* Up to the right edge in font_8x13   */
+#define VALUE_ROWS      ( 6 )
+#define ROW_SWITCH      ( 0 )
+#define ROW_BUTTON      ( 1 )
+#define ROW_LATENCY     ( 2 )
+#define ROW_LED         ( 3 )
+#define ROW_EVENT       ( 4 )
+#define ROW_BUS         ( 5 )
+#define COLOR_BIT_SET   ( GUI_COLOR_GREEN )  /* Bits which are 1              */
+
 //----- Data types -------------------------------------------------------------
 
 //----- Function prototypes ----------------------------------------------------
+static void vShowBits(uint8_t u8Row, uint32_t u32Number,
+                      uint32_t u32NumberOfBit);
+static void vShowBus(void);
 static void Number2BinaryString(uint32_t u32Number,
                                 uint32_t u32NumberOfBit,
                                 char * pcBuffer);
@@ -56,18 +86,25 @@ static void Number2BinaryString(uint32_t u32Number,
 static const char* pcHello = "CARME-Kit states"; /* Welcome text                 */
 static const char* pcSwitchText = "Switch: ";    /* Text to display switch state */
 static const char* pcButtonText = "Button: ";    /* Text to display button state */
+static const char* pcLatencyText = "Latency: ";  /* Text to display IRQ latency  */
+static const char* pcLedText = "LED: ";          /* Text to display LED state    */
+static const char* pcEventText = "Event: ";      /* Text to display button edge  */
+static const char* pcBusText = "Bus: ";          /* Text to display bus writes   */
+
+TG_GRID(sValueGrid, VALUE_CHARS, VALUE_ROWS);    /* Values, changes drawn only   */
 
-uint8_t u8ButtonState = 0;                       /* Button State */
-uint8_t u8SwitchState = 0;                       /* Switch State */
+KitStateSnap_t sKitState = SHARED_SNAP_INIT({ 0, 0 }); /* Switch and LED state  */
 
 //----- Implementation ---------------------------------------------------------
 
 /*******************************************************************************
  *  function :    vLCDTask
  ******************************************************************************/
-/** \brief        Display the state of the buttons and the switches. This
- *                Information is obtained out of the global variables
- *                u8SwitchState and u8ButtonState.
+/** \brief        Display the state of the buttons, the switches and the
+ *                LEDs. Switches and LEDs are obtained out of the global
+ *                snapshot sKitState. The task subscribes to the button
+ *                events and wakes up at once on an edge. Shows the worst
+ *                interrupt latency too.
  *
  *  \type         global
  *
@@ -78,9 +115,9 @@ uint8_t u8SwitchState = 0;                       /* Switch State */
  ******************************************************************************/
 void  vLCDTask(void *pvData) {
 
-    char cBuffer[12];
-    uint8_t switchState;			/* local copy for switch state			*/
-    uint8_t buttonState;			/* local copy for button state			*/
+    char cBuffer[20];
+    KitState_t kitState;			/* local copy of switch and LED state */
+    ButtonEvent_t sEvent;
 
     /* Initialize the Display and display static text */
     LCD_Init();
@@ -89,26 +126,112 @@ void  vLCDTask(void *pvData) {
     LCD_SetFont(&font_8x13);
     LCD_DisplayStringXY(X_BORDER, Y_SWITCH, pcSwitchText);
     LCD_DisplayStringXY(X_BORDER, Y_BUTTON, pcButtonText);
+    LCD_DisplayStringXY(X_BORDER, Y_LATENCY, pcLatencyText);
+    LCD_DisplayStringXY(X_BORDER, Y_LED, pcLedText);
+    LCD_DisplayStringXY(X_BORDER, Y_EVENT, pcEventText);
+    LCD_DisplayStringXY(X_BORDER, Y_BUS, pcBusText);
+    vGcInit();
+    vTgInit(&sValueGrid, X_VALUE, Y_SWITCH, &font_8x13, Y_BUTTON - Y_SWITCH);
 
 	for (;;) {
-        /* copy switchState and buttonState from global variables, this is an access to a
-		 * critical section, so disable interrupts while reading the variable
+        /* a button edge wakes the task at once, everything else is
+         * refreshed every 50 ms
+         */
+        xTaskNotifyWait(0, BUTTON_NOTIFY_ALL, NULL, 50 / portTICK_RATE_MS);
+        while (xButtonGetEvent(&sEvent, 0) == pdTRUE) {
+            sprintf(cBuffer, "T%u %s  ", (unsigned int) sEvent.u8Button,
+                    (sEvent.u8Edge == BUTTON_EDGE_RISING) ? "rising" : "falling");
+            vTgPrint(&sValueGrid, 0, ROW_EVENT, cBuffer);
+        }
+
+        /* copy switch and LED state as one consistent snapshot, the
+		 * interrupts stay enabled
 		 */
-		taskENTER_CRITICAL();	/* disable interrupts */
-		switchState = u8SwitchState; /* access critical section */
-		buttonState = u8ButtonState; /* access critical section */
-		taskEXIT_CRITICAL();	/* enable interrupts again */
+		SHARED_SNAP_READ(&sKitState, &kitState);
 
         /* Display switch state */
-        Number2BinaryString((uint32_t) switchState, 8, cBuffer);
-        LCD_DisplayStringXY(X_VALUE, Y_SWITCH, cBuffer);
+        vShowBits(ROW_SWITCH, (uint32_t) kitState.u8Switch, 8);
+
+        /* Display debounced button state */
+        vShowBits(ROW_BUTTON, (uint32_t) u8ButtonGetState(), BUTTON_COUNT);
+
+        /* Display LED state */
+        vShowBits(ROW_LED, (uint32_t) kitState.u8Led, 8);
+
+        /* Display worst interrupt latency */
+        if (u32LatencyGetSamples() != 0) {
+            sprintf(cBuffer, "%u ns    ", (unsigned int) u32LatencyGetMaxNs());
+        } else {
+            sprintf(cBuffer, "n/a");
+        }
+        vTgPrint(&sValueGrid, 0, ROW_LATENCY, cBuffer);
+
+        /* Display the bus writes of this refresh */
+        vShowBus();
+    }
+}
+
+/*******************************************************************************
+ *  function :    vShowBits
+ ******************************************************************************/
+/** \brief        Show a number in binary in a row of the value grid, the
+ *                bits which are 1 in COLOR_BIT_SET
+ *
+ *  \type         static
+ *
+ *  \param[in]    u8Row          row of the grid
+ *  \param[in]    u32Number      number to show
+ *  \param[in]    u32NumberOfBit number of bits to show, at most 32
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vShowBits(uint8_t u8Row, uint32_t u32Number,
+                      uint32_t u32NumberOfBit) {
+
+    char cBits[33];
+    char cBit[2] = { 0, 0 };
+    uint32_t i;
+
+    Number2BinaryString(u32Number, u32NumberOfBit, cBits);
+    for (i = 0; i < u32NumberOfBit; i++) {
+        cBit[0] = cBits[i];
+        vTgSetColor(&sValueGrid,
+                    (cBit[0] == '1') ? COLOR_BIT_SET : GUI_COLOR_WHITE,
+                    GUI_COLOR_BLACK);
+        vTgPrint(&sValueGrid, (uint8_t) i, u8Row, cBit);
+    }
+    vTgSetColor(&sValueGrid, GUI_COLOR_WHITE, GUI_COLOR_BLACK);
+}
+
+/*******************************************************************************
+ *  function :    vShowBus
+ ******************************************************************************/
+/** \brief        Show the bus writes of the value grid since the last call
+ *                and what the same text would have cost through sGUI
+ *
+ *  \type         static
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vShowBus(void) {
 
-        /* Display button state */
-        Number2BinaryString((uint32_t) buttonState, 4, cBuffer);
-        LCD_DisplayStringXY(X_VALUE, Y_BUTTON, cBuffer);
+    char cBuffer[VALUE_CHARS + 1];
+    TgStats_t sStats;
+    uint32_t u32Glyph = (uint32_t) font_8x13.width * font_8x13.height;
+    uint32_t i;
 
-        vTaskDelay(50 / portTICK_RATE_MS);
+    vTgGetStats(&sValueGrid, &sStats);
+    sprintf(cBuffer, "sGUI %u grid %u",
+            (unsigned int) (sStats.u32Chars * (TG_WINDOW_WRITES + u32Glyph)),
+            (unsigned int) (sStats.u32Windows * TG_WINDOW_WRITES +
+                            sStats.u32Drawn * u32Glyph));
+    for (i = strlen(cBuffer); i < VALUE_CHARS; i++) {
+        cBuffer[i] = ' ';
     }
+    cBuffer[VALUE_CHARS] = '\0';
+    vTgPrint(&sValueGrid, 0, ROW_BUS, cBuffer);
 }
 
 
@@ -4,9 +4,9 @@
 /** \file       lcdTask.h
  *******************************************************************************
  *
- *  \brief      Display the state of the buttons and the switches. This
- *              Information is obtained out of the global variables
- *              u8SwitchState and u8ButtonState.
+ *  \brief      Display the state of the buttons, the switches and the LEDs.
+ *              Switches and LEDs are obtained out of the global snapshot
+ *              sKitState, the buttons from the button events.
  *
  *  \author     wht4
  *
@@ -17,16 +17,24 @@
  ******************************************************************************/
 
 //----- Header-Files -----------------------------------------------------------
-extern uint8_t u8ButtonState;          /* Switch state                        */
-extern uint8_t u8SwitchState;          /* Switch state                        */
+#include <stdint.h>
+
+#include "sharedState.h"
 
 //----- Macros -----------------------------------------------------------------
 
 //----- Data types -------------------------------------------------------------
+typedef struct {
+    uint8_t u8Switch;                  /* Switch state                        */
+    uint8_t u8Led;                     /* LED chaser state                    */
+} KitState_t;
+
+typedef SHARED_SNAP_T(KitState_t) KitStateSnap_t;
 
 //----- Function prototypes ----------------------------------------------------
 extern void vLCDTask(void *pvData);
 
 //----- Data -------------------------------------------------------------------
+extern KitStateSnap_t sKitState;       /* Written by the timer callbacks      */
 
 #endif /* LCDTASK_H_ */
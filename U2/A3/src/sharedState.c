@@ -0,0 +1,122 @@
+/******************************************************************************/
+/** \file       sharedState.c
+ *******************************************************************************
+ *
+ *  \brief      Snapshots of several fields shared without disabling the
+ *              interrupts. Copy 0 is stable while the sequence number is
+ *              even, copy 1 while it is odd.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vSharedSnapWrite
+ *              vSharedSnapRead
+ *  functions  local:
+ *              .
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <string.h>
+
+#include "sharedState.h"
+
+//----- Macros -----------------------------------------------------------------
+/* Memory barrier, also keeps the compiler from moving accesses across it.
+ * CMSIS __DMB has no memory clobber. */
+#define SHARED_BARRIER()    __sync_synchronize()
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+
+//----- Data -------------------------------------------------------------------
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vSharedSnapWrite
+ ******************************************************************************/
+/** \brief        Write a snapshot, never waits. Use SHARED_SNAP_WRITE.
+ *
+ *  \type         global
+ *
+ *  \param[in]    pu32Sequence  sequence number of the snapshot
+ *  \param[out]   pvCopies      the two copies
+ *  \param[in]    pvData        new value
+ *  \param[in]    xSize         size of one copy
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSharedSnapWrite(volatile uint32_t *pu32Sequence, void *pvCopies,
+                      const void *pvData, size_t xSize) {
+
+    uint8_t *pu8Copies = (uint8_t *) pvCopies;
+
+#if SHARED_USE_CRITICAL
+    (void) pu32Sequence;
+    taskENTER_CRITICAL();
+    memcpy(pu8Copies, pvData, xSize);
+    taskEXIT_CRITICAL();
+#else
+    /* Odd: readers take copy 1 while copy 0 is written */
+    (*pu32Sequence)++;
+    SHARED_BARRIER();
+    memcpy(pu8Copies, pvData, xSize);
+    SHARED_BARRIER();
+
+    /* Even: readers take copy 0 while copy 1 is written */
+    (*pu32Sequence)++;
+    SHARED_BARRIER();
+    memcpy(pu8Copies + xSize, pvData, xSize);
+    SHARED_BARRIER();
+#endif
+}
+
+/*******************************************************************************
+ *  function :    vSharedSnapRead
+ ******************************************************************************/
+/** \brief        Read a consistent snapshot. Retries only if a write was
+ *                completed in the meantime, so an interrupt or a higher
+ *                priority task never waits for a preempted writer. Use
+ *                SHARED_SNAP_READ.
+ *
+ *  \type         global
+ *
+ *  \param[in]    pu32Sequence  sequence number of the snapshot
+ *  \param[in]    pvCopies      the two copies
+ *  \param[out]   pvData        value read
+ *  \param[in]    xSize         size of one copy
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSharedSnapRead(volatile uint32_t *pu32Sequence, const void *pvCopies,
+                     void *pvData, size_t xSize) {
+
+    const uint8_t *pu8Copies = (const uint8_t *) pvCopies;
+    uint32_t u32Sequence;
+
+#if SHARED_USE_CRITICAL
+    (void) pu32Sequence;
+    (void) u32Sequence;
+    taskENTER_CRITICAL();
+    memcpy(pvData, pu8Copies, xSize);
+    taskEXIT_CRITICAL();
+#else
+    do {
+        u32Sequence = *pu32Sequence;
+        SHARED_BARRIER();
+        memcpy(pvData, pu8Copies + (u32Sequence & 1U) * xSize, xSize);
+        SHARED_BARRIER();
+    } while (*pu32Sequence != u32Sequence);
+#endif
+}
@@ -45,6 +45,7 @@ extern "C" {
 #include <carme.h>					/* CARME Module							*/
 #include <can.h>					/* CARME CAN Module						*/
 #include "stm32f4xx_it.h"
+#include "buttonService.h"
 
 /*----- Macros -------------------------------------------------------------*/
 
@@ -128,7 +129,19 @@ void DebugMon_Handler(void) {
 
 /**
  *****************************************************************************
- * @brief		This function handles the EXTI Lines 9:5.
+ * @brief		This function handles the EXTI Line 0 (button T3).
+ *
+ * @return		None
+ *****************************************************************************
+ */
+void EXTI0_IRQHandler(void) {
+
+	vButtonIrqHandler();
+}
+
+/**
+ *****************************************************************************
+ * @brief		This function handles the EXTI Lines 9:5 (button T0, CAN).
  *
  * @return		None
  *****************************************************************************
@@ -139,6 +152,19 @@ void EXTI9_5_IRQHandler(void) {
 		CARME_CAN_Interrupt_Handler();
 		EXTI_ClearITPendingBit(CARME_GPIO_TO_EXTILINE(GPIO_Pin_8));
 	}
+	vButtonIrqHandler();
+}
+
+/**
+ *****************************************************************************
+ * @brief		This function handles the EXTI Lines 15:10 (buttons T1, T2).
+ *
+ * @return		None
+ *****************************************************************************
+ */
+void EXTI15_10_IRQHandler(void) {
+
+	vButtonIrqHandler();
 }
 
 #ifdef __cplusplus
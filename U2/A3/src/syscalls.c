@@ -101,7 +101,7 @@ void _exit(int32_t status) {
 
 int _write(int fd, char *str, int len) {
 
-    uint8_t i = 0U;
+    int i = 0;
 
     if (str == NULL) {
         return -1;
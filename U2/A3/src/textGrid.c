@@ -0,0 +1,223 @@
+/******************************************************************************/
+/** \file       textGrid.c
+ *******************************************************************************
+ *
+ *  \brief      Character cell grids over the glyph cache. Every print is
+ *              compared cell by cell with what the grid shows, changed
+ *              cells are collected into runs and drawn with
+ *              vGcDisplayStringXY in the font of the grid.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vTgInit
+ *              vTgSetColor
+ *              vTgPrint
+ *              vTgGetStats
+ *  functions  local:
+ *              vTgDrawRun
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <string.h>                     /* String handling                    */
+
+#include "textGrid.h"
+#include "glyphCache.h"
+
+//----- Macros -----------------------------------------------------------------
+#define TG_RUN_CHARS          ( 64 )    /* Longest run, more than a screen row*/
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static void vTgDrawRun(TextGrid_t *psGrid, uint8_t u8Column, uint8_t u8Row,
+                       const char *pcRun);
+
+//----- Data -------------------------------------------------------------------
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vTgInit
+ ******************************************************************************/
+/** \brief        Place the grid on the screen. All cells are unknown, the
+ *                first print draws every character. Colours are white on
+ *                black. vGcInit has to be called first.
+ *
+ *  \type         global
+ *
+ *  \param[in]    psGrid        grid defined with TG_GRID
+ *  \param[in]    u16X, u16Y    upper left corner
+ *  \param[in]    psFont        font of all cells
+ *  \param[in]    u16Pitch      pixel from one row to the next, at least the
+ *                              font height
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vTgInit(TextGrid_t *psGrid, uint16_t u16X, uint16_t u16Y,
+             FONT_T *psFont, uint16_t u16Pitch) {
+
+    psGrid->u16X = u16X;
+    psGrid->u16Y = u16Y;
+    psGrid->psFont = psFont;
+    psGrid->u16Pitch = u16Pitch;
+    psGrid->Text = GUI_COLOR_WHITE;
+    psGrid->Back = GUI_COLOR_BLACK;
+    memset(psGrid->psCells, 0,
+           (size_t) psGrid->u8Columns * psGrid->u8Rows * sizeof(TgCell_t));
+    memset(&psGrid->sStats, 0, sizeof(psGrid->sStats));
+}
+
+/*******************************************************************************
+ *  function :    vTgSetColor
+ ******************************************************************************/
+/** \brief        Colours of the following prints
+ *
+ *  \type         global
+ *
+ *  \param[in]    psGrid    grid
+ *  \param[in]    Text      text colour
+ *  \param[in]    Back      back colour
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vTgSetColor(TextGrid_t *psGrid, LCDCOLOR Text, LCDCOLOR Back) {
+
+    psGrid->Text = Text;
+    psGrid->Back = Back;
+}
+
+/*******************************************************************************
+ *  function :    vTgPrint
+ ******************************************************************************/
+/** \brief        Print a string into a row of the grid with the current
+ *                colours. Only the cells whose character or colours change
+ *                are drawn. The text is cut at the right edge of the grid,
+ *                control characters are shown as blank.
+ *
+ *  \type         global
+ *
+ *  \param[in]    psGrid      grid
+ *  \param[in]    u8Column    first cell
+ *  \param[in]    u8Row       row of the grid
+ *  \param[in]    pcText      string
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vTgPrint(TextGrid_t *psGrid, uint8_t u8Column, uint8_t u8Row,
+              const char *pcText) {
+
+    char      cRun[TG_RUN_CHARS + 1];
+    TgCell_t *psCell;
+    uint8_t   u8First = 0;              /* Column of cRun[0]                  */
+    uint8_t   u8Length = 0;             /* Characters in cRun                 */
+    char      cChar;
+
+    if (u8Row >= psGrid->u8Rows) {
+        return;
+    }
+    psCell = &psGrid->psCells[u8Row * psGrid->u8Columns + u8Column];
+
+    for (; (u8Column < psGrid->u8Columns) && (*pcText != '\0');
+            u8Column++, psCell++) {
+        cChar = *pcText++;
+        if ((cChar < ' ') || (cChar > '~')) {
+            cChar = ' ';
+        }
+        psGrid->sStats.u32Chars++;
+
+        if ((psCell->cChar == cChar) && (psCell->Text == psGrid->Text) &&
+                (psCell->Back == psGrid->Back)) {
+            /* Unchanged cell ends the run */
+            if (u8Length != 0) {
+                cRun[u8Length] = '\0';
+                vTgDrawRun(psGrid, u8First, u8Row, cRun);
+                u8Length = 0;
+            }
+            continue;
+        }
+
+        psCell->cChar = cChar;
+        psCell->Text = psGrid->Text;
+        psCell->Back = psGrid->Back;
+        if (u8Length == 0) {
+            u8First = u8Column;
+        }
+        cRun[u8Length++] = cChar;
+        if (u8Length == TG_RUN_CHARS) {
+            cRun[u8Length] = '\0';
+            vTgDrawRun(psGrid, u8First, u8Row, cRun);
+            u8Length = 0;
+        }
+    }
+
+    if (u8Length != 0) {
+        cRun[u8Length] = '\0';
+        vTgDrawRun(psGrid, u8First, u8Row, cRun);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vTgGetStats
+ ******************************************************************************/
+/** \brief        Statistics of the grid since the last call. The bus writes
+ *                of sGUI are u32Chars * (TG_WINDOW_WRITES + width * height),
+ *                those of the grid u32Windows * TG_WINDOW_WRITES +
+ *                u32Drawn * width * height.
+ *
+ *  \type         global
+ *
+ *  \param[in]    psGrid    grid
+ *  \param[out]   psStats   statistics
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vTgGetStats(TextGrid_t *psGrid, TgStats_t *psStats) {
+
+    *psStats = psGrid->sStats;
+    memset(&psGrid->sStats, 0, sizeof(psGrid->sStats));
+}
+
+/*******************************************************************************
+ *  function :    vTgDrawRun
+ ******************************************************************************/
+/** \brief        Draw changed cells of one row in the colours of the grid.
+ *                The sGUI font is restored afterwards.
+ *
+ *  \type         local
+ *
+ *  \param[in]    psGrid      grid
+ *  \param[in]    u8Column    first cell of the run
+ *  \param[in]    u8Row       row of the grid
+ *  \param[in]    pcRun       characters of the run
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vTgDrawRun(TextGrid_t *psGrid, uint8_t u8Column, uint8_t u8Row,
+                       const char *pcRun) {
+
+    FONT_T *psFont = LCD_GetFont();
+
+    LCD_SetFont(psGrid->psFont);
+    vGcSetTextColor(psGrid->Text);
+    vGcSetBackColor(psGrid->Back);
+    vGcDisplayStringXY(psGrid->u16X + u8Column * psGrid->psFont->width,
+                       psGrid->u16Y + u8Row * psGrid->u16Pitch, pcRun);
+    LCD_SetFont(psFont);
+
+    psGrid->sStats.u32Drawn += strlen(pcRun);
+    psGrid->sStats.u32Windows++;
+}
@@ -16,6 +16,7 @@
  *               \li wht4, 11.02.2014, Adapted for CARME-M4
  *               \li wht4, 06.01.2015, Migrated to FreeRTOS V8.0.0
  *               \li WBR1, 08.03.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Number of philosophers configurable
  *
  ******************************************************************************/
 /*
@@ -90,7 +91,9 @@ int  main(void)
         semaphoreFork[i] = xSemaphoreCreateBinary();
         xSemaphoreGive(semaphoreFork[i]); /* make available */
         sprintf(cBuffer, "Fork%d", (int) i);
-        vQueueAddToRegistry((xQueueHandle) semaphoreFork[i], pcSemaphoreForkName[i]);
+        if (i < sizeof(pcSemaphoreForkName) / sizeof(pcSemaphoreForkName[0])) {
+            vQueueAddToRegistry((xQueueHandle) semaphoreFork[i], pcSemaphoreForkName[i]);
+        }
     }
 
     /* Counting semaphore for table, protect table access to avoid deadlock */
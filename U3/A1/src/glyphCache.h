@@ -0,0 +1,64 @@
+#ifndef GLYPHCACHE_H_
+#define GLYPHCACHE_H_
+/******************************************************************************/
+/** \file       glyphCache.h
+ *******************************************************************************
+ *
+ *  \brief      Text output over one SSD1963 window per string. The glyphs
+ *              are expanded to RGB565 once and kept in a cache keyed by
+ *              font, text colour, back colour and character. A string is
+ *              assembled from the cached glyphs in SRAM and sent with a
+ *              single LCD_WriteArea, sGUI opens a window and expands the
+ *              bitmap for every character. The cache has a fixed budget of
+ *              GC_BUDGET_BYTES, the least recently used glyph is replaced.
+ *              The cache is not locked, one task draws.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vGcInit
+ *              vGcSetTextColor
+ *              vGcSetBackColor
+ *              vGcDisplayStringXY
+ *              vGcGetStats
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <lcd.h>
+
+//----- Macros -----------------------------------------------------------------
+#ifndef GC_BUDGET_BYTES
+#define GC_BUDGET_BYTES       ( 16 * 1024 ) /* RAM for the cached glyphs      */
+#endif
+
+/* Every slot holds the largest glyph of the compiled fonts (font_9x15,
+ * font_8x16), bigger fonts are expanded into the window without caching */
+#define GC_GLYPH_PIXELS       ( 9 * 16 )
+#define GC_SLOTS              ( GC_BUDGET_BYTES / (GC_GLYPH_PIXELS * 2) )
+#define GC_STAGE_PIXELS       ( 2 * 1024 ) /* SRAM buffer for one window      */
+
+#if (GC_SLOTS < 1) || (GC_SLOTS > 254)
+#error "GC_BUDGET_BYTES must give 1 to 254 slots"
+#endif
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    uint32_t u32Hits;                   /* Glyphs found in the cache          */
+    uint32_t u32Misses;                 /* Glyphs expanded                    */
+    uint32_t u32Evictions;              /* Glyphs replaced                    */
+    uint32_t u32Windows;                /* Windows sent to the display        */
+} GcStats_t;
+
+//----- Function prototypes ----------------------------------------------------
+extern void vGcInit(void);
+extern void vGcSetTextColor(LCDCOLOR Color);
+extern void vGcSetBackColor(LCDCOLOR Color);
+extern void vGcDisplayStringXY(uint16_t u16X, uint16_t u16Y, const char *pcText);
+extern void vGcGetStats(GcStats_t *psStats);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* GLYPHCACHE_H_ */
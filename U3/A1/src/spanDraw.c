@@ -0,0 +1,459 @@
+/******************************************************************************/
+/** \file       spanDraw.c
+ *******************************************************************************
+ *
+ *  \brief      Span based lines, rectangles, circles and rounded
+ *              rectangles. Lines are Bresenham, the pixels of one row
+ *              (x major) or one column (y major) form a span. Circles are
+ *              midpoint circles walked over one octant: the points with the
+ *              same x form a run, mirrored it gives vertical spans on the
+ *              left and right and horizontal spans at top and bottom. A
+ *              rounded rectangle is a circle split into its quadrants at
+ *              the four corner centres.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vSdDrawLine
+ *              vSdDrawRect
+ *              vSdDrawRectF
+ *              vSdDrawCircle
+ *              vSdDrawCircleF
+ *              vSdDrawRoundRect
+ *              vSdDrawRoundRectF
+ *  functions  local:
+ *              vSdSpan
+ *              vSdArcs
+ *              vSdRun
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include "spanDraw.h"
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    int32_t  s32X1, s32Y1;              /* Centre of the upper left quadrant  */
+    int32_t  s32X2, s32Y2;              /* Centre of the lower right quadrant */
+    LCDCOLOR Color;
+    uint8_t  u8Fill;                    /* Filled or outline                  */
+} SdArcs_t;
+
+//----- Function prototypes ----------------------------------------------------
+static void vSdSpan(int32_t s32X1, int32_t s32Y1, int32_t s32X2, int32_t s32Y2,
+                    LCDCOLOR Color);
+static void vSdArcs(const SdArcs_t *psArcs, uint16_t u16Radius);
+static void vSdRun(const SdArcs_t *psArcs, int32_t s32X,
+                   int32_t s32First, int32_t s32Last);
+
+//----- Data -------------------------------------------------------------------
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vSdDrawLine
+ ******************************************************************************/
+/** \brief        Draw a line, like LCD_DrawLine. Horizontal and vertical
+ *                lines are one window, others one window per step of the
+ *                minor axis.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16Xstart, u16Ystart  start point
+ *  \param[in]    u16Xstop, u16Ystop    end point
+ *  \param[in]    Color                 RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSdDrawLine(uint16_t u16Xstart, uint16_t u16Ystart,
+                 uint16_t u16Xstop, uint16_t u16Ystop, LCDCOLOR Color)
+{
+
+    int32_t s32X = u16Xstart, s32Y = u16Ystart;
+    int32_t s32Dx = (int32_t) u16Xstop - u16Xstart;
+    int32_t s32Dy = (int32_t) u16Ystop - u16Ystart;
+    int32_t s32Sx = (s32Dx < 0) ? -1 : 1;
+    int32_t s32Sy = (s32Dy < 0) ? -1 : 1;
+    int32_t s32RunX = s32X, s32RunY = s32Y;
+    int32_t s32PrevX, s32PrevY;
+    int32_t s32Err, s32E2;
+    uint8_t u8XMajor;
+
+    if ((s32Dx == 0) || (s32Dy == 0)) {
+        vSdSpan(u16Xstart, u16Ystart, u16Xstop, u16Ystop, Color);
+        return;
+    }
+
+    s32Dx = s32Dx * s32Sx;              /* abs */
+    s32Dy = -s32Dy * s32Sy;             /* -abs */
+    s32Err = s32Dx + s32Dy;
+    u8XMajor = (uint8_t) (s32Dx >= -s32Dy);
+
+    for (;;) {
+        if ((s32X == u16Xstop) && (s32Y == u16Ystop)) {
+            vSdSpan(s32RunX, s32RunY, s32X, s32Y, Color);
+            break;
+        }
+        s32PrevX = s32X;
+        s32PrevY = s32Y;
+        s32E2 = 2 * s32Err;
+        if (s32E2 >= s32Dy) {
+            s32Err += s32Dy;
+            s32X += s32Sx;
+        }
+        if (s32E2 <= s32Dx) {
+            s32Err += s32Dx;
+            s32Y += s32Sy;
+        }
+        /* A step of the minor axis ends the span */
+        if (u8XMajor ? (s32Y != s32PrevY) : (s32X != s32PrevX)) {
+            vSdSpan(s32RunX, s32RunY, s32PrevX, s32PrevY, Color);
+            s32RunX = s32X;
+            s32RunY = s32Y;
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSdDrawRect
+ ******************************************************************************/
+/** \brief        Draw the outline of a rectangle with four spans
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16Xpos, u16Ypos        upper left corner
+ *  \param[in]    u16Width, u16Height     size
+ *  \param[in]    Color                   RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSdDrawRect(uint16_t u16Xpos, uint16_t u16Ypos, uint16_t u16Width,
+                 uint16_t u16Height, LCDCOLOR Color)
+{
+
+    int32_t s32X2 = (int32_t) u16Xpos + u16Width;
+    int32_t s32Y2 = (int32_t) u16Ypos + u16Height;
+
+    vSdSpan(u16Xpos, u16Ypos, s32X2, u16Ypos, Color);
+    vSdSpan(u16Xpos, s32Y2, s32X2, s32Y2, Color);
+    if (u16Height > 1) {
+        vSdSpan(u16Xpos, u16Ypos + 1, u16Xpos, s32Y2 - 1, Color);
+        vSdSpan(s32X2, u16Ypos + 1, s32X2, s32Y2 - 1, Color);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSdDrawRectF
+ ******************************************************************************/
+/** \brief        Draw a filled rectangle as one window
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16Xpos, u16Ypos        upper left corner
+ *  \param[in]    u16Width, u16Height     size
+ *  \param[in]    Color                   RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSdDrawRectF(uint16_t u16Xpos, uint16_t u16Ypos, uint16_t u16Width,
+                  uint16_t u16Height, LCDCOLOR Color)
+{
+
+    vSdSpan(u16Xpos, u16Ypos, (int32_t) u16Xpos + u16Width,
+            (int32_t) u16Ypos + u16Height, Color);
+}
+
+/*******************************************************************************
+ *  function :    vSdDrawCircle
+ ******************************************************************************/
+/** \brief        Draw the outline of a circle, the same pixels as
+ *                LCD_DrawCircle
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16Xpos, u16Ypos        center
+ *  \param[in]    u16Radius               radius
+ *  \param[in]    Color                   RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSdDrawCircle(uint16_t u16Xpos, uint16_t u16Ypos, uint16_t u16Radius,
+                   LCDCOLOR Color)
+{
+
+    SdArcs_t sArcs = { u16Xpos, u16Ypos, u16Xpos, u16Ypos, Color, 0 };
+
+    vSdArcs(&sArcs, u16Radius);
+}
+
+/*******************************************************************************
+ *  function :    vSdDrawCircleF
+ ******************************************************************************/
+/** \brief        Draw a filled circle, like LCD_DrawCircleF but with the
+ *                full range of Xpos
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16Xpos, u16Ypos        center
+ *  \param[in]    u16Radius               radius
+ *  \param[in]    Color                   RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSdDrawCircleF(uint16_t u16Xpos, uint16_t u16Ypos, uint16_t u16Radius,
+                    LCDCOLOR Color)
+{
+
+    SdArcs_t sArcs = { u16Xpos, u16Ypos, u16Xpos, u16Ypos, Color, 1 };
+
+    vSdArcs(&sArcs, u16Radius);
+}
+
+/*******************************************************************************
+ *  function :    vSdDrawRoundRect
+ ******************************************************************************/
+/** \brief        Draw the outline of a rectangle with rounded corners. The
+ *                radius is reduced to half of the shorter side.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16Xpos, u16Ypos        upper left corner
+ *  \param[in]    u16Width, u16Height     size
+ *  \param[in]    u16Radius               radius of the corners
+ *  \param[in]    Color                   RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSdDrawRoundRect(uint16_t u16Xpos, uint16_t u16Ypos, uint16_t u16Width,
+                      uint16_t u16Height, uint16_t u16Radius, LCDCOLOR Color)
+{
+
+    SdArcs_t sArcs;
+
+    if (u16Radius > u16Width / 2) {
+        u16Radius = u16Width / 2;
+    }
+    if (u16Radius > u16Height / 2) {
+        u16Radius = u16Height / 2;
+    }
+    sArcs.s32X1 = (int32_t) u16Xpos + u16Radius;
+    sArcs.s32Y1 = (int32_t) u16Ypos + u16Radius;
+    sArcs.s32X2 = (int32_t) u16Xpos + u16Width - u16Radius;
+    sArcs.s32Y2 = (int32_t) u16Ypos + u16Height - u16Radius;
+    sArcs.Color = Color;
+    sArcs.u8Fill = 0;
+    vSdArcs(&sArcs, u16Radius);
+}
+
+/*******************************************************************************
+ *  function :    vSdDrawRoundRectF
+ ******************************************************************************/
+/** \brief        Draw a filled rectangle with rounded corners. The radius
+ *                is reduced to half of the shorter side.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16Xpos, u16Ypos        upper left corner
+ *  \param[in]    u16Width, u16Height     size
+ *  \param[in]    u16Radius               radius of the corners
+ *  \param[in]    Color                   RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSdDrawRoundRectF(uint16_t u16Xpos, uint16_t u16Ypos, uint16_t u16Width,
+                       uint16_t u16Height, uint16_t u16Radius, LCDCOLOR Color)
+{
+
+    SdArcs_t sArcs;
+
+    if (u16Radius > u16Width / 2) {
+        u16Radius = u16Width / 2;
+    }
+    if (u16Radius > u16Height / 2) {
+        u16Radius = u16Height / 2;
+    }
+    sArcs.s32X1 = (int32_t) u16Xpos + u16Radius;
+    sArcs.s32Y1 = (int32_t) u16Ypos + u16Radius;
+    sArcs.s32X2 = (int32_t) u16Xpos + u16Width - u16Radius;
+    sArcs.s32Y2 = (int32_t) u16Ypos + u16Height - u16Radius;
+    sArcs.Color = Color;
+    sArcs.u8Fill = 1;
+    vSdArcs(&sArcs, u16Radius);
+}
+
+/*******************************************************************************
+ *  function :    vSdSpan
+ ******************************************************************************/
+/** \brief        Fill the rectangle between two corners, clipped to the
+ *                screen, as one window
+ *
+ *  \type         local
+ *
+ *  \param[in]    s32X1, s32Y1    one corner
+ *  \param[in]    s32X2, s32Y2    opposite corner
+ *  \param[in]    Color           RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSdSpan(int32_t s32X1, int32_t s32Y1, int32_t s32X2, int32_t s32Y2,
+                    LCDCOLOR Color)
+{
+
+    int32_t s32Swap;
+
+    if (s32X1 > s32X2) {
+        s32Swap = s32X1;
+        s32X1 = s32X2;
+        s32X2 = s32Swap;
+    }
+    if (s32Y1 > s32Y2) {
+        s32Swap = s32Y1;
+        s32Y1 = s32Y2;
+        s32Y2 = s32Swap;
+    }
+    /* SCRN_RIGHT is unsigned: compare signed, a span left of or above
+     * the screen would otherwise be clipped to its full width */
+    if ((s32X2 < 0) || (s32Y2 < 0)) {
+        return;
+    }
+    if (s32X1 < 0) {
+        s32X1 = 0;
+    }
+    if (s32Y1 < 0) {
+        s32Y1 = 0;
+    }
+    if (s32X2 > (int32_t) (SCRN_RIGHT)) {
+        s32X2 = (int32_t) (SCRN_RIGHT);
+    }
+    if (s32Y2 > (int32_t) (SCRN_BOTTOM)) {
+        s32Y2 = (int32_t) (SCRN_BOTTOM);
+    }
+    if ((s32X1 > s32X2) || (s32Y1 > s32Y2)) {
+        return;
+    }
+    LCD_FillArea((uint16_t) s32X1, (uint16_t) s32Y1,
+                 (uint16_t) s32X2, (uint16_t) s32Y2, Color);
+}
+
+/*******************************************************************************
+ *  function :    vSdArcs
+ ******************************************************************************/
+/** \brief        Walk the octant of a midpoint circle from (radius, 0) to
+ *                the diagonal and hand every run of points with the same x
+ *                to vSdRun
+ *
+ *  \type         local
+ *
+ *  \param[in]    psArcs      quadrant centres, colour, fill
+ *  \param[in]    u16Radius   radius
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSdArcs(const SdArcs_t *psArcs, uint16_t u16Radius)
+{
+
+    int32_t s32X = u16Radius, s32Y = 0;
+    int32_t s32Err = 1 - (int32_t) u16Radius;
+    int32_t s32First = 0;               /* First y of the run of s32X         */
+    int32_t s32NextX;
+
+    while (s32X >= s32Y) {
+        s32NextX = s32X;
+        if (s32Err < 0) {
+            s32Err += (2 * (s32Y + 1)) + 1;
+        } else {
+            s32NextX--;
+            s32Err += (2 * (s32Y + 1 - s32NextX)) + 1;
+        }
+        if ((s32NextX != s32X) || (s32NextX < s32Y + 1)) {
+            vSdRun(psArcs, s32X, s32First, s32Y);
+            s32First = s32Y + 1;
+        }
+        s32X = s32NextX;
+        s32Y++;
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSdRun
+ ******************************************************************************/
+/** \brief        Draw the points (s32X, s32First..s32Last) of the octant in
+ *                all eight octants. Outline: vertical spans at +-s32X and
+ *                horizontal spans at +-s32X. Filled: the rows +-s32First to
+ *                +-s32Last are s32X wide on both sides, the rows +-s32X
+ *                s32Last wide. The first run starts at 0 and also covers
+ *                the straight edges between the quadrant centres.
+ *
+ *  \type         local
+ *
+ *  \param[in]    psArcs      quadrant centres, colour, fill
+ *  \param[in]    s32X        x of the run
+ *  \param[in]    s32First    first y of the run
+ *  \param[in]    s32Last     last y of the run
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSdRun(const SdArcs_t *psArcs, int32_t s32X,
+                   int32_t s32First, int32_t s32Last)
+{
+
+    int32_t s32X1 = psArcs->s32X1, s32Y1 = psArcs->s32Y1;
+    int32_t s32X2 = psArcs->s32X2, s32Y2 = psArcs->s32Y2;
+    LCDCOLOR Color = psArcs->Color;
+
+    if (psArcs->u8Fill) {
+        if (s32First == 0) {
+            vSdSpan(s32X1 - s32X, s32Y1 - s32Last, s32X2 + s32X, s32Y2 + s32Last,
+                    Color);
+        } else {
+            vSdSpan(s32X1 - s32X, s32Y1 - s32Last, s32X2 + s32X, s32Y1 - s32First,
+                    Color);
+            vSdSpan(s32X1 - s32X, s32Y2 + s32First, s32X2 + s32X, s32Y2 + s32Last,
+                    Color);
+        }
+        if (s32X > s32Last) {
+            vSdSpan(s32X1 - s32Last, s32Y1 - s32X, s32X2 + s32Last, s32Y1 - s32X,
+                    Color);
+            vSdSpan(s32X1 - s32Last, s32Y2 + s32X, s32X2 + s32Last, s32Y2 + s32X,
+                    Color);
+        }
+        return;
+    }
+
+    if (s32First == 0) {
+        vSdSpan(s32X1 - s32X, s32Y1 - s32Last, s32X1 - s32X, s32Y2 + s32Last, Color);
+        vSdSpan(s32X2 + s32X, s32Y1 - s32Last, s32X2 + s32X, s32Y2 + s32Last, Color);
+        vSdSpan(s32X1 - s32Last, s32Y1 - s32X, s32X2 + s32Last, s32Y1 - s32X, Color);
+        vSdSpan(s32X1 - s32Last, s32Y2 + s32X, s32X2 + s32Last, s32Y2 + s32X, Color);
+        return;
+    }
+    /* Left and right */
+    vSdSpan(s32X1 - s32X, s32Y1 - s32Last, s32X1 - s32X, s32Y1 - s32First, Color);
+    vSdSpan(s32X1 - s32X, s32Y2 + s32First, s32X1 - s32X, s32Y2 + s32Last, Color);
+    vSdSpan(s32X2 + s32X, s32Y1 - s32Last, s32X2 + s32X, s32Y1 - s32First, Color);
+    vSdSpan(s32X2 + s32X, s32Y2 + s32First, s32X2 + s32X, s32Y2 + s32Last, Color);
+    /* Top and bottom */
+    vSdSpan(s32X1 - s32Last, s32Y1 - s32X, s32X1 - s32First, s32Y1 - s32X, Color);
+    vSdSpan(s32X2 + s32First, s32Y1 - s32X, s32X2 + s32Last, s32Y1 - s32X, Color);
+    vSdSpan(s32X1 - s32Last, s32Y2 + s32X, s32X1 - s32First, s32Y2 + s32X, Color);
+    vSdSpan(s32X2 + s32First, s32Y2 + s32X, s32X2 + s32Last, s32Y2 + s32X, Color);
+}
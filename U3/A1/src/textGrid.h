@@ -0,0 +1,76 @@
+#ifndef TEXTGRID_H_
+#define TEXTGRID_H_
+/******************************************************************************/
+/** \file       textGrid.h
+ *******************************************************************************
+ *
+ *  \brief      Text mode for fixed screen layouts. A grid is a block of
+ *              character cells in one font at a fixed place on the screen,
+ *              it remembers character, text and back colour of every cell.
+ *              vTgPrint only draws the cells whose content changes, runs of
+ *              neighbouring changed cells go out as one window through the
+ *              glyph cache. Printing the same text again costs no bus
+ *              access at all. A grid is not locked, one task draws.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vTgInit
+ *              vTgSetColor
+ *              vTgPrint
+ *              vTgGetStats
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <lcd.h>
+
+//----- Macros -----------------------------------------------------------------
+/* Bus writes to open a SSD1963 window: column and page address with four
+ * parameters each, memory write command. Every pixel is one more write. */
+#define TG_WINDOW_WRITES      ( 11 )
+
+/* Define a grid of u8Columns x u8Rows cells with its storage */
+#define TG_GRID(name, u8Columns, u8Rows)                                \
+    static TgCell_t name##Cells[(u8Columns) * (u8Rows)];                \
+    static TextGrid_t name = { name##Cells, (u8Columns), (u8Rows) }
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    char     cChar;                     /* '\0' while not known               */
+    LCDCOLOR Text;
+    LCDCOLOR Back;
+} TgCell_t;
+
+typedef struct {
+    uint32_t u32Chars;                  /* Characters printed                 */
+    uint32_t u32Drawn;                  /* Cells drawn                        */
+    uint32_t u32Windows;                /* Windows sent to the display        */
+} TgStats_t;
+
+typedef struct {
+    TgCell_t *psCells;                  /* Row by row                         */
+    uint8_t   u8Columns;
+    uint8_t   u8Rows;
+    uint16_t  u16X;                     /* Upper left corner                  */
+    uint16_t  u16Y;
+    uint16_t  u16Pitch;                 /* Pixel from one row to the next     */
+    FONT_T   *psFont;
+    LCDCOLOR  Text;                     /* Colours of the next print          */
+    LCDCOLOR  Back;
+    TgStats_t sStats;
+} TextGrid_t;
+
+//----- Function prototypes ----------------------------------------------------
+extern void vTgInit(TextGrid_t *psGrid, uint16_t u16X, uint16_t u16Y,
+                    FONT_T *psFont, uint16_t u16Pitch);
+extern void vTgSetColor(TextGrid_t *psGrid, LCDCOLOR Text, LCDCOLOR Back);
+extern void vTgPrint(TextGrid_t *psGrid, uint8_t u8Column, uint8_t u8Row,
+                     const char *pcText);
+extern void vTgGetStats(TextGrid_t *psGrid, TgStats_t *psStats);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* TEXTGRID_H_ */
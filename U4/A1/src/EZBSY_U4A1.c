@@ -21,6 +21,7 @@
  *               \li wht4, 22.02.2014, Adapted to CARME-M4
  *               \li wht4, 06.01.2015, Migrated to FreeRTOS V8.0.0
  *               \li WBR1, 08.03.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Number of philosophers configurable
  *
  ******************************************************************************/
 /*
@@ -95,8 +96,10 @@ int  main(void)
     for (i = 0; i < NUMBER_OF_FORKS; i++) {
         semaphoreFork[i] = xSemaphoreCreateBinary();
         xSemaphoreGive(semaphoreFork[i]); /* make available */
-        vQueueAddToRegistry((xQueueHandle) semaphoreFork[i],
-                            pcSemaphoreForkName[i]);
+        if (i < sizeof(pcSemaphoreForkName) / sizeof(pcSemaphoreForkName[0])) {
+            vQueueAddToRegistry((xQueueHandle) semaphoreFork[i],
+                                pcSemaphoreForkName[i]);
+        }
 
     }
 
@@ -13,6 +13,11 @@
  *               \li wht4, 13.02.2014, Adapted to CARME-M4
  *               \li wht4, 06.01.2015, Migrated to FreeRTOS V8.0.0
  *               \li WBR1, 09.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Render task instead of mutexLCD
+ *               \li id101010, 17.10.2026, Cells drawn through the glyph cache
+ *               \li id101010, 17.10.2026, Cells in text grids, changes only
+ *               \li id101010, 17.10.2026, Line and pots drawn as spans
+ *               \li id101010, 17.10.2026, Post statistics on stdout in the sim
  *
  ******************************************************************************/
 /*
@@ -24,7 +29,12 @@
  *              vDisplayCookState
  *              vDisplayQueuedSpaghetti
  *  functions  local:
- *              .
+ *              vPostCell
+ *              vCountPost
+ *              vDrawCell
+ *              vDrawSpaghetti
+ *              vDrawStatus
+ *              vRenderTask
  *
  ******************************************************************************/
 
@@ -35,6 +45,7 @@
 #include <rtc.h>
 
 #include <stdio.h>                      /* Standard Input/Output              */
+#include <string.h>                     /* String handling                    */
 
 #include <FreeRTOS.h>                   /* All freeRTOS headers               */
 #include <task.h>
@@ -44,6 +55,9 @@
 #include <memPoolService.h>
 
 #include "lcdFunction.h"
+#include "glyphCache.h"
+#include "textGrid.h"
+#include "spanDraw.h"
 
 //----- Macros -----------------------------------------------------------------
 #define X_HEADER          ( 50 )    /* Pixel x-pos for the headerline         */
@@ -52,6 +66,7 @@
 #define	X_PHILOSOPHER	  ( 10 )    /* Pixel x-pos Philosopher column         */
 #define	X_STATE           ( 85 )    /* Pixel x-pos Philosopher state column   */
 #define	X_PORTIONS        ( 237 )   /* Pixel x-pos Philosopher portions column*/
+#define X_STATUS          ( 237 )   /* Pixel x-pos of the post statistics     */
 
 #define Y_HEADER          ( 1 )      /* Pixel y-pos for headerline             */
 #define Y_TITLE           ( 25 )     /* Pixel y-pos for titles                 */
@@ -59,19 +74,69 @@
 #define Y_INCREMENT       ( 10 )     /* Pixel between philosopher              */
 #define Y_COOK            ( 145 )    /* Pixel y-pos for spaghetti cook         */
 #define Y_SPAGHETTI       ( 180 )    /* Pixel y-pos for spaghetti in queue     */
+#define Y_STATUS          ( 180 )    /* Pixel y-pos of the post statistics     */
+#define Y_STATUS_LINE     ( 11 )     /* Pixel between statistic lines          */
 
 #define CIRCLE_DIA        ( 20 )
 #define CIRCLE_RADIUS     ( CIRCLE_DIA >> 1 )
 #define CIRCLE_GAP        ( 10 )
 
+#define PHILOSOPHER_ROWS  ( 5 )      /* Philosophers which fit on the screen   */
+#define STATUS_CHARS      ( 13 )     /* Characters of a statistic line         */
+#define STATUS_LINES      ( 4 )
+#define STATE_CHARS       ( 18 )     /* Longest philosopher state              */
+#define PORTION_CHARS     ( 10 )     /* Up to the right edge in font_8x16      */
+#define COOK_CHARS        ( 27 )     /* Longest cook state                     */
+
+/* Screen cells, each holds the latest value posted for it */
+#define CELL_STATE(n)     ( n )
+#define CELL_PORTIONS(n)  ( NUMBER_OF_PHILOSOPHERS + (n) )
+#define CELL_COOK         ( 2 * NUMBER_OF_PHILOSOPHERS )
+#define CELL_SPAGHETTI    ( CELL_COOK + 1 )
+#define CELLS             ( CELL_SPAGHETTI + 1 )
+#define CELL_WORDS        ( (CELLS + 31) / 32 )
+
+#define PRIORITY_RENDER   ( 1 )      /* Below all producers                    */
+#define STACKSIZE_RENDER  ( 256 )
+#define STATUS_TICKS      ( 1000 / portTICK_RATE_MS ) /* Statistics period     */
+
+/* Compiler switch to compare with the old way of drawing */
+//#define LCD_SYNCHRONOUS            /* Set to draw in the caller with mutex   */
+
 //----- Data types -------------------------------------------------------------
 
 //----- Function prototypes ----------------------------------------------------
+static void vPostCell(uint16_t u16Cell, uint32_t u32Value);
+static void vCountPost(uint32_t u32Cycles);
+static void vDrawCell(uint16_t u16Cell, uint32_t u32Value);
+static void vDrawSpaghetti(uint8_t u8SpaghettiQueued);
+static void vDrawStatus(void);
+static void vRenderTask(void *pvData);
 
 //----- Data -------------------------------------------------------------------
 FATFS fsMain;
 
+#ifdef LCD_SYNCHRONOUS
 static SemaphoreHandle_t mutexLCD;
+#endif
+static TaskHandle_t xRenderTask;
+
+/* Text grids of the render task, each cell redrawn only when it changes */
+TG_GRID(sStateGrid, STATE_CHARS, PHILOSOPHER_ROWS);
+TG_GRID(sPortionGrid, PORTION_CHARS, PHILOSOPHER_ROWS);
+TG_GRID(sCookGrid, COOK_CHARS, 1);
+TG_GRID(sStatusGrid, STATUS_CHARS, STATUS_LINES);
+
+/* Command slots: a post stores the value and sets the dirty bit, posts to the
+ * same cell before the render task runs collapse to the latest value */
+static volatile uint32_t u32CellValue[CELLS];
+static volatile uint32_t u32CellDirty[CELL_WORDS];
+
+/* Statistics since the last status update */
+static volatile uint32_t u32Posts;      /* Calls of the producers             */
+static volatile uint32_t u32PostCycles; /* Cycles spent in the calls          */
+static volatile uint32_t u32PostMax;    /* Longest call                       */
+static volatile uint32_t u32Drawn;      /* Cells drawn                        */
 
 /* Philosopher State Text */
 static const char* pcPhilosopherState[] = {
@@ -109,8 +174,7 @@ static const char* pcCook        = "Cook";                    /* Cook text  */
 static const char* pcQueueSpaghetti1 = "Spaghetti";           /* Queued spaghetti  */
 static const char* pcQueueSpaghetti2 = "in queue";
 
-/* Previous spaghetti portions displayed. This variable is needed by the      */
-/* function vDisplayQueuedSpaghetti                                           */
+/* Previous spaghetti portions displayed, only used by the render task       */
 static  uint8_t  u8PrevSpaghettiQueued = 0;
 
 //----- Implementation ---------------------------------------------------------
@@ -118,8 +182,9 @@ static  uint8_t  u8PrevSpaghettiQueued = 0;
 /*******************************************************************************
  *  function :    vInitDisplay
  ******************************************************************************/
-/** \brief        Initialize the display and the semaphore to access the
- *                display.
+/** \brief        Initialize the display and create the render task which
+ *                owns it. Producers post to screen cells and never wait for
+ *                the display.
  *
  *  \type         global
  *
@@ -130,14 +195,33 @@ void vInitDisplay(void)
 {
 
     LCD_Init();
+    vGcInit();
+    vTgInit(&sStateGrid, X_STATE, Y_PHILOSOPHER, &font_8x16, Y_INCREMENT * 2);
+    vTgInit(&sPortionGrid, X_PORTIONS, Y_PHILOSOPHER, &font_8x16,
+            Y_INCREMENT * 2);
+    vTgInit(&sCookGrid, X_STATE, Y_COOK + 10, &font_8x16, Y_INCREMENT * 2);
+    vTgInit(&sStatusGrid, X_STATUS, Y_STATUS, &font_6x10, Y_STATUS_LINE);
+#ifdef LCD_SYNCHRONOUS
     mutexLCD = xSemaphoreCreateMutex();
+#endif
+
+    /* Cycle counter for the time spent by the producers */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    xTaskCreate(vRenderTask,
+                "Render",
+                STACKSIZE_RENDER,
+                NULL,
+                PRIORITY_RENDER,
+                &xRenderTask);
 }
 
 /*******************************************************************************
  *  function :    vDisplayStaticText
  ******************************************************************************/
-/** \brief        Displays static text on LCD. Uses mutexLCD to access
- *                the display. vInitDisplay has to be called first.
+/** \brief        Displays static text on LCD. Call before the scheduler is
+ *                started, vInitDisplay has to be called first.
  *
  *  \type         global
  *
@@ -161,14 +245,14 @@ void vDisplayStaticText(void)
     LCD_DisplayStringXY(X_PHILOSOPHER, Y_TITLE, pcPhilosopher);
     LCD_DisplayStringXY(X_STATE, Y_TITLE, pcState);
     LCD_DisplayStringXY(X_PORTIONS, Y_TITLE, pcPortions);
-    LCD_DrawLine(X_START_LINE,
-                 Y_TITLE + Y_INCREMENT + 5,
-                 X_END_LINE,
-                 Y_TITLE + Y_INCREMENT + 5,
-                 GUI_COLOR_GREEN);
+    vSdDrawLine(X_START_LINE,
+                Y_TITLE + Y_INCREMENT + 5,
+                X_END_LINE,
+                Y_TITLE + Y_INCREMENT + 5,
+                GUI_COLOR_GREEN);
 
     /* Display philosopher */
-    for (i = 0; i < NUMBER_OF_PHILOSOPHERS; i++) {
+    for (i = 0; (i < NUMBER_OF_PHILOSOPHERS) && (i < PHILOSOPHER_ROWS); i++) {
         sprintf(cBuffer, "P%d:", (int)i + 1);
         LCD_DisplayStringXY(X_START_LINE,
                             Y_PHILOSOPHER + (i * Y_INCREMENT * 2),
@@ -183,9 +267,8 @@ void vDisplayStaticText(void)
 /*******************************************************************************
  *  function :    vDisplayState
  ******************************************************************************/
-/** \brief        Displays the state of a philosopher on the LCD. Uses
- *                mutexLCD to access the display. vInitDisplay has to
- *                be called first.
+/** \brief        Displays the state of a philosopher on the LCD. Does not
+ *                wait for the display. vInitDisplay has to be called first.
  *
  *  \type         global
  *
@@ -198,21 +281,14 @@ void vDisplayStaticText(void)
 void  vDisplayState(uint8_t u8Philosopher, PhilosopherStates ePhilosopherStates)
 {
 
-    if (xSemaphoreTake(mutexLCD, portMAX_DELAY) == pdTRUE) {
-        LCD_DisplayStringXY(X_STATE,
-                            Y_PHILOSOPHER + (u8Philosopher * Y_INCREMENT * 2),
-                            pcPhilosopherState[ePhilosopherStates]);
-
-        xSemaphoreGive(mutexLCD);
-    }
+    vPostCell(CELL_STATE(u8Philosopher), (uint32_t) ePhilosopherStates);
 }
 
 /*******************************************************************************
  *  function :    vDisplayPortions
  ******************************************************************************/
-/** \brief        Displays portions eaten by a philosopher. Uses
- *                mutexLCD to access the display. vInitDisplay has to
- *                be called first.
+/** \brief        Displays portions eaten by a philosopher. Does not wait
+ *                for the display. vInitDisplay has to be called first.
  *
  *  \type         global
  *
@@ -225,24 +301,14 @@ void  vDisplayState(uint8_t u8Philosopher, PhilosopherStates ePhilosopherStates)
 void  vDisplayPortions(uint8_t u8Philosopher, uint32_t u32Portions)
 {
 
-    char   cBuffer[8];
-
-    if (xSemaphoreTake(mutexLCD, portMAX_DELAY) == pdTRUE) {
-        sprintf(cBuffer, "%d", (int) u32Portions);
-        LCD_DisplayStringXY(X_PORTIONS,
-                            Y_PHILOSOPHER + (u8Philosopher * Y_INCREMENT * 2),
-                            cBuffer);
-
-        xSemaphoreGive(mutexLCD);  /* Release semaphore */
-    }
+    vPostCell(CELL_PORTIONS(u8Philosopher), u32Portions);
 }
 
 /*******************************************************************************
  *  function :    vDisplayCookState
  ******************************************************************************/
-/** \brief        Displays the state of the cook on the LCD. Uses
- *                mutexLCD to access the display. vInitDisplay has to
- *                be called first.
+/** \brief        Displays the state of the cook on the LCD. Does not wait
+ *                for the display. vInitDisplay has to be called first.
  *
  *  \type         global
  *
@@ -255,99 +321,305 @@ void  vDisplayPortions(uint8_t u8Philosopher, uint32_t u32Portions)
 void  vDisplayCookState(CookState eCookState, SpaghettiTypes eSpaghettiTypes)
 {
 
+    vPostCell(CELL_COOK, ((uint32_t) eCookState << 8) | eSpaghettiTypes);
+}
+
+/*******************************************************************************
+ *  function :    vDisplayQueuedSpaghetti
+ ******************************************************************************/
+/** \brief        Displays the number of spaghetti portions in the message
+ *                queue. Does not wait for the display. vInitDisplay has to
+ *                be called first.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8SpaghettiQueued   Spaghetti portions in the queue
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void  vDisplayQueuedSpaghetti(uint8_t u8SpaghettiQueued)
+{
+
+    vPostCell(CELL_SPAGHETTI, u8SpaghettiQueued);
+}
+
+/*******************************************************************************
+ *  function :    vPostCell
+ ******************************************************************************/
+/** \brief        Post the value of a screen cell to the render task. The
+ *                dirty bit is set after the value is stored, so the render
+ *                task never misses the latest value.
+ *
+ *  \type         local
+ *
+ *  \param[in]    u16Cell   screen cell
+ *  \param[in]    u32Value  value to display
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vPostCell(uint16_t u16Cell, uint32_t u32Value)
+{
+
+    uint32_t u32Start = DWT->CYCCNT;
+
+#ifdef LCD_SYNCHRONOUS
     if (xSemaphoreTake(mutexLCD, portMAX_DELAY) == pdTRUE) {
+        vDrawCell(u16Cell, u32Value);
+        xSemaphoreGive(mutexLCD);
+    }
+#else
+    __atomic_store_n(&u32CellValue[u16Cell], u32Value, __ATOMIC_RELAXED);
+    __atomic_fetch_or(&u32CellDirty[u16Cell / 32], 1UL << (u16Cell % 32),
+                      __ATOMIC_SEQ_CST);
+    xTaskNotifyGive(xRenderTask);
+#endif
+
+    vCountPost(DWT->CYCCNT - u32Start);
+}
 
-        switch (eCookState)   {
+/*******************************************************************************
+ *  function :    vCountPost
+ ******************************************************************************/
+/** \brief        Add the duration of a post to the statistics
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32Cycles  core clock cycles of the post
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vCountPost(uint32_t u32Cycles)
+{
+
+    uint32_t u32Max = u32PostMax;
+
+    __atomic_fetch_add(&u32Posts, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&u32PostCycles, u32Cycles, __ATOMIC_RELAXED);
+    while ((u32Cycles > u32Max) &&
+            !__atomic_compare_exchange_n(&u32PostMax, &u32Max, u32Cycles, 1,
+                                         __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+/*******************************************************************************
+ *  function :    vDrawCell
+ ******************************************************************************/
+/** \brief        Draw one screen cell. Philosophers below the screen are
+ *                counted but not drawn.
+ *
+ *  \type         local
+ *
+ *  \param[in]    u16Cell   screen cell
+ *  \param[in]    u32Value  value to display
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vDrawCell(uint16_t u16Cell, uint32_t u32Value)
+{
+
+    char     cBuffer[12];
+    uint16_t u16Row = u16Cell % NUMBER_OF_PHILOSOPHERS;
+
+    __atomic_fetch_add(&u32Drawn, 1, __ATOMIC_RELAXED);
+
+    if (u16Cell == CELL_SPAGHETTI) {
+        vDrawSpaghetti((uint8_t) u32Value);
+    } else if (u16Cell == CELL_COOK) {
+        switch (u32Value >> 8)   {
         /* If the chef is cooking, we display the type of spaghetti */
         case COOKING:
-            LCD_DisplayStringXY(X_STATE,
-                                Y_COOK + 10,
-                                pcSpaghettiType[eSpaghettiTypes]);
+            vTgPrint(&sCookGrid, 0, 0, pcSpaghettiType[u32Value & 0xFF]);
             break;
         /* There are enough spaghetti in the queue. So take a nap */
         case NAP:
-            LCD_DisplayStringXY(X_STATE,
-                                Y_COOK + 10,
-                                pcCookState[NAP]);
+            vTgPrint(&sCookGrid, 0, 0, pcCookState[NAP]);
             break;
         /* The spaghetti queue is almost full. The cook can go on vacation */
         case HOLIDAY:
-            LCD_DisplayStringXY(X_STATE,
-                                Y_COOK + 10,
-                                pcCookState[HOLIDAY]);
+            vTgPrint(&sCookGrid, 0, 0, pcCookState[HOLIDAY]);
             break;
 
         default:
             break;
         }
-        xSemaphoreGive(mutexLCD);
+    } else if (u16Row >= PHILOSOPHER_ROWS) {
+        return;
+    } else if (u16Cell < CELL_PORTIONS(0)) {
+        vTgPrint(&sStateGrid, 0, u16Row, pcPhilosopherState[u32Value]);
+    } else {
+        sprintf(cBuffer, "%d", (int) u32Value);
+        vTgPrint(&sPortionGrid, 0, u16Row, cBuffer);
     }
 }
 
 /*******************************************************************************
- *  function :    vDisplayCookState
+ *  function :    vDrawSpaghetti
  ******************************************************************************/
-/** \brief        Displays the number of spaghetti portions in the message
- *                queue. This function uses the static variable
- *                u8PrevSpaghettiQueuedUses mutexLCD to access the
- *                display. vInitDisplay has to be called first.
+/** \brief        Draw the spaghetti pots in the message queue. Only the pots
+ *                which changed since the last call are drawn or cleared,
+ *                u8PrevSpaghettiQueued holds the pots on the display.
  *
- *  \type         global
+ *  \type         local
  *
  *  \param[in]    u8SpaghettiQueued   Spaghetti portions in the queue
  *
  *  \return       void
  *
  ******************************************************************************/
-void  vDisplayQueuedSpaghetti(uint8_t u8SpaghettiQueued)
+static void vDrawSpaghetti(uint8_t u8SpaghettiQueued)
 {
 
     uint8_t i;
 
-    if (xSemaphoreTake(mutexLCD, portMAX_DELAY) == pdTRUE) {
-        /* Just draw spaghetti pots which are not already displayed */
-        if (u8PrevSpaghettiQueued < u8SpaghettiQueued)   {
-
-            for (i = (u8PrevSpaghettiQueued); i < u8SpaghettiQueued; i++)   {
-                /* Draw first five pots on the first line */
-                if (i < 5)   {
-                    LCD_DrawCircle(X_STATE + (i * CIRCLE_DIA) + (i * CIRCLE_GAP) + CIRCLE_RADIUS,
-                                   Y_SPAGHETTI + CIRCLE_RADIUS,
-                                   CIRCLE_RADIUS,
-                                   GUI_COLOR_RED);
-                }
-                /* Draw the other five pots on the second line */
-                else   {
-                    LCD_DrawCircle(X_STATE + ((i - 5) * CIRCLE_DIA) + ((i- 5) * CIRCLE_GAP) + CIRCLE_RADIUS,
-                                   Y_SPAGHETTI + CIRCLE_DIA + CIRCLE_RADIUS + CIRCLE_GAP,
-                                   CIRCLE_RADIUS,
-                                   GUI_COLOR_RED);
-                }
+    /* Just draw spaghetti pots which are not already displayed */
+    if (u8PrevSpaghettiQueued < u8SpaghettiQueued)   {
+
+        for (i = (u8PrevSpaghettiQueued); i < u8SpaghettiQueued; i++)   {
+            /* Draw first five pots on the first line */
+            if (i < 5)   {
+                vSdDrawCircle(X_STATE + (i * CIRCLE_DIA) + (i * CIRCLE_GAP) + CIRCLE_RADIUS,
+                              Y_SPAGHETTI + CIRCLE_RADIUS,
+                              CIRCLE_RADIUS,
+                              GUI_COLOR_RED);
+            }
+            /* Draw the other five pots on the second line */
+            else   {
+                vSdDrawCircle(X_STATE + ((i - 5) * CIRCLE_DIA) + ((i- 5) * CIRCLE_GAP) + CIRCLE_RADIUS,
+                              Y_SPAGHETTI + CIRCLE_DIA + CIRCLE_RADIUS + CIRCLE_GAP,
+                              CIRCLE_RADIUS,
+                              GUI_COLOR_RED);
             }
         }
-        /* If philosopher have eaten more than the cook could prepare, */
-        /* then we have to delete this portions. Just draw black rectangle */
-        if (u8PrevSpaghettiQueued > u8SpaghettiQueued) {
-
-            for (i = (u8SpaghettiQueued); i < u8PrevSpaghettiQueued; i++)   {
-                if (i < 5)   {
-                    LCD_DrawRectF(X_STATE + (i * CIRCLE_DIA) + (i * CIRCLE_GAP),
-                                  Y_SPAGHETTI,
-                                  CIRCLE_DIA,
-                                  CIRCLE_DIA,
-                                  GUI_COLOR_BLACK);
-                } else   {
-
-                    LCD_DrawRectF(X_STATE + ((i - 5) * CIRCLE_DIA) + ((i- 5) * CIRCLE_GAP),
-                                  Y_SPAGHETTI + CIRCLE_DIA + CIRCLE_GAP,
-                                  CIRCLE_DIA,
-                                  CIRCLE_DIA,
-                                  GUI_COLOR_BLACK);
-                }
+    }
+    /* If philosopher have eaten more than the cook could prepare, */
+    /* then we have to delete this portions. Just draw black rectangle */
+    if (u8PrevSpaghettiQueued > u8SpaghettiQueued) {
+
+        for (i = (u8SpaghettiQueued); i < u8PrevSpaghettiQueued; i++)   {
+            if (i < 5)   {
+                vSdDrawRectF(X_STATE + (i * CIRCLE_DIA) + (i * CIRCLE_GAP),
+                             Y_SPAGHETTI,
+                             CIRCLE_DIA,
+                             CIRCLE_DIA,
+                             GUI_COLOR_BLACK);
+            } else   {
+
+                vSdDrawRectF(X_STATE + ((i - 5) * CIRCLE_DIA) + ((i- 5) * CIRCLE_GAP),
+                             Y_SPAGHETTI + CIRCLE_DIA + CIRCLE_GAP,
+                             CIRCLE_DIA,
+                             CIRCLE_DIA,
+                             GUI_COLOR_BLACK);
             }
         }
-        u8PrevSpaghettiQueued = u8SpaghettiQueued;
+    }
+    u8PrevSpaghettiQueued = u8SpaghettiQueued;
+}
 
-        xSemaphoreGive(mutexLCD);
+/*******************************************************************************
+ *  function :    vDrawStatus
+ ******************************************************************************/
+/** \brief        Show and restart the post statistics: longest and mean
+ *                post in core clock cycles, share of the posts which were
+ *                collapsed into a later one. The host simulation prints
+ *                them too, its display can not be read by a script.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vDrawStatus(void)
+{
+
+    char     cLine[STATUS_LINES][STATUS_CHARS + 8];
+    uint32_t u32Count = __atomic_exchange_n(&u32Posts, 0, __ATOMIC_RELAXED);
+    uint32_t u32Cycles = __atomic_exchange_n(&u32PostCycles, 0, __ATOMIC_RELAXED);
+    uint32_t u32Max = __atomic_exchange_n(&u32PostMax, 0, __ATOMIC_RELAXED);
+    uint32_t u32Cells = __atomic_exchange_n(&u32Drawn, 0, __ATOMIC_RELAXED);
+    uint32_t u32Merged = 0;
+    size_t   uxLen;
+    uint8_t  u8Line;
+
+    if ((u32Count != 0) && (u32Cells < u32Count)) {
+        u32Merged = ((u32Count - u32Cells) * 100) / u32Count;
+    }
+    strcpy(cLine[0], "post cycles");
+    sprintf(cLine[1], "max %d", (int) u32Max);
+    sprintf(cLine[2], "avg %d",
+            (int) ((u32Count != 0) ? u32Cycles / u32Count : 0));
+    sprintf(cLine[3], "merged %d%%", (int) u32Merged);
+#ifdef CARME_SIM
+#ifdef LCD_SYNCHRONOUS
+    printf("post %d producers mutex: ", NUMBER_OF_PHILOSOPHERS);
+#else
+    printf("post %d producers render: ", NUMBER_OF_PHILOSOPHERS);
+#endif
+    printf("%s, %s, %s\n", cLine[1], cLine[2], cLine[3]);
+#endif
+
+    for (u8Line = 0; u8Line < STATUS_LINES; u8Line++) {
+        for (uxLen = strlen(cLine[u8Line]); uxLen < STATUS_CHARS; uxLen++) {
+            cLine[u8Line][uxLen] = ' ';
+        }
+        cLine[u8Line][STATUS_CHARS] = '\0';
+        vTgPrint(&sStatusGrid, 0, u8Line, cLine[u8Line]);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vRenderTask
+ ******************************************************************************/
+/** \brief        Owner of the display. Woken by the posts, it takes all
+ *                dirty bits at once and draws the latest value of each
+ *                cell. The statistics are drawn every STATUS_TICKS.
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvData    not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vRenderTask(void *pvData)
+{
+
+    TickType_t xLastStatus = xTaskGetTickCount();
+    TickType_t xElapsed = 0;
+    uint32_t   u32Dirty;
+    uint16_t   u16Word;
+    uint16_t   u16Bit;
+
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, STATUS_TICKS - xElapsed);
+
+        for (u16Word = 0; u16Word < CELL_WORDS; u16Word++) {
+            u32Dirty = __atomic_exchange_n(&u32CellDirty[u16Word], 0,
+                                           __ATOMIC_SEQ_CST);
+            while (u32Dirty != 0) {
+                u16Bit = (uint16_t) __builtin_ctz(u32Dirty);
+                u32Dirty &= u32Dirty - 1;
+                vDrawCell(u16Word * 32 + u16Bit,
+                          __atomic_load_n(&u32CellValue[u16Word * 32 + u16Bit],
+                                          __ATOMIC_RELAXED));
+            }
+        }
+
+        /* Statistics, the wait above ends at the latest when due */
+        xElapsed = xTaskGetTickCount() - xLastStatus;
+        if (xElapsed >= STATUS_TICKS) {
+#ifdef LCD_SYNCHRONOUS
+            xSemaphoreTake(mutexLCD, portMAX_DELAY);
+            vDrawStatus();
+            xSemaphoreGive(mutexLCD);
+#else
+            vDrawStatus();
+#endif
+            xLastStatus = xTaskGetTickCount();
+            xElapsed = 0;
+        }
     }
 }
@@ -4,7 +4,9 @@
 /** \file       lcdFunction.h
  *******************************************************************************
  *
- *  \brief      Functions to display the data for the philosophers task
+ *  \brief      Functions to display the data for the philosophers task.
+ *              A render task owns the display, the display functions only
+ *              post the new value of a screen cell and return at once.
  *
  *  \author     wht4
  *
@@ -24,8 +24,10 @@
 #include <memPoolService.h>
 
 //----- Macros -----------------------------------------------------------------
+#ifndef NUMBER_OF_PHILOSOPHERS
 #define NUMBER_OF_PHILOSOPHERS  ( 5 )   /* number of eating philosophers      */
-#define NUMBER_OF_FORKS         ( 5 )   /* Number of forks for the philosopher*/
+#endif
+#define NUMBER_OF_FORKS         ( NUMBER_OF_PHILOSOPHERS ) /* One per seat    */
 
 //----- Data types -------------------------------------------------------------
 /* philosopher states */
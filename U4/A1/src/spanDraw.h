@@ -0,0 +1,59 @@
+#ifndef SPANDRAW_H_
+#define SPANDRAW_H_
+/******************************************************************************/
+/** \file       spanDraw.h
+ *******************************************************************************
+ *
+ *  \brief      Geometry primitives drawn as horizontal and vertical spans.
+ *              Every span is one LCD_FillArea window, sGUI draws lines and
+ *              circles pixel by pixel with a window per pixel. Axis aligned
+ *              lines are a single window, filled circles one window per
+ *              run of rows of the same width. The shapes are clipped at the
+ *              screen border, the parameters follow the sGUI functions:
+ *              rectangles reach from Xpos to Xpos + width inclusive.
+ *              The centre of a circle may lie anywhere on the screen, the
+ *              Xpos of LCD_DrawCircleF is limited to 255.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vSdDrawLine
+ *              vSdDrawRect
+ *              vSdDrawRectF
+ *              vSdDrawCircle
+ *              vSdDrawCircleF
+ *              vSdDrawRoundRect
+ *              vSdDrawRoundRectF
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <lcd.h>
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern void vSdDrawLine(uint16_t u16Xstart, uint16_t u16Ystart,
+                        uint16_t u16Xstop, uint16_t u16Ystop, LCDCOLOR Color);
+extern void vSdDrawRect(uint16_t u16Xpos, uint16_t u16Ypos, uint16_t u16Width,
+                        uint16_t u16Height, LCDCOLOR Color);
+extern void vSdDrawRectF(uint16_t u16Xpos, uint16_t u16Ypos, uint16_t u16Width,
+                         uint16_t u16Height, LCDCOLOR Color);
+extern void vSdDrawCircle(uint16_t u16Xpos, uint16_t u16Ypos,
+                          uint16_t u16Radius, LCDCOLOR Color);
+extern void vSdDrawCircleF(uint16_t u16Xpos, uint16_t u16Ypos,
+                           uint16_t u16Radius, LCDCOLOR Color);
+extern void vSdDrawRoundRect(uint16_t u16Xpos, uint16_t u16Ypos,
+                             uint16_t u16Width, uint16_t u16Height,
+                             uint16_t u16Radius, LCDCOLOR Color);
+extern void vSdDrawRoundRectF(uint16_t u16Xpos, uint16_t u16Ypos,
+                              uint16_t u16Width, uint16_t u16Height,
+                              uint16_t u16Radius, LCDCOLOR Color);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* SPANDRAW_H_ */
@@ -0,0 +1,355 @@
+/******************************************************************************/
+/** \file       printfBench.c
+ *******************************************************************************
+ *
+ *  \brief      Host benchmark of tiny_printf.c. Compares the output of
+ *              sprintf/snprintf with the C library for the supported flags,
+ *              widths, precisions and lengths, then measures the integer
+ *              conversion of ts_itoa against the former one (power of the
+ *              base by multiplication, divide and modulo per digit) and
+ *              whole sprintf calls against the C library.
+ *
+ *              tiny_printf.c is included with its printf names changed, so
+ *              it does not replace the ones of the host.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              main
+ *              _write
+ *  functions  local:
+ *              u32BenchCheck
+ *              vBenchItoa
+ *              vBenchFormat
+ *              pcBenchOldItoa
+ *              u64BenchNow
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+/* Own names for the functions of tiny_printf.c, glibc names _file _fileno */
+#define printf    tp_printf
+#define fprintf   tp_fprintf
+#define sprintf   tp_sprintf
+#define snprintf  tp_snprintf
+#define vsnprintf tp_vsnprintf
+#define fputs     tp_fputs
+#define puts      tp_puts
+#define fwrite    tp_fwrite
+#define _file     _fileno
+#include "tiny_printf.c"
+#undef printf
+#undef fprintf
+#undef sprintf
+#undef snprintf
+#undef vsnprintf
+#undef fputs
+#undef puts
+#undef fwrite
+#undef _file
+
+//----- Macros -----------------------------------------------------------------
+#define BENCH_VALUES          ( 1024 )  /* Values per conversion round        */
+#define BENCH_ROUNDS          ( 4000 )  /* Rounds per measurement             */
+#define BENCH_CALLS           ( 1000000 ) /* sprintf calls per format         */
+#define BENCH_LINE            ( 128 )
+
+/* Compare one format with the C library */
+#define BENCH_CHECK(...)                                                      \
+    u32Fails += u32BenchCheck(tp_snprintf(cTiny, sizeof(cTiny), __VA_ARGS__), \
+                              snprintf(cLibc, sizeof(cLibc), __VA_ARGS__),    \
+                              #__VA_ARGS__)
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static uint32_t u32BenchCheck(int iTiny, int iLibc, const char *pcArgs);
+static void vBenchItoa(int iBase);
+static void vBenchFormat(const char *pcFmt, unsigned int uValue);
+static char *pcBenchOldItoa(char *pcBuf, unsigned int d, int base)
+__attribute__((noinline));
+static uint64_t u64BenchNow(void);
+
+//----- Data -------------------------------------------------------------------
+static char cTiny[BENCH_LINE];
+static char cLibc[BENCH_LINE];
+static unsigned int uValues[BENCH_VALUES];
+static volatile unsigned int uBenchSink;
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    main
+ ******************************************************************************/
+/** \brief        Check the output, then measure the conversions
+ *
+ *  \type         global
+ *
+ *  \return       0 on success, 1 if an output differs from the C library
+ *
+ ******************************************************************************/
+int main(void)
+{
+
+    uint32_t u32Fails = 0;
+    uint32_t u32Value;
+    char     cShort[6];
+    int      iLen;
+
+    BENCH_CHECK("%d %i %u", 0, -1, 0U);
+    BENCH_CHECK("%d %d %u", 2147483647, (int) 0x80000000U, 4294967295U);
+    BENCH_CHECK("%x %X %o", 0xdeadbeefU, 0xdeadbeefU, 0x80000000U);
+    BENCH_CHECK("[%5d] [%-5d] [%05d] [%+d] [% d]", 42, 42, -42, 42, 42);
+    BENCH_CHECK("[%.3d] [%.0d] [%5.3d] [%-6.2d] [%8.3d]", 7, 0, -7, 7, 7);
+    BENCH_CHECK("[%08x] [%#x] [%#X] [%#010x] [%#x]", 0xbeefU, 255U, 255U,
+                255U, 0U);
+    BENCH_CHECK("[%o] [%#o] [%#o] [%#.0o] [%.0x]", 8U, 8U, 0U, 0U, 0U);
+    BENCH_CHECK("[%hd] [%hu] [%hhd] [%hhx]", 70000, 70000U, 200, 0x1ffU);
+    BENCH_CHECK("[%ld] [%lu] [%lx] [%zu]", -123456L, 123456UL, 0xabcdUL,
+                (size_t) 4096);
+    BENCH_CHECK("[%c] [%3c] [%-3c]", 'a', 'b', 'c');
+    BENCH_CHECK("[%s] [%8s] [%-8s] [%.2s] [%6.3s]", "abc", "abc", "abc",
+                "abc", "abcdef");
+    BENCH_CHECK("[%*d] [%-*d] [%*d] [%.*d] [%.*s]", 6, 1, 6, 1, -6, 1, 4, 1,
+                2, "xyz");
+    BENCH_CHECK("100%% %s", "done");
+    BENCH_CHECK("%d:  %s  '%s'\n\r", 1234, "ButtonTask", "Btn0 rising");
+    for (u32Value = 1; u32Value != 0; u32Value *= 3) {
+        BENCH_CHECK("%u %d %x %o", u32Value, (int) u32Value, u32Value,
+                    u32Value);
+        if (u32Value > 0xFFFFFFFFU / 3) {
+            break;
+        }
+    }
+
+    /* Truncation keeps the length of the whole output */
+    iLen = tp_snprintf(cShort, sizeof(cShort), "%08x", 0x1234U);
+    if ((iLen != 8) || (strcmp(cShort, "00001") != 0)) {
+        printf("snprintf truncation: %d '%s'\n", iLen, cShort);
+        u32Fails++;
+    }
+    printf("%u outputs differ from the C library\n\n", (unsigned) u32Fails);
+
+    printf("base  former ns  ts_itoa ns  speedup\n");
+    vBenchItoa(10);
+    vBenchItoa(16);
+
+    printf("\nformat           tiny ns  libc ns\n");
+    vBenchFormat("%d", 1234567U);
+    vBenchFormat("%u", 42U);
+    vBenchFormat("%08x", 0xbeefU);
+    vBenchFormat("%-10d|", 98765U);
+    vBenchFormat("%d:  %s  '%s'", 1234U);
+
+    return (u32Fails != 0) ? 1 : 0;
+}
+
+/*******************************************************************************
+ *  function :    _write
+ ******************************************************************************/
+/** \brief        Output of tiny_printf.c, the characters are dropped
+ *
+ *  \type         global
+ *
+ *  \param[in]    fd        file number
+ *  \param[in]    str       characters
+ *  \param[in]    len       number of characters
+ *
+ *  \return       len
+ *
+ ******************************************************************************/
+int _write(int fd, char *str, int len)
+{
+
+    uBenchSink += (unsigned int) len;
+    return len;
+}
+
+/*******************************************************************************
+ *  function :    u32BenchCheck
+ ******************************************************************************/
+/** \brief        Compare the output of tiny_printf.c in cTiny with the one
+ *                of the C library in cLibc, print a difference
+ *
+ *  \type         local
+ *
+ *  \param[in]    iTiny     length returned by tiny_printf.c
+ *  \param[in]    iLibc     length returned by the C library
+ *  \param[in]    pcArgs    arguments as text
+ *
+ *  \return       1 if the outputs differ, else 0
+ *
+ ******************************************************************************/
+static uint32_t u32BenchCheck(int iTiny, int iLibc, const char *pcArgs)
+{
+
+    if ((iTiny == iLibc) && (strcmp(cTiny, cLibc) == 0)) {
+        return 0;
+    }
+    printf("%s\n  tiny %d '%s'\n  libc %d '%s'\n", pcArgs, iTiny, cTiny,
+           iLibc, cLibc);
+    return 1;
+}
+
+/*******************************************************************************
+ *  function :    vBenchItoa
+ ******************************************************************************/
+/** \brief        Time the conversion of values with 1 up to 10 digits with
+ *                the former conversion and with ts_itoa
+ *
+ *  \type         local
+ *
+ *  \param[in]    iBase     10 or 16
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchItoa(int iBase)
+{
+
+    char     cBuf[16];
+    uint32_t u32Value;
+    uint32_t u32Round;
+    uint32_t u32Seed = 1;
+    uint64_t u64Start;
+    uint64_t u64Old;
+    uint64_t u64New;
+    double   dConversions = (double) BENCH_VALUES * BENCH_ROUNDS;
+
+    /* Equal share of every number of decimal digits */
+    for (u32Value = 0; u32Value < BENCH_VALUES; u32Value++) {
+        u32Seed = u32Seed * 1103515245U + 12345U;
+        uValues[u32Value] = u32Seed >> (u32Value % 32);
+    }
+
+    u64Start = u64BenchNow();
+    for (u32Round = 0; u32Round < BENCH_ROUNDS; u32Round++) {
+        for (u32Value = 0; u32Value < BENCH_VALUES; u32Value++) {
+            uBenchSink += (unsigned int)
+                (pcBenchOldItoa(cBuf, uValues[u32Value], iBase) - cBuf);
+        }
+    }
+    u64Old = u64BenchNow() - u64Start;
+
+    u64Start = u64BenchNow();
+    for (u32Round = 0; u32Round < BENCH_ROUNDS; u32Round++) {
+        for (u32Value = 0; u32Value < BENCH_VALUES; u32Value++) {
+            uBenchSink += (unsigned int) (cBuf + sizeof(cBuf) -
+                                          ts_itoa(cBuf + sizeof(cBuf),
+                                                  uValues[u32Value], iBase, 0));
+        }
+    }
+    u64New = u64BenchNow() - u64Start;
+
+    printf("%4d  %9.2f  %10.2f  %6.2fx\n", iBase,
+           (double) u64Old / dConversions, (double) u64New / dConversions,
+           (double) u64Old / (double) (u64New ? u64New : 1));
+}
+
+/*******************************************************************************
+ *  function :    vBenchFormat
+ ******************************************************************************/
+/** \brief        Time sprintf of tiny_printf.c and of the C library. A
+ *                format with %s takes a task name and a message.
+ *
+ *  \type         local
+ *
+ *  \param[in]    pcFmt     format with one integer conversion
+ *  \param[in]    uValue    value of the integer
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchFormat(const char *pcFmt, unsigned int uValue)
+{
+
+    uint32_t u32Call;
+    uint64_t u64Start;
+    uint64_t u64Tiny;
+    uint64_t u64Libc;
+
+    u64Start = u64BenchNow();
+    for (u32Call = 0; u32Call < BENCH_CALLS; u32Call++) {
+        uBenchSink += (unsigned int) tp_sprintf(cTiny, pcFmt, uValue + u32Call,
+                                                "ButtonTask", "Btn0 rising");
+    }
+    u64Tiny = u64BenchNow() - u64Start;
+
+    u64Start = u64BenchNow();
+    for (u32Call = 0; u32Call < BENCH_CALLS; u32Call++) {
+        uBenchSink += (unsigned int) sprintf(cLibc, pcFmt, uValue + u32Call,
+                                             "ButtonTask", "Btn0 rising");
+    }
+    u64Libc = u64BenchNow() - u64Start;
+
+    printf("%-15s  %7.1f  %7.1f\n", pcFmt,
+           (double) u64Tiny / BENCH_CALLS, (double) u64Libc / BENCH_CALLS);
+}
+
+/*******************************************************************************
+ *  function :    pcBenchOldItoa
+ ******************************************************************************/
+/** \brief        Former conversion of ts_itoa: the largest power of the base
+ *                by repeated multiplication, then a divide and a modulo per
+ *                digit
+ *
+ *  \type         local
+ *
+ *  \param[in]    pcBuf     buffer for the digits
+ *  \param[in]    d         value
+ *  \param[in]    base      10 or 16
+ *
+ *  \return       end of the digits
+ *
+ ******************************************************************************/
+static char *pcBenchOldItoa(char *pcBuf, unsigned int d, int base)
+{
+
+    unsigned int div = 1;
+    while (d/div >= (unsigned int)base) {
+        div *= base;
+    }
+
+    while (div != 0) {
+        int num = d/div;
+        d = d%div;
+        div /= base;
+        if (num > 9) {
+            *pcBuf++ = (num-10) + 'A';
+        } else {
+            *pcBuf++ = num + '0';
+        }
+    }
+    return pcBuf;
+}
+
+/*******************************************************************************
+ *  function :    u64BenchNow
+ ******************************************************************************/
+/** \brief        Monotonic host time
+ *
+ *  \type         local
+ *
+ *  \return       time in ns
+ *
+ ******************************************************************************/
+static uint64_t u64BenchNow(void)
+{
+
+    struct timespec sNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &sNow);
+    return ((uint64_t) sNow.tv_sec * 1000000000ULL) + (uint64_t) sNow.tv_nsec;
+}
@@ -0,0 +1,347 @@
+/******************************************************************************/
+/** \file       logDecode.c
+ *******************************************************************************
+ *
+ *  \brief      Host decoder of the deferred log of U4A2. Reads the frames
+ *              of UartTask (logFormat.h) from a capture file, a serial port
+ *              or stdin, takes the format, the task name and the %s
+ *              arguments from the loaded segments of the ELF of the target
+ *              and prints the messages as the gatekeeper did before:
+ *
+ *                  logDecode build/EZBS_U4A2.elf /dev/ttyUSB0
+ *                  1234:  ButtonTask  'Btn0 rising edge at tick 1230'
+ *
+ *              Bytes outside of frames, and frames whose length, check byte
+ *              or format does not match, are passed through unchanged. The
+ *              search for the next frame starts at the byte after.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Sync word and check byte
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              main
+ *  functions  local:
+ *              u8ElfLoad
+ *              pcElfString
+ *              uxFrameNeed
+ *              uxDecodeFrame
+ *              u32DecodeWord
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "logFormat.h"
+
+//----- Macros -----------------------------------------------------------------
+#define DECODE_MSG_LEN        ( 256 )
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static uint8_t u8ElfLoad(const char *pcFile);
+static const char *pcElfString(LogWord_t xAddress);
+static size_t uxFrameNeed(const uint8_t *pu8Buf, size_t uxFill);
+static size_t uxDecodeFrame(const uint8_t *pu8Buf, size_t uxFill);
+static uint32_t u32DecodeWord(const uint8_t *pu8Buf);
+
+//----- Data -------------------------------------------------------------------
+static uint8_t          *pu8Elf;        /* Whole ELF file                     */
+static size_t            uxElfSize;
+static const Elf32_Phdr *psSegments;    /* Program headers                    */
+static uint16_t          u16Segments;
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    main
+ ******************************************************************************/
+/** \brief        Decode the frames of the capture until its end
+ *
+ *  \type         global
+ *
+ *  \param[in]    argc      number of arguments
+ *  \param[in]    argv      ELF file, capture (stdin if missing)
+ *
+ *  \return       0 on success, 1 if a file can not be read
+ *
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+
+    uint8_t u8Buf[LOG_FRAME_MAX];
+    size_t  uxFill = 0;
+    size_t  uxUsed;
+    FILE   *psIn = stdin;
+    int     iByte = 0;
+
+    if ((argc < 2) || (argc > 3)) {
+        fprintf(stderr, "usage: %s <elf> [capture]\n", argv[0]);
+        return 1;
+    }
+    if (u8ElfLoad(argv[1]) != 0) {
+        return 1;
+    }
+    if (argc == 3) {
+        psIn = fopen(argv[2], "rb");
+        if (psIn == NULL) {
+            perror(argv[2]);
+            return 1;
+        }
+    }
+
+    for (;;) {
+        /* Read until the frame at the start of the window is complete */
+        while ((uxFill < uxFrameNeed(u8Buf, uxFill)) && (iByte != EOF)) {
+            iByte = fgetc(psIn);
+            if (iByte != EOF) {
+                u8Buf[uxFill++] = (uint8_t) iByte;
+            }
+        }
+        if (uxFill == 0) {
+            break;
+        }
+
+        uxUsed = uxDecodeFrame(u8Buf, uxFill);
+        if (uxUsed == 0) {
+            /* No frame starts here, look again at the next byte */
+            putchar(u8Buf[0]);
+            uxUsed = 1;
+        }
+        uxFill -= uxUsed;
+        memmove(u8Buf, &u8Buf[uxUsed], uxFill);
+        fflush(stdout);
+    }
+
+    if (psIn != stdin) {
+        fclose(psIn);
+    }
+    free(pu8Elf);
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    u8ElfLoad
+ ******************************************************************************/
+/** \brief        Read the ELF file and find its program headers
+ *
+ *  \type         local
+ *
+ *  \param[in]    pcFile    ELF file of the target
+ *
+ *  \return       0 on success, 1 if it is no 32 bit little endian ELF
+ *
+ ******************************************************************************/
+static uint8_t u8ElfLoad(const char *pcFile)
+{
+
+    FILE             *psFile = fopen(pcFile, "rb");
+    const Elf32_Ehdr *psHeader;
+    long              lSize;
+
+    if (psFile == NULL) {
+        perror(pcFile);
+        return 1;
+    }
+    fseek(psFile, 0, SEEK_END);
+    lSize = ftell(psFile);
+    fseek(psFile, 0, SEEK_SET);
+    if (lSize < (long) sizeof(Elf32_Ehdr)) {
+        fprintf(stderr, "%s: no ELF file\n", pcFile);
+        fclose(psFile);
+        return 1;
+    }
+    uxElfSize = (size_t) lSize;
+    pu8Elf = malloc(uxElfSize);
+    if ((pu8Elf == NULL) ||
+            (fread(pu8Elf, 1, uxElfSize, psFile) != uxElfSize)) {
+        fprintf(stderr, "%s: can not be read\n", pcFile);
+        fclose(psFile);
+        return 1;
+    }
+    fclose(psFile);
+
+    psHeader = (const Elf32_Ehdr *) pu8Elf;
+    if ((memcmp(psHeader->e_ident, ELFMAG, SELFMAG) != 0) ||
+            (psHeader->e_ident[EI_CLASS] != ELFCLASS32) ||
+            (psHeader->e_ident[EI_DATA] != ELFDATA2LSB) ||
+            (psHeader->e_phoff + (size_t) psHeader->e_phnum *
+             sizeof(Elf32_Phdr) > uxElfSize)) {
+        fprintf(stderr, "%s: no 32 bit little endian ELF file\n", pcFile);
+        return 1;
+    }
+    psSegments = (const Elf32_Phdr *) &pu8Elf[psHeader->e_phoff];
+    u16Segments = psHeader->e_phnum;
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    pcElfString
+ ******************************************************************************/
+/** \brief        String at an address of the target, taken from the loaded
+ *                segments of the ELF file
+ *
+ *  \type         local
+ *
+ *  \param[in]    xAddress  address on the target
+ *
+ *  \return       the string, NULL if it is not in the file or not terminated
+ *
+ ******************************************************************************/
+static const char *pcElfString(LogWord_t xAddress)
+{
+
+    const Elf32_Phdr *psSeg;
+    const char       *pcString;
+    size_t            uxMax;
+    uint16_t          u16Seg;
+
+    for (u16Seg = 0; u16Seg < u16Segments; u16Seg++) {
+        psSeg = &psSegments[u16Seg];
+        if ((psSeg->p_type != PT_LOAD) || (xAddress < psSeg->p_vaddr) ||
+                (xAddress >= psSeg->p_vaddr + psSeg->p_filesz) ||
+                (psSeg->p_offset + psSeg->p_filesz > uxElfSize)) {
+            continue;
+        }
+        pcString = (const char *) &pu8Elf[psSeg->p_offset +
+                                          (xAddress - psSeg->p_vaddr)];
+        uxMax = psSeg->p_vaddr + psSeg->p_filesz - xAddress;
+        if (memchr(pcString, '\0', uxMax) != NULL) {
+            return pcString;
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+ *  function :    uxFrameNeed
+ ******************************************************************************/
+/** \brief        Bytes the window needs to decide on the frame at its start.
+ *                The sync word, the type and its payload length are checked
+ *                as soon as they are there, so a stray sync byte in the
+ *                text holds back at most LOG_FRAME_HEAD bytes.
+ *
+ *  \type         local
+ *
+ *  \param[in]    pu8Buf    received bytes
+ *  \param[in]    uxFill    number of received bytes
+ *
+ *  \return       length of the frame, 1 if no frame starts here
+ *
+ ******************************************************************************/
+static size_t uxFrameNeed(const uint8_t *pu8Buf, size_t uxFill)
+{
+
+    size_t uxLen;
+
+    if ((uxFill == 0) || (pu8Buf[0] != LOG_SYNC_0)) {
+        return 1;
+    }
+    if (uxFill < 2) {
+        return 2;
+    }
+    if (pu8Buf[1] != LOG_SYNC_1) {
+        return 1;
+    }
+    if (uxFill < LOG_FRAME_HEAD) {
+        return LOG_FRAME_HEAD;
+    }
+
+    uxLen = pu8Buf[3];
+    if (pu8Buf[2] == LOG_FRAME_LOST) {
+        if (uxLen != LOG_LOST_LEN) {
+            return 1;
+        }
+    } else if (pu8Buf[2] == LOG_FRAME_MSG) {
+        if ((uxLen < LOG_MSG_LEN(0)) || (uxLen > LOG_MSG_LEN(LOG_MAX_ARGS)) ||
+                ((uxLen - 1) % 4 != 0)) {
+            return 1;
+        }
+    } else {
+        return 1;
+    }
+    return LOG_FRAME_HEAD + uxLen + 1;
+}
+
+/*******************************************************************************
+ *  function :    uxDecodeFrame
+ ******************************************************************************/
+/** \brief        Check and print the frame at the start of the window
+ *
+ *  \type         local
+ *
+ *  \param[in]    pu8Buf    received bytes
+ *  \param[in]    uxFill    number of received bytes
+ *
+ *  \return       bytes of the frame, 0 if no complete frame starts here
+ *
+ ******************************************************************************/
+static size_t uxDecodeFrame(const uint8_t *pu8Buf, size_t uxFill)
+{
+
+    LogWord_t      xArgs[LOG_MAX_ARGS];
+    char           cMsg[DECODE_MSG_LEN];
+    const char    *pcFmt;
+    const char    *pcTask;
+    const uint8_t *pu8Load = &pu8Buf[LOG_FRAME_HEAD];
+    size_t         uxLen;
+    uint8_t        u8Args;
+    uint8_t        u8Arg;
+
+    uxLen = uxFrameNeed(pu8Buf, uxFill);
+    if ((uxLen == 1) || (uxFill < uxLen) ||
+            (u8LogCheck(&pu8Buf[2], uxLen - 3) != pu8Buf[uxLen - 1])) {
+        return 0;
+    }
+    if (pu8Buf[2] == LOG_FRAME_LOST) {
+        printf("--- %u messages lost\n", (unsigned) u32DecodeWord(pu8Load));
+        return uxLen;
+    }
+    u8Args = pu8Load[0];
+    if (LOG_MSG_LEN(u8Args) != pu8Buf[3]) {
+        return 0;
+    }
+    pcFmt = pcElfString(u32DecodeWord(&pu8Load[1]));
+    if (pcFmt == NULL) {
+        return 0;
+    }
+    pcTask = pcElfString(u32DecodeWord(&pu8Load[9]));
+    for (u8Arg = 0; u8Arg < u8Args; u8Arg++) {
+        xArgs[u8Arg] = u32DecodeWord(&pu8Load[13 + 4 * u8Arg]);
+    }
+
+    iLogFormat(cMsg, sizeof(cMsg), pcFmt, xArgs, u8Args, pcElfString);
+    printf("%u:  %s  '%s'\n", (unsigned) u32DecodeWord(&pu8Load[5]),
+           (pcTask != NULL) ? pcTask : "?", cMsg);
+    return uxLen;
+}
+
+/*******************************************************************************
+ *  function :    u32DecodeWord
+ ******************************************************************************/
+/** \brief        Little endian word of a frame
+ *
+ *  \type         local
+ *
+ *  \param[in]    pu8Buf    first byte
+ *
+ *  \return       the word
+ *
+ ******************************************************************************/
+static uint32_t u32DecodeWord(const uint8_t *pu8Buf)
+{
+
+    return (uint32_t) pu8Buf[0] | ((uint32_t) pu8Buf[1] << 8) |
+           ((uint32_t) pu8Buf[2] << 16) | ((uint32_t) pu8Buf[3] << 24);
+}
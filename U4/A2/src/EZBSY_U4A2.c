@@ -12,6 +12,9 @@
  *               \li wht4, 13.02.2014, Created
  *               \li wht4, 06.01.2015, Migrated to FreeRTOS V8.0.0
  *               \li WBR1, 09.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Button events by interrupt
+ *               \li id101010, 17.10.2026, Deferred log instead of the queue
+ *               \li id101010, 17.10.2026, Interrupt driven UART output
  *
  ******************************************************************************/
 /*
@@ -19,8 +22,6 @@
  *              main
  *  functions  local:
  *              vCreateTasks
- *              vCreateTimers
- *              LedCallback
  *
  ******************************************************************************/
 
@@ -43,30 +44,35 @@
 #include "uartTask.h"
 #include "switchTask.h"
 #include "dummyTask.h"
+#include "buttonTask.h"
+#include "buttonService.h"
+#include "uartService.h"
 
 //----- Macros -----------------------------------------------------------------
 #define PRIORITY_UART_TASK    ( 1 )
 #define PRIORITY_SWITCH_TASK  ( 4 )
 #define PRIORITY_DUMMY_TASK   ( 2 )
+#define PRIORITY_BUTTON_TASK  ( 3 )
 
 #define STACKSIZE_UART_TASK   ( 512 )
 #define STACKSIZE_SWITCH_TASK ( 256 )
 #define STACKSIZE_DUMMY_TASK  ( 256 )
+#define STACKSIZE_BUTTON_TASK ( 256 )
 
 #define Y_HEADERLINE          ( 1 )     /* pixel y-pos for headerline */
 
 //----- Data types -------------------------------------------------------------
-static const char* pcQueueLog = "LogQueue";
 
 //----- Function prototypes ----------------------------------------------------
 static void vCreateTasks(void);
-static void vCreateTimers(void);
-static void ButtonCallback(xTimerHandle pxTimer);
 
 //----- Data -------------------------------------------------------------------
 /* welcome text */
 static const char* pcHello = "Log Message";
 
+/* Subscriber of the button events */
+static TaskHandle_t xButtonTask;
+
 //----- Implementation ---------------------------------------------------------
 
 /*******************************************************************************
@@ -90,13 +96,15 @@ int  main(void)
     LCD_SetFont(&font_8x16B);
     LCD_DisplayStringCenterLine(Y_HEADERLINE, pcHello);
 
-    /* Iniitialize and register Message Queue for Log-Message */
-    queueUart = xQueueCreate(10, sizeof(LogMsg));
-    vQueueAddToRegistry((xQueueHandle) queueUart, pcQueueLog);
+    /* UART0 for printf and the log, before any task writes */
+    vUartInit();
+
+    /* Button pins, before the button interrupts are enabled */
+    CARME_IO1_Init();
 
-    /* Create tasks, timers and start OS */
+    /* Create tasks, subscribe to the button events and start OS */
     vCreateTasks();
-    vCreateTimers();
+    vButtonInit(xButtonTask);
     vTaskStartScheduler();
 
     /* code never reached */
@@ -136,92 +144,10 @@ static void vCreateTasks(void)
                 NULL,
                 PRIORITY_DUMMY_TASK,
                 NULL);
+    xTaskCreate(ButtonTask,
+                "ButtonTask",
+                STACKSIZE_BUTTON_TASK,
+                NULL,
+                PRIORITY_BUTTON_TASK,
+                &xButtonTask);
 }
-
-/*******************************************************************************
- *  function :    vCreateTimers
- ******************************************************************************/
-/** \brief        Create all application software timer
- *
- *  \type         local
- *
- *  \return       void
- *
- ******************************************************************************/
-static void vCreateTimers(void)
-{
-
-    TimerHandle_t timerHandle;
-
-    /* Create and start timer for led chaser light */
-    timerHandle = xTimerCreate("Button",
-                               250 / portTICK_RATE_MS,
-                               pdTRUE,
-                               NULL,
-                               ButtonCallback);
-    if(timerHandle != NULL) {
-        xTimerStart(timerHandle, 0);
-    }
-}
-
-/*******************************************************************************
- *  function :    ButtonCallback
- ******************************************************************************/
-/** \brief        Get state of buttons and log a message on button press/release.
- *                Called by software timer!
- *
- *  \type         local
- *
- *  \param[in]    unused
- *
- *  \return       error code
- *
- ******************************************************************************/
-static void ButtonCallback(TimerHandle_t pxTimer)
-{
-
-    static uint8_t u8PrevBtnState = 0;
-    uint8_t u8BtnState;
-    uint8_t u8Event;
-
-    CARME_IO1_BUTTON_Get(&u8BtnState);
-
-    /* Some changes occurred? */
-    if((u8Event = u8PrevBtnState ^ u8BtnState) != 0x00) {
-
-        /* Button 0 event */
-        if(u8Event & 0x01) {
-            if(u8PrevBtnState & 0x01) {
-                logMsg("BtnCallback", "Btn0 falling edge", 0);
-            } else {
-                logMsg("BtnCallback", "Btn0 rising edge", 0);
-            }
-        }
-        /* Button 1 event */
-        if(u8Event & 0x02) {
-            if(u8PrevBtnState & 0x02) {
-                logMsg("BtnCallback", "Btn1 falling edge", 0);
-            } else {
-                logMsg("BtnCallback", "Btn1 rising edge", 0);
-            }
-        }
-        /* Button 2 event */
-        if(u8Event & 0x04) {
-            if(u8PrevBtnState & 0x04) {
-                logMsg("BtnCallback", "Btn2 falling edge", 0);
-            } else {
-                logMsg("BtnCallback", "Btn2 rising edge", 0);
-            }
-        }
-        /* Button 3 event */
-        if(u8Event & 0x08) {
-            if(u8PrevBtnState & 0x08) {
-                logMsg("BtnCallback", "Btn3 falling edge", 0);
-            } else {
-                logMsg("BtnCallback", "Btn3 rising edge", 0);
-            }
-        }
-    }
-    u8PrevBtnState = u8BtnState;
-}
-
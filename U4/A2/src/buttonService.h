@@ -0,0 +1,67 @@
+#ifndef BUTTONSERVICE_H_
+#define BUTTONSERVICE_H_
+/******************************************************************************/
+/** \file       buttonService.h
+ *******************************************************************************
+ *
+ *  \brief      Button events of the CARME IO1 board without polling. Every
+ *              button raises an EXTI interrupt on both edges, the handler
+ *              queues the edge and notifies the subscriber task at once.
+ *              The line of the button stays masked for BUTTON_DEBOUNCE_MS,
+ *              a one-shot timer then reads the settled state, queues the
+ *              edge a bounce may have hidden and unmasks the line.
+ *              The subscriber waits with xTaskNotifyWait for
+ *              BUTTON_NOTIFY_ALL and takes the events with xButtonGetEvent.
+ *              CARME_IO1_Init has to be called first, it sets up the pins.
+ *              The EXTI0, EXTI9_5 and EXTI15_10 handlers in stm32f4xx_it.c
+ *              call vButtonIrqHandler.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vButtonInit
+ *              xButtonGetEvent
+ *              u8ButtonGetState
+ *              u32ButtonGetLost
+ *              vButtonIrqHandler
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+
+//----- Macros -----------------------------------------------------------------
+#define BUTTON_COUNT          ( 4 )     /* T0..T3                             */
+#define BUTTON_DEBOUNCE_MS    ( 20 )    /* Bounces ignored after an edge      */
+#define BUTTON_QUEUE_LENGTH   ( 8 )     /* Events not yet taken               */
+
+/* Notification bits of the subscriber, one per button */
+#define BUTTON_NOTIFY_BIT(n)  ( 1UL << (n) )
+#define BUTTON_NOTIFY_ALL     ( ( 1UL << BUTTON_COUNT ) - 1 )
+
+//----- Data types -------------------------------------------------------------
+typedef enum {
+    BUTTON_EDGE_FALLING = 0,            /* Button bit changed to 0            */
+    BUTTON_EDGE_RISING  = 1             /* Button bit changed to 1            */
+} ButtonEdge_t;
+
+typedef struct {
+    uint8_t    u8Button;                /* 0..3                               */
+    uint8_t    u8Edge;                  /* ButtonEdge_t                       */
+    TickType_t xTick;                   /* Tick count of the edge             */
+} ButtonEvent_t;
+
+//----- Function prototypes ----------------------------------------------------
+extern void       vButtonInit(TaskHandle_t xSubscriber);
+extern BaseType_t xButtonGetEvent(ButtonEvent_t *psEvent, TickType_t xTimeout);
+extern uint8_t    u8ButtonGetState(void);
+extern uint32_t   u32ButtonGetLost(void);
+extern void       vButtonIrqHandler(void);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* BUTTONSERVICE_H_ */
@@ -0,0 +1,77 @@
+/******************************************************************************/
+/** \file       buttonTask.c
+ *******************************************************************************
+ *
+ *  \brief      Log a message on every button edge. The task sleeps until the
+ *              button service notifies it.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created, replaces the button timer
+ *               \li id101010, 17.10.2026, Deferred log, no text formatted
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              ButtonTask
+ *  functions  local:
+ *              .
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+#include <queue.h>
+#include <semphr.h>
+#include <timers.h>
+#include <memPoolService.h>
+
+#include "buttonTask.h"
+#include "buttonService.h"
+#include "uartTask.h"
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+
+//----- Data -------------------------------------------------------------------
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    ButtonTask
+ ******************************************************************************/
+/** \brief        Wait for button events and log every edge
+ *
+ *  \type         global
+ *
+ *  \param[in]	  pvData    not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void  ButtonTask(void *pvData)
+{
+
+    ButtonEvent_t sEvent;
+
+    for (;;) {
+        /* No CPU time until a button interrupt notifies */
+        xTaskNotifyWait(0, BUTTON_NOTIFY_ALL, NULL, portMAX_DELAY);
+
+        while (xButtonGetEvent(&sEvent, 0) == pdTRUE) {
+            logMsg("ButtonTask", "Btn%u %s edge at tick %u",
+                   (unsigned int) sEvent.u8Button,
+                   (sEvent.u8Edge == BUTTON_EDGE_RISING) ? "rising" : "falling",
+                   (unsigned int) sEvent.xTick);
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef BUTTONTASK_H_
+#define BUTTONTASK_H_
+/******************************************************************************/
+/** \file       buttonTask.h
+ *******************************************************************************
+ *
+ *  \brief      Log a message on every button edge. The task sleeps until the
+ *              button service notifies it.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    ButtonTask
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern void  ButtonTask(void *pvData);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* BUTTONTASK_H_ */
@@ -11,6 +11,7 @@
  *  \remark     Last Modification
  *               \li wht4, 13.02.2014, Created
  *               \li WBR1, 09.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Deferred log
  *
  ******************************************************************************/
 /*
@@ -60,7 +61,7 @@ void  DummyTask(void *pvData)
 {
 
     for (;;) {
-        logMsg("DummyTask", "keep running ...", portMAX_DELAY);
+        logMsg("DummyTask", "keep running ...");
         vTaskDelay(2000 / portTICK_RATE_MS);
     }
 }
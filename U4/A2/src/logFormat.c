@@ -0,0 +1,215 @@
+/******************************************************************************/
+/** \file       logFormat.c
+ *******************************************************************************
+ *
+ *  \brief      Formats a deferred log message from its format and the raw
+ *              argument words. Every conversion specification is copied
+ *              and handed with its word to snprintf, so the output is the
+ *              one the call site would have got from sprintf. Check byte of
+ *              the frames.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Check byte of the frames
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              iLogFormat
+ *              u8LogCheck
+ *  functions  local:
+ *              xLogNextArg
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+
+#include "logFormat.h"
+
+//----- Macros -----------------------------------------------------------------
+#define LOG_SPEC_LEN          ( 32 )    /* Longest conversion specification   */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static LogWord_t xLogNextArg(const LogWord_t *pxArgs, uint8_t u8Args,
+                             uint8_t *pu8Arg);
+
+//----- Data -------------------------------------------------------------------
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    iLogFormat
+ ******************************************************************************/
+/** \brief        Format a message into pcBuf. Missing words are taken as 0,
+ *                a %s whose address is unknown is written as the address.
+ *
+ *  \type         global
+ *
+ *  \param[out]   pcBuf     text, always terminated
+ *  \param[in]    uxSize    size of pcBuf, at least 1
+ *  \param[in]    pcFmt     format of the call site
+ *  \param[in]    pxArgs    argument words
+ *  \param[in]    u8Args    number of argument words
+ *  \param[in]    pfString  resolves the address of a %s argument, NULL
+ *                          if the addresses are valid here
+ *
+ *  \return       length of the text in pcBuf
+ *
+ ******************************************************************************/
+int iLogFormat(char *pcBuf, size_t uxSize, const char *pcFmt,
+               const LogWord_t *pxArgs, uint8_t u8Args,
+               LogString_t pfString)
+{
+
+    char        cSpec[LOG_SPEC_LEN];
+    size_t      uxLen = 0;
+    size_t      uxSpec;
+    uint8_t     u8Arg = 0;
+    LogWord_t   xArg;
+    const char *pcString;
+    char       *pcDst;
+    int         iAdd;
+
+    pcBuf[0] = '\0';
+    while (*pcFmt != '\0') {
+        if (*pcFmt != '%') {
+            if (uxLen + 1 < uxSize) {
+                pcBuf[uxLen++] = *pcFmt;
+                pcBuf[uxLen] = '\0';
+            }
+            pcFmt++;
+            continue;
+        }
+
+        /* Flags, width, precision and length up to the conversion */
+        uxSpec = 0;
+        cSpec[uxSpec++] = *pcFmt++;
+        while ((*pcFmt != '\0') && (strchr("-+ #0123456789.*hlzjt", *pcFmt)
+                                    != NULL)) {
+            if (uxSpec >= LOG_SPEC_LEN - 12) {
+                /* Too long, cut */
+            } else if (*pcFmt == '*') {
+                uxSpec += (size_t) snprintf(&cSpec[uxSpec],
+                                            LOG_SPEC_LEN - uxSpec, "%d",
+                                            (int) xLogNextArg(pxArgs, u8Args,
+                                                    &u8Arg));
+            } else if (strchr("lzjt", *pcFmt) == NULL) {
+                cSpec[uxSpec++] = *pcFmt;
+            }
+            pcFmt++;
+        }
+        if (*pcFmt == '\0') {
+            break;
+        }
+        cSpec[uxSpec++] = *pcFmt;
+        cSpec[uxSpec] = '\0';
+
+        pcDst = &pcBuf[uxLen];
+        switch (*pcFmt++) {
+        case 'd':
+        case 'i':
+        case 'c':
+            xArg = xLogNextArg(pxArgs, u8Args, &u8Arg);
+            iAdd = snprintf(pcDst, uxSize - uxLen, cSpec, (int) xArg);
+            break;
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            xArg = xLogNextArg(pxArgs, u8Args, &u8Arg);
+            iAdd = snprintf(pcDst, uxSize - uxLen, cSpec,
+                            (unsigned int) xArg);
+            break;
+        case 'p':
+            xArg = xLogNextArg(pxArgs, u8Args, &u8Arg);
+            iAdd = snprintf(pcDst, uxSize - uxLen, "0x%lx",
+                            (unsigned long) xArg);
+            break;
+        case 's':
+            xArg = xLogNextArg(pxArgs, u8Args, &u8Arg);
+            pcString = (const char *) xArg;
+            if (pfString != NULL) {
+                pcString = pfString(xArg);
+            }
+            if (pcString != NULL) {
+                iAdd = snprintf(pcDst, uxSize - uxLen, cSpec, pcString);
+            } else {
+                iAdd = snprintf(pcDst, uxSize - uxLen, "<0x%lx>",
+                                (unsigned long) xArg);
+            }
+            break;
+        case '%':
+            iAdd = snprintf(pcDst, uxSize - uxLen, "%%");
+            break;
+        default:
+            /* Unknown conversion, shown as written */
+            iAdd = snprintf(pcDst, uxSize - uxLen, "%s", cSpec);
+            break;
+        }
+        if (iAdd > 0) {
+            uxLen += (size_t) iAdd;
+            if (uxLen >= uxSize) {
+                uxLen = uxSize - 1;
+            }
+        }
+    }
+    return (int) uxLen;
+}
+
+/*******************************************************************************
+ *  function :    u8LogCheck
+ ******************************************************************************/
+/** \brief        Check byte of a frame: sum of the bytes, rotated left by
+ *                one bit before each add, so two swapped bytes change it too
+ *
+ *  \type         global
+ *
+ *  \param[in]    pu8Data   type, length and payload of the frame
+ *  \param[in]    uxLen     number of bytes
+ *
+ *  \return       the check byte
+ *
+ ******************************************************************************/
+uint8_t u8LogCheck(const uint8_t *pu8Data, size_t uxLen)
+{
+
+    uint8_t u8Sum = 0;
+
+    while (uxLen-- != 0) {
+        u8Sum = (uint8_t) ((u8Sum << 1) | (u8Sum >> 7));
+        u8Sum = (uint8_t) (u8Sum + *pu8Data++);
+    }
+    return u8Sum;
+}
+
+/*******************************************************************************
+ *  function :    xLogNextArg
+ ******************************************************************************/
+/** \brief        Take the next argument word
+ *
+ *  \type         local
+ *
+ *  \param[in]    pxArgs    argument words
+ *  \param[in]    u8Args    number of argument words
+ *  \param[inout] pu8Arg    index of the next word
+ *
+ *  \return       the word, 0 if there is none left
+ *
+ ******************************************************************************/
+static LogWord_t xLogNextArg(const LogWord_t *pxArgs, uint8_t u8Args,
+                             uint8_t *pu8Arg)
+{
+
+    if (*pu8Arg >= u8Args) {
+        return 0;
+    }
+    return pxArgs[(*pu8Arg)++];
+}
@@ -0,0 +1,70 @@
+#ifndef LOGFORMAT_H_
+#define LOGFORMAT_H_
+/******************************************************************************/
+/** \file       logFormat.h
+ *******************************************************************************
+ *
+ *  \brief      Frames of the deferred log and the formatting of a message
+ *              from its format and the raw argument words, as logMsg stored
+ *              them. Used by the host decoder (host/logDecode.c) and by the
+ *              gatekeeper of the host simulation, the target only sends the
+ *              words.
+ *
+ *              Frames on the UART, words 32 bit little endian:
+ *                LOG_SYNC_0, LOG_SYNC_1, type, u8 payload length, payload,
+ *                check byte (u8LogCheck of type, length and payload)
+ *              Payload of the types:
+ *                LOG_FRAME_MSG   u8 arguments, format, tick, task name,
+ *                                arguments (addresses in the ELF)
+ *                LOG_FRAME_LOST  messages lost since the last frame
+ *              The receiver takes a frame only if the sync word, the
+ *              length of its type and the check byte match, otherwise it
+ *              passes one byte through and looks again at the next one.
+ *
+ *              Every conversion takes one word: %d %i %c as int, %o %u %x
+ *              %X as unsigned int, %p as address and %s as address of a
+ *              string, resolved by the caller. Flags, width and precision
+ *              are kept, * takes a word too. The lengths l, z, j and t are
+ *              dropped, the words are 32 bit on the target.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    iLogFormat
+ *              u8LogCheck
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stddef.h>
+#include <stdint.h>
+
+//----- Macros -----------------------------------------------------------------
+#define LOG_SYNC_0            ( 0xA5 )  /* First byte of every frame          */
+#define LOG_SYNC_1            ( 0x5A )  /* Second byte of every frame         */
+#define LOG_FRAME_MSG         ( 0x01 )  /* Type of a message frame            */
+#define LOG_FRAME_LOST        ( 0x02 )  /* Type of a lost messages frame      */
+#define LOG_HEADER_WORDS      ( 3 )     /* Format, tick and task name         */
+#define LOG_MAX_ARGS          ( 6 )     /* Argument words per message         */
+
+#define LOG_FRAME_HEAD        ( 4 )     /* Sync word, type and length         */
+#define LOG_MSG_LEN(n)        ( 1 + 4 * (LOG_HEADER_WORDS + (n)) ) /* Payload */
+#define LOG_LOST_LEN          ( 4 )     /* Payload of LOG_FRAME_LOST          */
+#define LOG_FRAME_MAX         ( LOG_FRAME_HEAD + LOG_MSG_LEN(LOG_MAX_ARGS) + 1 )
+
+//----- Data types -------------------------------------------------------------
+typedef uintptr_t LogWord_t;            /* Argument word of a log message     */
+
+/* Text of a %s argument, NULL if the address is not known */
+typedef const char *(*LogString_t)(LogWord_t xAddress);
+
+//----- Function prototypes ----------------------------------------------------
+extern int iLogFormat(char *pcBuf, size_t uxSize, const char *pcFmt,
+                      const LogWord_t *pxArgs, uint8_t u8Args,
+                      LogString_t pfString);
+extern uint8_t u8LogCheck(const uint8_t *pu8Data, size_t uxLen);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* LOGFORMAT_H_ */
@@ -45,6 +45,8 @@ extern "C" {
 #include <carme.h>					/* CARME Module							*/
 #include <can.h>					/* CARME CAN Module						*/
 #include "stm32f4xx_it.h"
+#include "buttonService.h"
+#include "uartService.h"
 
 /*----- Macros -------------------------------------------------------------*/
 
@@ -134,7 +136,20 @@ void DebugMon_Handler(void)
 
 /**
  *****************************************************************************
- * @brief		This function handles the EXTI Lines 9:5.
+ * @brief		This function handles the EXTI Line 0 (button T3).
+ *
+ * @return		None
+ *****************************************************************************
+ */
+void EXTI0_IRQHandler(void)
+{
+
+    vButtonIrqHandler();
+}
+
+/**
+ *****************************************************************************
+ * @brief		This function handles the EXTI Lines 9:5 (button T0, CAN).
  *
  * @return		None
  *****************************************************************************
@@ -146,6 +161,34 @@ void EXTI9_5_IRQHandler(void)
         CARME_CAN_Interrupt_Handler();
         EXTI_ClearITPendingBit(CARME_GPIO_TO_EXTILINE(GPIO_Pin_8));
     }
+    vButtonIrqHandler();
+}
+
+/**
+ *****************************************************************************
+ * @brief		This function handles the EXTI Lines 15:10 (buttons T1, T2).
+ *
+ * @return		None
+ *****************************************************************************
+ */
+void EXTI15_10_IRQHandler(void)
+{
+
+    vButtonIrqHandler();
+}
+
+/**
+ *****************************************************************************
+ * @brief		This function handles the USART1 interrupt (UART0 receive and
+ *				transmit).
+ *
+ * @return		None
+ *****************************************************************************
+ */
+void USART1_IRQHandler(void)
+{
+
+    vUartIrqHandler();
 }
 
 #ifdef __cplusplus
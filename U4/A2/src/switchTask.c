@@ -11,6 +11,7 @@
  *  \remark     Last Modification
  *               \li wht4, 13.02.2014, Created
  *               \li WBR1, 09.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Deferred log, no text formatted
  *
  ******************************************************************************/
 /*
@@ -62,8 +63,6 @@ void  SwitchTask(void *pvData)
 
     uint8_t u8SwitchStatePrev = 0;
     uint8_t u8SwitchState;
-    char cLogMsg[LOG_MESSAGE_SIZE];
-
 
     CARME_IO1_Init();
     CARME_IO1_LED_Set(0x00, 0xff);
@@ -74,8 +73,8 @@ void  SwitchTask(void *pvData)
         if(u8SwitchStatePrev != u8SwitchState) {
 
             CARME_IO1_LED_Set(u8SwitchState, 0xff);
-            sprintf(cLogMsg, "Switch state chaged to: 0x%x", u8SwitchState);
-            logMsg("SwitchTask", cLogMsg, portMAX_DELAY);
+            logMsg("SwitchTask", "Switch state chaged to: 0x%x",
+                   u8SwitchState);
             u8SwitchStatePrev = u8SwitchState;
         }
 
@@ -43,6 +43,7 @@ extern "C" {
 #include <sys/time.h>
 #include <sys/times.h>
 #include <stm32f4xx.h>
+#include "uartService.h"
 
 /*----- Macros -------------------------------------------------------------*/
 #ifndef SYSCALL_USART
@@ -106,20 +107,12 @@ void _exit(int32_t status)
 int _write(int fd, char *str, int len)
 {
 
-    uint8_t i = 0U;
-
     if (str == NULL) {
         return -1;
     }
 
-    for (i = 0U; i < len; i++) {
-        while (USART_GetFlagStatus(SYSCALL_USART, USART_FLAG_TC) == RESET) {
-        }
-        USART_SendData(SYSCALL_USART, (uint16_t) *str);
-        str++;
-    }
-
-    return len;
+    /* Copied into the ring of the TXE interrupt, see uartService.h */
+    return iUartWrite(str, len);
 }
 
 caddr_t _sbrk(int32_t incr)
@@ -175,27 +168,12 @@ int _lseek(int32_t file, int32_t ptr, int32_t dir)
 int _read(int32_t file, uint8_t *ptr, int32_t len)
 {
 
-    uint32_t i = 0U;
-    uint16_t res = 0U;
-
     if (ptr == NULL) {
         return -1;
     }
 
-    for (i = 0U; i < len; i++) {
-
-        if (USART_GetFlagStatus(SYSCALL_USART, USART_FLAG_RXNE) == SET) {
-            res = USART_ReceiveData(SYSCALL_USART);
-            if (res <= 0xFF) {
-                *ptr = (uint8_t) (res & 0xFF);
-                ptr++;
-            }
-        } else {
-            break;
-        }
-    }
-
-    return (int) i;
+    /* Block until a byte, or a line in line mode, was received */
+    return iUartRead((char *) ptr, (int) len, portMAX_DELAY);
 }
 
 int _open(uint8_t *path, int32_t flags, ...)
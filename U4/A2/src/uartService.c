@@ -0,0 +1,750 @@
+/******************************************************************************/
+/** \file       uartService.c
+ *******************************************************************************
+ *
+ *  \brief      Transmission on CARME UART0 through a ring drained by the
+ *              TXE interrupt, one byte per interrupt. Reception through a
+ *              ring filled by the RXNE interrupt.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Interrupt driven reception
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vUartInit
+ *              iUartWrite
+ *              iUartTryWrite
+ *              vUartFlush
+ *              iUartRead
+ *              iUartReadLine
+ *              vUartSetLineMode
+ *              u32UartGetRxOverrun
+ *              u32UartGetRxLost
+ *              u32UartTxCyclesPerKb
+ *              vUartIrqHandler
+ *  functions  local:
+ *              iUartPut
+ *              vUartWait
+ *              vUartPoll
+ *              u8UartRxGet
+ *              u8UartRxReady
+ *              xUartRxWait
+ *              iUartRxPoll
+ *              u8UartRunning
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <string.h>
+
+#include <carme.h>                      /* CARME Module                       */
+#include <uart.h>                       /* CARME UART Module                  */
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+#include <semphr.h>
+
+#include "uartService.h"
+
+//----- Macros -----------------------------------------------------------------
+#define UART_USART            CARME_UART0
+#define UART_IRQ_PRIORITY     ( 0x0F )  /* Lowest, the handler uses FromISR   */
+#define UART_IS_EOL(c)        ( ((c) == '\r') || ((c) == '\n') )
+
+/* Compiler switch to measure the cost of the transmission */
+//#define UART_PROFILE                  /* Set to count cycles per byte       */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static int iUartPut(const char *pcData, int iLen);
+static void vUartWait(uint32_t u32Free);
+static void vUartPoll(void);
+static uint8_t u8UartRxGet(uint8_t *pu8Byte);
+static uint8_t u8UartRxReady(uint8_t u8Line);
+static BaseType_t xUartRxWait(uint8_t u8Line, TimeOut_t *psTimeOut,
+                              TickType_t *pxTicks);
+static int iUartRxPoll(char *pcData, int iLen);
+static uint8_t u8UartRunning(void);
+
+//----- Data -------------------------------------------------------------------
+static uint8_t           u8TxRing[UART_TX_RING_SIZE];
+static volatile uint32_t u32TxHead;     /* Bytes written, by the writers      */
+static volatile uint32_t u32TxTail;     /* Bytes sent, by the handler         */
+static volatile uint32_t u32TxNeed;     /* Free bytes the writer waits for    */
+static SemaphoreHandle_t xTxMutex;      /* One writer at a time               */
+static SemaphoreHandle_t xTxSpace;      /* Given once u32TxNeed bytes free    */
+
+static uint8_t           u8RxRing[UART_RX_RING_SIZE];
+static volatile uint32_t u32RxHead;     /* Bytes received, by the handler     */
+static volatile uint32_t u32RxTail;     /* Bytes read, by the reader          */
+static volatile uint32_t u32RxLines;    /* Line ends in the ring              */
+static volatile uint32_t u32RxOverrun;  /* Bytes lost in the USART            */
+static volatile uint32_t u32RxLost;     /* Bytes lost, the ring was full      */
+static volatile uint8_t  u8RxWaiting;   /* The reader sleeps on xRxData       */
+static uint8_t           u8RxWaitLine;  /* The reader waits for a whole line  */
+static uint8_t           u8RxLineMode;  /* iUartRead returns whole lines      */
+static uint8_t           u8RxCr;        /* The last line ended with '\r'      */
+static SemaphoreHandle_t xRxMutex;      /* One reader at a time               */
+static SemaphoreHandle_t xRxData;       /* Given once the reader is ready     */
+
+#ifdef UART_PROFILE
+/* Cycles of copying and of the handler, without interrupt entry and exit */
+static uint32_t u32TxCycles;
+static uint32_t u32TxBytes;
+#endif
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vUartInit
+ ******************************************************************************/
+/** \brief        Initialize UART0 with UART_BAUDRATE, create the semaphores
+ *                and enable the USART1 interrupt, receiving at once. Call
+ *                before the scheduler is started.
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vUartInit(void)
+{
+
+    USART_InitTypeDef USART_InitStruct;
+    NVIC_InitTypeDef  NVIC_InitStruct;
+
+    USART_StructInit(&USART_InitStruct);
+    USART_InitStruct.USART_BaudRate = UART_BAUDRATE;
+    CARME_UART_Init(UART_USART, &USART_InitStruct);
+
+    xTxMutex = xSemaphoreCreateMutex();
+    vQueueAddToRegistry(xTxMutex, "UartTxMutex");
+    xTxSpace = xSemaphoreCreateBinary();
+    xRxMutex = xSemaphoreCreateMutex();
+    vQueueAddToRegistry(xRxMutex, "UartRxMutex");
+    xRxData = xSemaphoreCreateBinary();
+
+    USART_ITConfig(UART_USART, USART_IT_RXNE, ENABLE);
+    NVIC_InitStruct.NVIC_IRQChannel = USART1_IRQn;
+    NVIC_InitStruct.NVIC_IRQChannelPreemptionPriority = UART_IRQ_PRIORITY;
+    NVIC_InitStruct.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStruct.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStruct);
+
+#ifdef UART_PROFILE
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/*******************************************************************************
+ *  function :    iUartWrite
+ ******************************************************************************/
+/** \brief        Write all bytes, blocks only while the ring is full
+ *
+ *  \type         global
+ *
+ *  \param[in]    pcData    bytes to send
+ *  \param[in]    iLen      number of bytes
+ *
+ *  \return       number of bytes written
+ *
+ ******************************************************************************/
+int iUartWrite(const char *pcData, int iLen)
+{
+
+    int iDone = 0;
+
+    if (!u8UartRunning()) {
+        /* No interrupts yet, send what is in the ring at once */
+        do {
+            iDone += iUartPut(&pcData[iDone], iLen - iDone);
+            vUartPoll();
+        } while (iDone < iLen);
+        return iLen;
+    }
+
+    xSemaphoreTake(xTxMutex, portMAX_DELAY);
+    iDone = iUartPut(pcData, iLen);
+    while (iDone < iLen) {
+        vUartWait(UART_TX_WAKE);
+        iDone += iUartPut(&pcData[iDone], iLen - iDone);
+    }
+    xSemaphoreGive(xTxMutex);
+    return iLen;
+}
+
+/*******************************************************************************
+ *  function :    iUartTryWrite
+ ******************************************************************************/
+/** \brief        Write as many bytes as the ring takes without blocking
+ *
+ *  \type         global
+ *
+ *  \param[in]    pcData    bytes to send
+ *  \param[in]    iLen      number of bytes
+ *
+ *  \return       number of bytes written, 0 if another task is writing or
+ *                vUartInit was not called
+ *
+ ******************************************************************************/
+int iUartTryWrite(const char *pcData, int iLen)
+{
+
+    int iDone;
+
+    if (xTxMutex == NULL) {
+        return 0;
+    }
+    if (!u8UartRunning()) {
+        /* Sent once the scheduler enables the interrupts */
+        return iUartPut(pcData, iLen);
+    }
+
+    if (xSemaphoreTake(xTxMutex, 0) != pdTRUE) {
+        return 0;
+    }
+    iDone = iUartPut(pcData, iLen);
+    xSemaphoreGive(xTxMutex);
+    return iDone;
+}
+
+/*******************************************************************************
+ *  function :    vUartFlush
+ ******************************************************************************/
+/** \brief        Wait until all written bytes have left the UART
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vUartFlush(void)
+{
+
+    if (!u8UartRunning()) {
+        vUartPoll();
+    } else {
+        xSemaphoreTake(xTxMutex, portMAX_DELAY);
+        vUartWait(UART_TX_RING_SIZE);
+        xSemaphoreGive(xTxMutex);
+    }
+
+    /* The last byte is shifted out within one character time */
+    while (USART_GetFlagStatus(UART_USART, USART_FLAG_TC) == RESET) {
+    }
+}
+
+/*******************************************************************************
+ *  function :    iUartRead
+ ******************************************************************************/
+/** \brief        Read the received bytes, wait up to xTimeout for the first
+ *                one. In line mode wait for a complete line and return it
+ *                with its end, or its first iLen bytes. Before the
+ *                scheduler runs only the byte in the USART is returned.
+ *
+ *  \type         global
+ *
+ *  \param[out]   pcData    received bytes, not terminated
+ *  \param[in]    iLen      size of pcData
+ *  \param[in]    xTimeout  ticks to wait, portMAX_DELAY for ever
+ *
+ *  \return       number of bytes read, 0 on timeout
+ *
+ ******************************************************************************/
+int iUartRead(char *pcData, int iLen, TickType_t xTimeout)
+{
+
+    TimeOut_t xTimeOut;
+    uint8_t   u8Byte;
+    int       iDone = 0;
+
+    if (iLen <= 0) {
+        return 0;
+    }
+    if (!u8UartRunning()) {
+        return iUartRxPoll(pcData, iLen);
+    }
+
+    vTaskSetTimeOutState(&xTimeOut);
+    if (xSemaphoreTake(xRxMutex, xTimeout) != pdTRUE) {
+        return 0;
+    }
+    if (xUartRxWait(u8RxLineMode, &xTimeOut, &xTimeout) == pdTRUE) {
+        while ((iDone < iLen) && u8UartRxGet(&u8Byte)) {
+            pcData[iDone++] = (char) u8Byte;
+            if (u8RxLineMode && UART_IS_EOL(u8Byte)) {
+                break;
+            }
+        }
+        u8RxCr = 0;
+    }
+    xSemaphoreGive(xRxMutex);
+    return iDone;
+}
+
+/*******************************************************************************
+ *  function :    iUartReadLine
+ ******************************************************************************/
+/** \brief        Read one line, wait up to xTimeout for its end. The line
+ *                ends with '\r', '\n' or "\r\n", the end is not stored.
+ *                Characters beyond iSize - 1 are dropped.
+ *
+ *  \type         global
+ *
+ *  \param[out]   pcLine    the line, terminated
+ *  \param[in]    iSize     size of pcLine, at least 1
+ *  \param[in]    xTimeout  ticks to wait, portMAX_DELAY for ever
+ *
+ *  \return       length of the line, -1 on timeout
+ *
+ ******************************************************************************/
+int iUartReadLine(char *pcLine, int iSize, TickType_t xTimeout)
+{
+
+    TimeOut_t xTimeOut;
+    uint8_t   u8Byte;
+    uint8_t   u8Eol = 0;
+    int       iLen = 0;
+
+    if ((iSize <= 0) || !u8UartRunning()) {
+        return -1;
+    }
+
+    vTaskSetTimeOutState(&xTimeOut);
+    if (xSemaphoreTake(xRxMutex, xTimeout) != pdTRUE) {
+        return -1;
+    }
+    while (!u8Eol) {
+        /* A line longer than the ring is taken in pieces */
+        if (xUartRxWait(1, &xTimeOut, &xTimeout) != pdTRUE) {
+            break;
+        }
+        while (!u8Eol && u8UartRxGet(&u8Byte)) {
+            if (!UART_IS_EOL(u8Byte)) {
+                if (iLen < iSize - 1) {
+                    pcLine[iLen++] = (char) u8Byte;
+                }
+                u8RxCr = 0;
+            } else if ((u8Byte == '\n') && u8RxCr && (iLen == 0)) {
+                /* Second half of "\r\n" */
+                u8RxCr = 0;
+            } else {
+                u8RxCr = (uint8_t) (u8Byte == '\r');
+                u8Eol = 1;
+            }
+        }
+    }
+    /* Take the '\n' of "\r\n" along if it is there already */
+    if (u8Eol && u8RxCr && (u32RxTail != u32RxHead) &&
+            (u8RxRing[u32RxTail % UART_RX_RING_SIZE] == '\n')) {
+        u8UartRxGet(&u8Byte);
+        u8RxCr = 0;
+    }
+    xSemaphoreGive(xRxMutex);
+
+    pcLine[iLen] = '\0';
+    return u8Eol ? iLen : -1;
+}
+
+/*******************************************************************************
+ *  function :    vUartSetLineMode
+ ******************************************************************************/
+/** \brief        Switch iUartRead, and so _read, between bytes and lines
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8Enable  1 to return complete lines, 0 for bytes
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vUartSetLineMode(uint8_t u8Enable)
+{
+
+    u8RxLineMode = (uint8_t) (u8Enable != 0);
+}
+
+/*******************************************************************************
+ *  function :    u32UartGetRxOverrun
+ ******************************************************************************/
+/** \brief        Number of bytes lost in the USART, the handler was late
+ *
+ *  \type         global
+ *
+ *  \return       overruns since start
+ *
+ ******************************************************************************/
+uint32_t u32UartGetRxOverrun(void)
+{
+
+    return u32RxOverrun;
+}
+
+/*******************************************************************************
+ *  function :    u32UartGetRxLost
+ ******************************************************************************/
+/** \brief        Number of received bytes dropped because the ring was full
+ *
+ *  \type         global
+ *
+ *  \return       lost bytes since start
+ *
+ ******************************************************************************/
+uint32_t u32UartGetRxLost(void)
+{
+
+    return u32RxLost;
+}
+
+/*******************************************************************************
+ *  function :    u32UartTxCyclesPerKb
+ ******************************************************************************/
+/** \brief        Core clock cycles spent per 1024 bytes written since the
+ *                last call, for copying and in the handler. Counted only
+ *                with UART_PROFILE set.
+ *
+ *  \type         global
+ *
+ *  \return       cycles per KB, 0 without UART_PROFILE or bytes
+ *
+ ******************************************************************************/
+uint32_t u32UartTxCyclesPerKb(void)
+{
+
+#ifdef UART_PROFILE
+    uint32_t u32Cycles;
+    uint32_t u32Bytes;
+
+    taskENTER_CRITICAL();
+    u32Cycles = u32TxCycles;
+    u32Bytes = u32TxBytes;
+    u32TxCycles = 0;
+    u32TxBytes = 0;
+    taskEXIT_CRITICAL();
+
+    if (u32Bytes != 0) {
+        return (uint32_t) (((uint64_t) u32Cycles * 1024) / u32Bytes);
+    }
+#endif
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    vUartIrqHandler
+ ******************************************************************************/
+/** \brief        USART1 interrupt. Stores a received byte and wakes the
+ *                reader once it has what it waits for. Sends the next byte
+ *                of the transmit ring, disables the TXE interrupt when the
+ *                ring is empty and wakes the waiting writer.
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vUartIrqHandler(void)
+{
+
+    BaseType_t xWoken = pdFALSE;
+    uint32_t   u32Tail;
+    uint8_t    u8Byte;
+#ifdef UART_PROFILE
+    uint32_t   u32Start;
+#endif
+
+    if (USART_GetITStatus(UART_USART, USART_IT_RXNE) != RESET) {
+        /* Overrun: a byte before this one was lost in the USART */
+        if (USART_GetFlagStatus(UART_USART, USART_FLAG_ORE) != RESET) {
+            u32RxOverrun++;
+        }
+        u8Byte = (uint8_t) USART_ReceiveData(UART_USART);
+        if ((u32RxHead - u32RxTail) < UART_RX_RING_SIZE) {
+            u8RxRing[u32RxHead % UART_RX_RING_SIZE] = u8Byte;
+            u32RxHead++;
+            if (UART_IS_EOL(u8Byte)) {
+                u32RxLines++;
+            }
+        } else {
+            u32RxLost++;
+        }
+        if (u8RxWaiting && u8UartRxReady(u8RxWaitLine)) {
+            u8RxWaiting = 0;
+            xSemaphoreGiveFromISR(xRxData, &xWoken);
+        }
+    }
+
+    if (USART_GetITStatus(UART_USART, USART_IT_TXE) != RESET) {
+#ifdef UART_PROFILE
+        u32Start = DWT->CYCCNT;
+#endif
+        u32Tail = u32TxTail;
+        if (u32Tail != u32TxHead) {
+            USART_SendData(UART_USART, u8TxRing[u32Tail % UART_TX_RING_SIZE]);
+            u32TxTail = ++u32Tail;
+        }
+        if (u32Tail == u32TxHead) {
+            USART_ITConfig(UART_USART, USART_IT_TXE, DISABLE);
+        }
+        if ((u32TxNeed != 0) &&
+                (UART_TX_RING_SIZE - (u32TxHead - u32Tail) >= u32TxNeed)) {
+            u32TxNeed = 0;
+            xSemaphoreGiveFromISR(xTxSpace, &xWoken);
+        }
+#ifdef UART_PROFILE
+        u32TxCycles += DWT->CYCCNT - u32Start;
+#endif
+    }
+
+    portYIELD_FROM_ISR(xWoken);
+}
+
+/*******************************************************************************
+ *  function :    iUartPut
+ ******************************************************************************/
+/** \brief        Copy as many bytes as fit into the ring and enable the TXE
+ *                interrupt. The caller is the only writer.
+ *
+ *  \type         local
+ *
+ *  \param[in]    pcData    bytes to send
+ *  \param[in]    iLen      number of bytes
+ *
+ *  \return       number of bytes copied
+ *
+ ******************************************************************************/
+static int iUartPut(const char *pcData, int iLen)
+{
+
+    uint32_t u32Head = u32TxHead;
+    uint32_t u32Index = u32Head % UART_TX_RING_SIZE;
+    uint32_t u32Len = UART_TX_RING_SIZE - (u32Head - u32TxTail);
+    uint32_t u32First;
+#ifdef UART_PROFILE
+    uint32_t u32Start = DWT->CYCCNT;
+#endif
+
+    if (iLen <= 0) {
+        return 0;
+    }
+    if ((uint32_t) iLen < u32Len) {
+        u32Len = (uint32_t) iLen;
+    }
+    u32First = UART_TX_RING_SIZE - u32Index;
+    if (u32First > u32Len) {
+        u32First = u32Len;
+    }
+    memcpy(&u8TxRing[u32Index], pcData, u32First);
+    memcpy(u8TxRing, &pcData[u32First], u32Len - u32First);
+
+    /* The handler disables the interrupt when it finds the ring empty */
+    taskENTER_CRITICAL();
+    u32TxHead = u32Head + u32Len;
+    if (u32Len != 0) {
+        USART_ITConfig(UART_USART, USART_IT_TXE, ENABLE);
+    }
+#ifdef UART_PROFILE
+    u32TxCycles += DWT->CYCCNT - u32Start;
+    u32TxBytes += u32Len;
+#endif
+    taskEXIT_CRITICAL();
+    return (int) u32Len;
+}
+
+/*******************************************************************************
+ *  function :    vUartWait
+ ******************************************************************************/
+/** \brief        Block until the handler has freed u32Free bytes
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32Free   free bytes to wait for, UART_TX_RING_SIZE to
+ *                          wait until everything is sent
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vUartWait(uint32_t u32Free)
+{
+
+    uint8_t u8Wait;
+
+    taskENTER_CRITICAL();
+    u8Wait = (UART_TX_RING_SIZE - (u32TxHead - u32TxTail)) < u32Free;
+    if (u8Wait) {
+        u32TxNeed = u32Free;
+    }
+    taskEXIT_CRITICAL();
+
+    if (u8Wait) {
+        xSemaphoreTake(xTxSpace, portMAX_DELAY);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vUartPoll
+ ******************************************************************************/
+/** \brief        Send the ring by polling, while there are no interrupts
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vUartPoll(void)
+{
+
+    while (u32TxTail != u32TxHead) {
+        while (USART_GetFlagStatus(UART_USART, USART_FLAG_TXE) == RESET) {
+        }
+        USART_SendData(UART_USART, u8TxRing[u32TxTail % UART_TX_RING_SIZE]);
+        u32TxTail++;
+    }
+}
+
+/*******************************************************************************
+ *  function :    u8UartRxGet
+ ******************************************************************************/
+/** \brief        Take the oldest received byte. The caller is the only
+ *                reader.
+ *
+ *  \type         local
+ *
+ *  \param[out]   pu8Byte   the byte
+ *
+ *  \return       1 if a byte was taken, 0 if the ring is empty
+ *
+ ******************************************************************************/
+static uint8_t u8UartRxGet(uint8_t *pu8Byte)
+{
+
+    uint32_t u32Tail = u32RxTail;
+
+    if (u32Tail == u32RxHead) {
+        return 0;
+    }
+    *pu8Byte = u8RxRing[u32Tail % UART_RX_RING_SIZE];
+    if (UART_IS_EOL(*pu8Byte)) {
+        taskENTER_CRITICAL();
+        u32RxLines--;
+        taskEXIT_CRITICAL();
+    }
+    u32RxTail = u32Tail + 1;
+    return 1;
+}
+
+/*******************************************************************************
+ *  function :    u8UartRxReady
+ ******************************************************************************/
+/** \brief        The reader has what it waits for: a byte, or a line end or
+ *                a full ring in line mode. Called by the handler and with
+ *                interrupts masked.
+ *
+ *  \type         local
+ *
+ *  \param[in]    u8Line    1 to wait for a whole line
+ *
+ *  \return       1 if ready, 0 otherwise
+ *
+ ******************************************************************************/
+static uint8_t u8UartRxReady(uint8_t u8Line)
+{
+
+    uint32_t u32Used = u32RxHead - u32RxTail;
+
+    if (!u8Line) {
+        return (uint8_t) (u32Used != 0);
+    }
+    return (uint8_t) ((u32RxLines != 0) || (u32Used == UART_RX_RING_SIZE));
+}
+
+/*******************************************************************************
+ *  function :    xUartRxWait
+ ******************************************************************************/
+/** \brief        Sleep on xRxData until the reader is ready or the time is
+ *                up. The semaphore belongs to the reader alone, the
+ *                notifications of the task are left alone. A give left
+ *                over from a former wait only causes another check.
+ *
+ *  \type         local
+ *
+ *  \param[in]    u8Line    1 to wait for a whole line
+ *  \param[in]    psTimeOut start of the wait
+ *  \param[inout] pxTicks   ticks left
+ *
+ *  \return       pdTRUE if ready, pdFALSE on timeout
+ *
+ ******************************************************************************/
+static BaseType_t xUartRxWait(uint8_t u8Line, TimeOut_t *psTimeOut,
+                              TickType_t *pxTicks)
+{
+
+    uint8_t u8Ready;
+
+    for (;;) {
+        taskENTER_CRITICAL();
+        u8Ready = u8UartRxReady(u8Line);
+        u8RxWaitLine = u8Line;
+        u8RxWaiting = (uint8_t) !u8Ready;
+        taskEXIT_CRITICAL();
+        if (u8Ready) {
+            return pdTRUE;
+        }
+
+        if (xTaskCheckForTimeOut(psTimeOut, pxTicks) != pdFALSE) {
+            u8RxWaiting = 0;
+            return pdFALSE;
+        }
+        xSemaphoreTake(xRxData, *pxTicks);
+    }
+}
+
+/*******************************************************************************
+ *  function :    iUartRxPoll
+ ******************************************************************************/
+/** \brief        Read the bytes waiting in the USART, while there are no
+ *                interrupts
+ *
+ *  \type         local
+ *
+ *  \param[out]   pcData    received bytes
+ *  \param[in]    iLen      size of pcData
+ *
+ *  \return       number of bytes read
+ *
+ ******************************************************************************/
+static int iUartRxPoll(char *pcData, int iLen)
+{
+
+    int iDone = 0;
+
+    while ((iDone < iLen) &&
+            (USART_GetFlagStatus(UART_USART, USART_FLAG_RXNE) == SET)) {
+        pcData[iDone++] = (char) USART_ReceiveData(UART_USART);
+    }
+    return iDone;
+}
+
+/*******************************************************************************
+ *  function :    u8UartRunning
+ ******************************************************************************/
+/** \brief        The ring is drained by the interrupt: vUartInit was called
+ *                and the scheduler has enabled the interrupts.
+ *
+ *  \type         local
+ *
+ *  \return       1 if running, 0 if the bytes are polled out
+ *
+ ******************************************************************************/
+static uint8_t u8UartRunning(void)
+{
+
+    return (uint8_t) ((xTxMutex != NULL) &&
+                      (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED));
+}
@@ -0,0 +1,78 @@
+#ifndef UARTSERVICE_H_
+#define UARTSERVICE_H_
+/******************************************************************************/
+/** \file       uartService.h
+ *******************************************************************************
+ *
+ *  \brief      Interrupt driven UART0 of the CARME module. Writers copy
+ *              their bytes into a ring of UART_TX_RING_SIZE bytes and
+ *              return, the TXE interrupt sends one byte after the other.
+ *              A writer blocks only while the ring is full, it is woken
+ *              once UART_TX_WAKE bytes are free again. Writers are
+ *              serialized, the bytes of one call are never interleaved with
+ *              those of another task.
+ *              _write in syscalls.c calls iUartWrite, so printf goes through
+ *              the ring too. Before the scheduler runs, or before vUartInit,
+ *              the bytes are sent by polling.
+ *              The RXNE interrupt stores the received bytes in a ring of
+ *              UART_RX_RING_SIZE bytes and counts the bytes lost in the
+ *              USART (overrun) and those lost because the ring was full.
+ *              A reader sleeps in iUartRead or iUartReadLine until data
+ *              arrives or its timeout expires, the handler wakes it with
+ *              a binary semaphore of its own, so the notifications of the
+ *              reading task stay untouched. In line mode iUartRead,
+ *              and so _read, returns only complete lines. iUartReadLine
+ *              returns one line without its end, like
+ *              CARME_UART_ReceiveString but without polling.
+ *              vUartInit is called before the scheduler is started, the
+ *              USART1 handler in stm32f4xx_it.c calls vUartIrqHandler.
+ *              All functions but vUartIrqHandler are for tasks only.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vUartInit
+ *              iUartWrite
+ *              iUartTryWrite
+ *              vUartFlush
+ *              iUartRead
+ *              iUartReadLine
+ *              vUartSetLineMode
+ *              u32UartGetRxOverrun
+ *              u32UartGetRxLost
+ *              u32UartTxCyclesPerKb
+ *              vUartIrqHandler
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+
+//----- Macros -----------------------------------------------------------------
+#define UART_BAUDRATE         ( 115200 )
+#define UART_TX_RING_SIZE     ( 512 )   /* Bytes not yet sent, power of 2     */
+#define UART_TX_WAKE          ( UART_TX_RING_SIZE / 4 ) /* Free to wake       */
+#define UART_RX_RING_SIZE     ( 128 )   /* Bytes not yet read, power of 2     */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern void     vUartInit(void);
+extern int      iUartWrite(const char *pcData, int iLen);
+extern int      iUartTryWrite(const char *pcData, int iLen);
+extern void     vUartFlush(void);
+extern int      iUartRead(char *pcData, int iLen, TickType_t xTimeout);
+extern int      iUartReadLine(char *pcLine, int iSize, TickType_t xTimeout);
+extern void     vUartSetLineMode(uint8_t u8Enable);
+extern uint32_t u32UartGetRxOverrun(void);
+extern uint32_t u32UartGetRxLost(void);
+extern uint32_t u32UartTxCyclesPerKb(void);
+extern void     vUartIrqHandler(void);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* UARTSERVICE_H_ */
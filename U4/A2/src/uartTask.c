@@ -2,7 +2,8 @@
 /** \file       uartTask.c
  *******************************************************************************
  *
- *  \brief      Gatekeeper task for uart0. Write arriving Log-Msg to the uart
+ *  \brief      Deferred log. logMsg stores the words of a message in a
+ *              ring, the gatekeeper task for uart0 sends them as frames.
  *
  *  \author     wht4
  *
@@ -13,14 +14,22 @@
  *               \li wht4, 06.01.2015, Migrated to FreeRTOS V8.0.0
  *               \li wbr1, 01.04.2016, Comments modified
  *               \li WBR1, 09.02.2017, minor optimizations
+ *               \li id101010, 17.10.2026, Bounded copies, LOG_PROFILE
+ *               \li id101010, 17.10.2026, Deferred binary log in a ring
+ *               \li id101010, 17.10.2026, Frames through the uartService
+ *               \li id101010, 17.10.2026, Sync word and check byte
  *
  ******************************************************************************/
 /*
  *  functions  global:
  *              UartTask
- *              logMsg
+ *              vLogDefer
  *  functions  local:
- *              .
+ *              u32LogTake
+ *              vLogSend
+ *              vLogLost
+ *              vLogFrame
+ *              vLogProfile
  *
  ******************************************************************************/
 
@@ -28,6 +37,7 @@
 #include <carme.h>
 #include <uart.h>
 #include <stdio.h>
+#include <stdarg.h>
 
 #include <FreeRTOS.h>                   /* All freeRTOS headers               */
 #include <task.h>
@@ -37,22 +47,51 @@
 #include <memPoolService.h>
 
 #include "uartTask.h"
+#include "uartService.h"
 
 //----- Macros -----------------------------------------------------------------
+#define LOG_RECORD_WORDS      ( 1 + LOG_HEADER_WORDS + LOG_MAX_ARGS )
+#define LOG_PROFILE_COUNT     ( 32 )    /* Messages per profile report        */
+
+/* Compiler switch to measure the cost of logging */
+//#define LOG_PROFILE                   /* Set to report cycles and stacks    */
 
 //----- Data types -------------------------------------------------------------
 
 //----- Function prototypes ----------------------------------------------------
+static uint32_t u32LogTake(LogWord_t *pxRecord);
+static void vLogSend(const LogWord_t *pxRecord);
+static void vLogLost(uint32_t u32Lost);
+#ifndef CARME_SIM
+static void vLogFrame(uint8_t *pu8Frame, uint8_t u8Type, uint32_t u32Len);
+#endif
+#ifdef LOG_PROFILE
+static void vLogProfile(uint32_t u32Cycles);
+#endif
 
 //----- Data -------------------------------------------------------------------
-QueueHandle_t queueUart;
+/* Records: number of arguments, format, tick, task name, arguments */
+static LogWord_t xLogRing[LOG_RING_WORDS];
+static uint32_t  u32LogHead;            /* Words written, by logMsg           */
+static uint32_t  u32LogTail;            /* Words taken, by UartTask           */
+static uint32_t  u32LogLost;            /* Messages dropped, ring was full    */
+
+#ifdef LOG_PROFILE
+/* logMsg statistics, written by all logging tasks */
+static uint32_t    u32LogCalls;
+static uint32_t    u32LogCycles;
+static uint32_t    u32LogMax;
+static UBaseType_t uxLogStackMin = ~((UBaseType_t) 0);
+static const char *pcLogStackMin = "-";
+#endif
 
 //----- Implementation ---------------------------------------------------------
 
 /*******************************************************************************
  *  function :    UartTask
  ******************************************************************************/
-/** \brief        Writes arriving Log msg to the Uart.
+/** \brief        Sends the records of the ring to the Uart every
+ *                LOG_DRAIN_MS, and the number of dropped messages.
  *
  *  \type         global
  *
@@ -64,47 +103,306 @@ QueueHandle_t queueUart;
 void  UartTask(void *pvData)
 {
 
-    USART_InitTypeDef USART_InitStruct;
-    LogMsg            sLogMsg;
-
-    /* Initialize UART */
-    USART_StructInit(&USART_InitStruct);
-    USART_InitStruct.USART_BaudRate = 115200;
-    CARME_UART_Init(CARME_UART0, &USART_InitStruct);
+    LogWord_t xRecord[LOG_RECORD_WORDS];
+    uint32_t  u32Lost;
+#ifdef LOG_PROFILE
+    uint32_t  u32Start;
+#endif
 
+    /* UART0 is initialized by vUartInit in main */
     for (;;) {
-        if(xQueueReceive(queueUart, &sLogMsg, portMAX_DELAY) == pdTRUE) {
+        vTaskDelay(LOG_DRAIN_MS / portTICK_RATE_MS);
 
-            printf("%d:  %s  '%s'\n\r", (int) sLogMsg.xTimeTag,
-                   sLogMsg.cTaskName,
-                   sLogMsg.cMsg);
+        while (u32LogTake(xRecord) != 0) {
+#ifdef LOG_PROFILE
+            u32Start = DWT->CYCCNT;
+#endif
+            vLogSend(xRecord);
+#ifdef LOG_PROFILE
+            vLogProfile(DWT->CYCCNT - u32Start);
+#endif
+        }
+
+        taskENTER_CRITICAL();
+        u32Lost = u32LogLost;
+        u32LogLost = 0;
+        taskEXIT_CRITICAL();
+        if (u32Lost != 0) {
+            vLogLost(u32Lost);
         }
     }
 }
 
 /*******************************************************************************
- *  function :    logMsg
+ *  function :    vLogDefer
  ******************************************************************************/
-/** \brief        Send a log message to the uart gatekeeper task.
+/** \brief        Store a log message for the uart gatekeeper task, called
+ *                by the macro logMsg. Nothing is formatted, the message is
+ *                dropped if the ring is full.
  *
  *  \type         global
  *
  *  \param[in]	  pcTaskName    name of the task putting the log message
- *  \param[in]	  pcMsg         log message to send
- *  \param[in]	  xWaitTime     waiting time if queue is full
+ *  \param[in]	  pcFmt         format of the message, a string constant
+ *  \param[in]	  u8Args        number of arguments
+ *  \param[in]	  ...           arguments, each a LogWord_t
  *
  *  \return       void
  *
  ******************************************************************************/
-void logMsg(char * pcTaskName, char * pcMsg, portTickType xWaitTime)
+void vLogDefer(const char *pcTaskName, const char *pcFmt, uint8_t u8Args, ...)
 {
 
-    LogMsg sLogMsg;
+    va_list  va;
+    uint32_t u32Head;
+    uint8_t  u8Arg;
+#ifdef LOG_PROFILE
+    uint32_t    u32Cycles;
+    UBaseType_t uxStack;
+
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    u32Cycles = DWT->CYCCNT;
+#endif
+
+    if (u8Args > LOG_MAX_ARGS) {
+        u8Args = LOG_MAX_ARGS;
+    }
+
+    va_start(va, u8Args);
+    taskENTER_CRITICAL();
+    if ((LOG_RING_WORDS - (u32LogHead - u32LogTail)) <
+            (uint32_t) (1 + LOG_HEADER_WORDS + u8Args)) {
+        u32LogLost++;
+    } else {
+        u32Head = u32LogHead;
+        xLogRing[u32Head++ % LOG_RING_WORDS] = u8Args;
+        xLogRing[u32Head++ % LOG_RING_WORDS] = (LogWord_t) pcFmt;
+        xLogRing[u32Head++ % LOG_RING_WORDS] = xTaskGetTickCount();
+        xLogRing[u32Head++ % LOG_RING_WORDS] = (LogWord_t) pcTaskName;
+        for (u8Arg = 0; u8Arg < u8Args; u8Arg++) {
+            xLogRing[u32Head++ % LOG_RING_WORDS] = va_arg(va, LogWord_t);
+        }
+        u32LogHead = u32Head;
+    }
+    taskEXIT_CRITICAL();
+    va_end(va);
+
+#ifdef LOG_PROFILE
+    u32Cycles = DWT->CYCCNT - u32Cycles;
+    uxStack = uxTaskGetStackHighWaterMark(NULL);
+    taskENTER_CRITICAL();
+    u32LogCalls++;
+    u32LogCycles += u32Cycles;
+    if (u32Cycles > u32LogMax) {
+        u32LogMax = u32Cycles;
+    }
+    if (uxStack < uxLogStackMin) {
+        uxLogStackMin = uxStack;
+        pcLogStackMin = pcTaskName;
+    }
+    taskEXIT_CRITICAL();
+#endif
+}
+
+/*******************************************************************************
+ *  function :    u32LogTake
+ ******************************************************************************/
+/** \brief        Take the oldest record out of the ring
+ *
+ *  \type         local
+ *
+ *  \param[out]   pxRecord  number of arguments, format, tick, task name,
+ *                          arguments
+ *
+ *  \return       words of the record, 0 if the ring is empty
+ *
+ ******************************************************************************/
+static uint32_t u32LogTake(LogWord_t *pxRecord)
+{
+
+    uint32_t u32Words = 0;
+    uint32_t u32Word;
+
+    taskENTER_CRITICAL();
+    if (u32LogTail != u32LogHead) {
+        u32Words = 1 + LOG_HEADER_WORDS +
+                   (uint32_t) xLogRing[u32LogTail % LOG_RING_WORDS];
+        for (u32Word = 0; u32Word < u32Words; u32Word++) {
+            pxRecord[u32Word] = xLogRing[u32LogTail++ % LOG_RING_WORDS];
+        }
+    }
+    taskEXIT_CRITICAL();
+    return u32Words;
+}
+
+/*******************************************************************************
+ *  function :    vLogSend
+ ******************************************************************************/
+/** \brief        Send one record as LOG_FRAME_MSG frame. The host simulation
+ *                has no ELF of the target, it formats the message itself.
+ *
+ *  \type         local
+ *
+ *  \param[in]    pxRecord  number of arguments, format, tick, task name,
+ *                          arguments
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vLogSend(const LogWord_t *pxRecord)
+{
+
+#ifdef CARME_SIM
+    char cMsg[128];
+    char cLine[160];
+    int  iLen;
+
+    iLogFormat(cMsg, sizeof(cMsg), (const char *) pxRecord[1], &pxRecord[4],
+               (uint8_t) pxRecord[0], NULL);
+    iLen = snprintf(cLine, sizeof(cLine), "%u:  %s  '%s'\n\r",
+                    (unsigned int) pxRecord[2], (const char *) pxRecord[3],
+                    cMsg);
+    if (iLen >= (int) sizeof(cLine)) {
+        iLen = sizeof(cLine) - 1;
+    }
+    iUartWrite(cLine, iLen);
+#else
+    uint8_t  u8Frame[LOG_FRAME_MAX];
+    uint32_t u32Word;
+    uint32_t u32Len = LOG_FRAME_HEAD;
+
+    u8Frame[u32Len++] = (uint8_t) pxRecord[0];
+    for (u32Word = 1; u32Word <= LOG_HEADER_WORDS + pxRecord[0]; u32Word++) {
+        u8Frame[u32Len++] = (uint8_t) pxRecord[u32Word];
+        u8Frame[u32Len++] = (uint8_t) (pxRecord[u32Word] >> 8);
+        u8Frame[u32Len++] = (uint8_t) (pxRecord[u32Word] >> 16);
+        u8Frame[u32Len++] = (uint8_t) (pxRecord[u32Word] >> 24);
+    }
+    vLogFrame(u8Frame, LOG_FRAME_MSG, u32Len - LOG_FRAME_HEAD);
+#endif
+}
+
+/*******************************************************************************
+ *  function :    vLogLost
+ ******************************************************************************/
+/** \brief        Send the number of dropped messages as LOG_FRAME_LOST frame
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32Lost   messages dropped since the last frame
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vLogLost(uint32_t u32Lost)
+{
+
+#ifdef CARME_SIM
+    char cLine[32];
+
+    iUartWrite(cLine, snprintf(cLine, sizeof(cLine), "%u messages lost\n\r",
+                               (unsigned int) u32Lost));
+#else
+    uint8_t u8Frame[LOG_FRAME_HEAD + LOG_LOST_LEN + 1];
+
+    u8Frame[LOG_FRAME_HEAD] = (uint8_t) u32Lost;
+    u8Frame[LOG_FRAME_HEAD + 1] = (uint8_t) (u32Lost >> 8);
+    u8Frame[LOG_FRAME_HEAD + 2] = (uint8_t) (u32Lost >> 16);
+    u8Frame[LOG_FRAME_HEAD + 3] = (uint8_t) (u32Lost >> 24);
+    vLogFrame(u8Frame, LOG_FRAME_LOST, LOG_LOST_LEN);
+#endif
+}
+
+#ifndef CARME_SIM
+/*******************************************************************************
+ *  function :    vLogFrame
+ ******************************************************************************/
+/** \brief        Add sync word, type, length and check byte to the payload
+ *                and send the frame
+ *
+ *  \type         local
+ *
+ *  \param[inout] pu8Frame  frame, the payload at LOG_FRAME_HEAD and room
+ *                          for the check byte behind it
+ *  \param[in]    u8Type    LOG_FRAME_MSG or LOG_FRAME_LOST
+ *  \param[in]    u32Len    bytes of the payload
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vLogFrame(uint8_t *pu8Frame, uint8_t u8Type, uint32_t u32Len)
+{
+
+    pu8Frame[0] = LOG_SYNC_0;
+    pu8Frame[1] = LOG_SYNC_1;
+    pu8Frame[2] = u8Type;
+    pu8Frame[3] = (uint8_t) u32Len;
+    pu8Frame[LOG_FRAME_HEAD + u32Len] = u8LogCheck(&pu8Frame[2], 2 + u32Len);
+    iUartWrite((const char *) pu8Frame, (int) (LOG_FRAME_HEAD + u32Len + 1));
+}
+#endif
+
+#ifdef LOG_PROFILE
+/*******************************************************************************
+ *  function :    vLogProfile
+ ******************************************************************************/
+/** \brief        Count the sending of one record and log every
+ *                LOG_PROFILE_COUNT records: cycles of logMsg and of the
+ *                sending in UartTask, smallest stack high water mark
+ *                (words) of the logging tasks and of UartTask, and with
+ *                UART_PROFILE in uartService.c the UART cycles per KB.
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32Cycles  core clock cycles of the sending
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vLogProfile(uint32_t u32Cycles)
+{
+
+    static uint32_t u32Outputs;
+    static uint32_t u32OutCycles;
+    static uint32_t u32OutMax;
+    uint32_t        u32Calls;
+    uint32_t        u32Sum;
+    uint32_t        u32Max;
+    UBaseType_t     uxStack;
+    const char     *pcTask;
+
+    u32Outputs++;
+    u32OutCycles += u32Cycles;
+    if (u32Cycles > u32OutMax) {
+        u32OutMax = u32Cycles;
+    }
+    if (u32Outputs < LOG_PROFILE_COUNT) {
+        return;
+    }
 
-    sLogMsg.xTimeTag = xTaskGetTickCount();
-    sprintf(sLogMsg.cTaskName, "%s", pcTaskName);
-    sprintf(sLogMsg.cMsg, "%s", pcMsg);
+    taskENTER_CRITICAL();
+    u32Calls = u32LogCalls;
+    u32Sum = u32LogCycles;
+    u32Max = u32LogMax;
+    uxStack = uxLogStackMin;
+    pcTask = pcLogStackMin;
+    u32LogCalls = 0;
+    u32LogCycles = 0;
+    u32LogMax = 0;
+    taskEXIT_CRITICAL();
 
-    /* Send msg to gatekeeper task */
-    xQueueSend(queueUart, &sLogMsg, xWaitTime);
+    logMsg("UartTask", "logMsg cycles max %u avg %u, stack min %u words (%s)",
+           (unsigned int) u32Max,
+           (unsigned int) ((u32Calls != 0) ? u32Sum / u32Calls : 0),
+           (unsigned int) uxStack, pcTask);
+    logMsg("UartTask", "send cycles max %u avg %u, stack min %u words",
+           (unsigned int) u32OutMax,
+           (unsigned int) (u32OutCycles / u32Outputs),
+           (unsigned int) uxTaskGetStackHighWaterMark(NULL));
+    logMsg("UartTask", "uart cycles per KB %u",
+           (unsigned int) u32UartTxCyclesPerKb());
+    u32Outputs = 0;
+    u32OutCycles = 0;
+    u32OutMax = 0;
 }
+#endif
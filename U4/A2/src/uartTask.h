@@ -4,16 +4,25 @@
 /** \file       uartTask.h
  *******************************************************************************
  *
- *  \brief      Writes some text to the UART. Access to the UART is granted
- *              if mutexUART is possessed by the Task. This access control
- *              can be switched out with the macro USE_UART_MUTEX (uartTask1.h)
+ *  \brief      Deferred log to the UART. logMsg stores only the address of
+ *              the format, the tick, the address of the task name and the
+ *              raw argument words in a ring, no text is formatted on the
+ *              target. The gatekeeper UartTask sends the records as binary
+ *              frames (logFormat.h), host/logDecode.c formats them with
+ *              the strings of the ELF.
+ *
+ *              The format and the task name must be string constants, a %s
+ *              argument too; arguments are int sized (no double, long long)
+ *              and converted to LogWord_t by logMsg.
+ *              logMsg is called from tasks only, if the ring is full the
+ *              message is dropped and counted.
  *
  *  \author     wht4
  *
  ******************************************************************************/
 /*
  *  function    UartTask
- *              logMsg
+ *              vLogDefer
  *
  ******************************************************************************/
 
@@ -25,22 +34,39 @@
 #include <timers.h>
 #include <memPoolService.h>
 
+#include "logFormat.h"
+
 //----- Macros -----------------------------------------------------------------
-#define LOG_MESSAGE_SIZE ( 64 )
+#define LOG_RING_WORDS        ( 128 )   /* Ring of the records, power of 2    */
+#define LOG_DRAIN_MS          ( 10 )    /* Period of the gatekeeper           */
 
-//----- Data types -------------------------------------------------------------
-typedef struct _LogMsg {
+/* Log a message: logMsg("Task", "value %d", iValue), up to LOG_MAX_ARGS */
+#define logMsg(pcTaskName, pcFmt, ...)                                         \
+    vLogDefer((pcTaskName), (pcFmt), LOG_NARGS(__VA_ARGS__)                    \
+              LOG_WORDS(LOG_NARGS(__VA_ARGS__), ##__VA_ARGS__))
 
-    char         cTaskName[configMAX_TASK_NAME_LEN];
-    char         cMsg[LOG_MESSAGE_SIZE];
-    portTickType xTimeTag;
-} LogMsg;
+/* Number of arguments, 0 up to 6 */
+#define LOG_NARGS(...)        LOG_NARGS_(0, ##__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_NARGS_(x0, x1, x2, x3, x4, x5, x6, n, ...) n
+
+/* Each argument as LogWord_t, vLogDefer reads them with va_arg as such */
+#define LOG_WORDS(n, ...)     LOG_WORDS_(n, ##__VA_ARGS__)
+#define LOG_WORDS_(n, ...)    LOG_WORDS_##n(__VA_ARGS__)
+#define LOG_WORDS_0()
+#define LOG_WORDS_1(a)        , (LogWord_t) (a)
+#define LOG_WORDS_2(a, ...)   LOG_WORDS_1(a) LOG_WORDS_1(__VA_ARGS__)
+#define LOG_WORDS_3(a, ...)   LOG_WORDS_1(a) LOG_WORDS_2(__VA_ARGS__)
+#define LOG_WORDS_4(a, ...)   LOG_WORDS_1(a) LOG_WORDS_3(__VA_ARGS__)
+#define LOG_WORDS_5(a, ...)   LOG_WORDS_1(a) LOG_WORDS_4(__VA_ARGS__)
+#define LOG_WORDS_6(a, ...)   LOG_WORDS_1(a) LOG_WORDS_5(__VA_ARGS__)
+
+//----- Data types -------------------------------------------------------------
 
 //----- Function prototypes ----------------------------------------------------
 extern void  UartTask(void *pvData);
-extern void logMsg(char * pcTaskName, char * pcMsg, portTickType xWaitTime);
+extern void  vLogDefer(const char *pcTaskName, const char *pcFmt,
+                       uint8_t u8Args, ...);
 
 //----- Data -------------------------------------------------------------------
-extern xQueueHandle queueUart;
 
 #endif /* UARTTASK_H_ */
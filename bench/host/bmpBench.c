@@ -0,0 +1,607 @@
+/******************************************************************************/
+/** \file       bmpBench.c
+ *******************************************************************************
+ *
+ *  \brief      Host benchmark of bmpStream.c. Writes a 320x240 test picture
+ *              as 24 bit BMP (bottom-up and top-down), 16 bit BMP (R5G6B5
+ *              bit fields and X1R5G5B5) and RLE file into the directory of
+ *              the SD card (SIM_FS_ROOT), draws every file through simFatFs
+ *              and the emulated SSD1963, compares the screen with the
+ *              picture and prints the bus cost and the decode rate. Every
+ *              file is drawn again clipped in the lower right corner.
+ *
+ *              With two arguments a BMP file is converted to RLE instead:
+ *                  bmpBench splash.bmp splash.rle
+ *              Images larger than the screen are clipped to 320x240.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              main
+ *              u32SimGetTicks
+ *  functions  local:
+ *              u8BenchFile
+ *              u32BenchCheck
+ *              u8BenchConvert
+ *              u32BenchPattern
+ *              u16BenchExpect
+ *              u8BenchWriteBmp
+ *              u32BenchWriteRle
+ *              vBenchPut16
+ *              vBenchPut32
+ *              u64BenchNow
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <sim.h>
+#include <ssd1963.h>
+
+#include "bmpStream.h"
+
+//----- Macros -----------------------------------------------------------------
+#define BENCH_WIDTH           ( 320 )
+#define BENCH_HEIGHT          ( 240 )
+#define BENCH_PIXELS          ( BENCH_WIDTH * BENCH_HEIGHT )
+#define BENCH_ROUNDS          ( 50 )    /* Draws per file                     */
+#define BENCH_CLIP_X          ( 200 )   /* Corner of the clipped draw         */
+#define BENCH_CLIP_Y          ( 150 )
+#define BENCH_PATH_LEN        ( 512 )
+#define BENCH_FILES           ( sizeof(sFiles) / sizeof(sFiles[0]) )
+
+/* File formats */
+#define BENCH_BGR24           ( 0 )
+#define BENCH_BGR24_TOP       ( 1 )     /* Top-down, negative height          */
+#define BENCH_RGB565          ( 2 )
+#define BENCH_RGB555          ( 3 )
+#define BENCH_RLE             ( 4 )
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    const char *pcName;
+    uint8_t     u8Format;
+} BenchFile_t;
+
+//----- Function prototypes ----------------------------------------------------
+static uint8_t  u8BenchFile(const char *pcRoot, const BenchFile_t *psFile);
+static uint32_t u32BenchCheck(uint16_t u16X, uint16_t u16Y, uint8_t u8Format);
+static uint8_t  u8BenchConvert(const char *pcIn, const char *pcOut);
+static uint32_t u32BenchPattern(uint16_t u16X, uint16_t u16Y);
+static uint16_t u16BenchExpect(uint32_t u32Rgb, uint8_t u8Format);
+static uint8_t  u8BenchWriteBmp(const char *pcPath, uint8_t u8Format);
+static uint32_t u32BenchWriteRle(const char *pcPath, const uint16_t *pu16Src,
+                                 uint16_t u16Width, uint16_t u16Height,
+                                 uint16_t u16Stride);
+static void     vBenchPut16(FILE *pfOut, uint16_t u16Value);
+static void     vBenchPut32(FILE *pfOut, uint32_t u32Value);
+static uint64_t u64BenchNow(void);
+
+//----- Data -------------------------------------------------------------------
+static const BenchFile_t sFiles[] = {
+    { "bench24.bmp",  BENCH_BGR24 },
+    { "bench24t.bmp", BENCH_BGR24_TOP },
+    { "bench565.bmp", BENCH_RGB565 },
+    { "bench555.bmp", BENCH_RGB555 },
+    { "bench.rle",    BENCH_RLE },
+};
+
+static uint16_t u16Picture[BENCH_PIXELS]; /* Expected RGB565 screen           */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    main
+ ******************************************************************************/
+/** \brief        Write the test files and draw them, or convert a BMP file
+ *
+ *  \type         global
+ *
+ *  \param[in]    argc, argv    none, or the BMP and the RLE file
+ *
+ *  \return       0 on success, 1 on an error or a wrong pixel
+ *
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+
+    const char *pcRoot = getenv("SIM_FS_ROOT");
+    uint8_t u8Failed = 0;
+    uint32_t u32File;
+
+    SSD1963_Init();
+    if (argc == 3) {
+        return u8BenchConvert(argv[1], argv[2]);
+    }
+    if (pcRoot == NULL) {
+        pcRoot = ".";
+    }
+
+    printf("file            bytes windows   writes  us/image  Mpx/s   MB/s  clip\n");
+    for (u32File = 0; u32File < BENCH_FILES; u32File++) {
+        u8Failed |= u8BenchFile(pcRoot, &sFiles[u32File]);
+    }
+    return u8Failed;
+}
+
+/*******************************************************************************
+ *  function :    u32SimGetTicks
+ ******************************************************************************/
+/** \brief        Virtual time for the emulated SSD1963, there is no tick
+ *
+ *  \type         global
+ *
+ *  \return       0
+ *
+ ******************************************************************************/
+uint32_t u32SimGetTicks(void)
+{
+
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    u8BenchFile
+ ******************************************************************************/
+/** \brief        Write one test file, draw it BENCH_ROUNDS times at 0,0 and
+ *                once clipped, check the screen and print a result line
+ *
+ *  \type         local
+ *
+ *  \param[in]    pcRoot    directory of the SD card
+ *  \param[in]    psFile    file name and format
+ *
+ *  \return       0 on success, 1 on an error or a wrong pixel
+ *
+ ******************************************************************************/
+static uint8_t u8BenchFile(const char *pcRoot, const BenchFile_t *psFile)
+{
+
+    char cPath[BENCH_PATH_LEN];
+    char cName[BENCH_PATH_LEN];
+    SimLcdStats sStats;
+    BMP_STATUS eStatus = BMP_OK;
+    FILE *pfFile;
+    long lBytes;
+    uint64_t u64Start;
+    uint64_t u64Ns;
+    uint32_t u32Round;
+    uint32_t u32Wrong;
+    uint32_t u32Clip;
+    uint16_t u16X, u16Y;
+
+    snprintf(cPath, sizeof(cPath), "%s/%s", pcRoot, psFile->pcName);
+    snprintf(cName, sizeof(cName), "0:%s", psFile->pcName);
+    if (psFile->u8Format == BENCH_RLE) {
+        for (u16Y = 0; u16Y < BENCH_HEIGHT; u16Y++) {
+            for (u16X = 0; u16X < BENCH_WIDTH; u16X++) {
+                u16Picture[(u16Y * BENCH_WIDTH) + u16X] =
+                    u16BenchExpect(u32BenchPattern(u16X, u16Y), BENCH_RGB565);
+            }
+        }
+        if (u32BenchWriteRle(cPath, u16Picture, BENCH_WIDTH, BENCH_HEIGHT,
+                             BENCH_WIDTH) == 0) {
+            fprintf(stderr, "%s: cannot write\n", cPath);
+            return 1;
+        }
+    } else if (u8BenchWriteBmp(cPath, psFile->u8Format) != 0) {
+        fprintf(stderr, "%s: cannot write\n", cPath);
+        return 1;
+    }
+    pfFile = fopen(cPath, "rb");
+    fseek(pfFile, 0, SEEK_END);
+    lBytes = ftell(pfFile);
+    fclose(pfFile);
+
+    SSD1963_FillArea(0, 0, BENCH_WIDTH - 1, BENCH_HEIGHT - 1, 0);
+    vSimLcdEndFrame(NULL);
+    u64Start = u64BenchNow();
+    for (u32Round = 0; (u32Round < BENCH_ROUNDS) && (eStatus == BMP_OK);
+            u32Round++) {
+        eStatus = eBsDrawFile(cName, 0, 0);
+    }
+    u64Ns = (u64BenchNow() - u64Start) / BENCH_ROUNDS;
+    vSimLcdEndFrame(&sStats);
+    if (eStatus != BMP_OK) {
+        fprintf(stderr, "%s: error %d\n", psFile->pcName, (int) eStatus);
+        return 1;
+    }
+    u32Wrong = u32BenchCheck(0, 0, psFile->u8Format);
+
+    SSD1963_FillArea(0, 0, BENCH_WIDTH - 1, BENCH_HEIGHT - 1, 0);
+    eStatus = eBsDrawFile(cName, BENCH_CLIP_X, BENCH_CLIP_Y);
+    u32Clip = u32BenchCheck(BENCH_CLIP_X, BENCH_CLIP_Y, psFile->u8Format);
+
+    printf("%-12s %8ld %7u %8u %9.1f %6.1f %6.1f  %s\n", psFile->pcName, lBytes,
+           (unsigned) (sStats.u32Windows / BENCH_ROUNDS),
+           (unsigned) (sStats.u32Writes / BENCH_ROUNDS),
+           (double) u64Ns / 1000.0,
+           (double) BENCH_PIXELS * 1000.0 / (double) u64Ns,
+           (double) lBytes * 1000.0 / (double) u64Ns,
+           ((eStatus == BMP_OK) && (u32Clip == 0)) ? "ok" : "wrong");
+    if (u32Wrong != 0) {
+        fprintf(stderr, "%s: %u pixels wrong\n", psFile->pcName,
+                (unsigned) u32Wrong);
+    }
+    return ((u32Wrong != 0) || (u32Clip != 0) || (eStatus != BMP_OK)) ? 1 : 0;
+}
+
+/*******************************************************************************
+ *  function :    u32BenchCheck
+ ******************************************************************************/
+/** \brief        Compare the screen with the picture drawn at u16X, u16Y on
+ *                a black screen
+ *
+ *  \type         local
+ *
+ *  \param[in]    u16X, u16Y    upper left corner of the picture
+ *  \param[in]    u8Format      format of the file
+ *
+ *  \return       number of wrong pixels
+ *
+ ******************************************************************************/
+static uint32_t u32BenchCheck(uint16_t u16X, uint16_t u16Y, uint8_t u8Format)
+{
+
+    const uint16_t *pu16Frame = pu16SimGetFrame();
+    uint32_t u32Wrong = 0;
+    uint16_t u16Expect;
+    uint16_t u16Col, u16Row;
+
+    for (u16Row = 0; u16Row < BENCH_HEIGHT; u16Row++) {
+        for (u16Col = 0; u16Col < BENCH_WIDTH; u16Col++) {
+            u16Expect = 0;
+            if ((u16Col >= u16X) && (u16Row >= u16Y)) {
+                u16Expect = u16BenchExpect(u32BenchPattern(u16Col - u16X,
+                                                           u16Row - u16Y),
+                                           u8Format);
+            }
+            if (pu16Frame[(u16Row * BENCH_WIDTH) + u16Col] != u16Expect) {
+                u32Wrong++;
+            }
+        }
+    }
+    return u32Wrong;
+}
+
+/*******************************************************************************
+ *  function :    u8BenchConvert
+ ******************************************************************************/
+/** \brief        Convert a BMP file to RLE: draw it with bmpStream and encode
+ *                the visible part of the screen
+ *
+ *  \type         local
+ *
+ *  \param[in]    pcIn      BMP file, absolute or relative path
+ *  \param[in]    pcOut     RLE file
+ *
+ *  \return       0 on success, 1 on an error
+ *
+ ******************************************************************************/
+static uint8_t u8BenchConvert(const char *pcIn, const char *pcOut)
+{
+
+    char cName[BENCH_PATH_LEN];
+    uint8_t u8Header[26];
+    FILE *pfIn;
+    int32_t s32Width;
+    int32_t s32Height;
+    BMP_STATUS eStatus;
+    uint32_t u32Bytes;
+
+    /* Size from the header, the decoder checks the rest */
+    pfIn = fopen(pcIn, "rb");
+    if ((pfIn == NULL) || (fread(u8Header, 1, sizeof(u8Header), pfIn) !=
+                           sizeof(u8Header))) {
+        fprintf(stderr, "%s: cannot read\n", pcIn);
+        if (pfIn != NULL) {
+            fclose(pfIn);
+        }
+        return 1;
+    }
+    fclose(pfIn);
+    s32Width = (int32_t) (u8Header[18] | (u8Header[19] << 8) |
+                          (u8Header[20] << 16) | ((uint32_t) u8Header[21] << 24));
+    s32Height = (int32_t) (u8Header[22] | (u8Header[23] << 8) |
+                           (u8Header[24] << 16) | ((uint32_t) u8Header[25] << 24));
+    if (s32Height < 0) {
+        s32Height = -s32Height;
+    }
+    if (s32Width > BENCH_WIDTH) {
+        s32Width = BENCH_WIDTH;
+    }
+    if (s32Height > BENCH_HEIGHT) {
+        s32Height = BENCH_HEIGHT;
+    }
+
+    /* simFatFs takes the path below SIM_FS_ROOT */
+    snprintf(cName, sizeof(cName), "%s", pcIn);
+    setenv("SIM_FS_ROOT", (pcIn[0] == '/') ? "" : ".", 1);
+    eStatus = eBsDrawFile(cName, 0, 0);
+    if ((eStatus != BMP_OK) || (s32Width <= 0) || (s32Height <= 0)) {
+        fprintf(stderr, "%s: error %d\n", pcIn, (int) eStatus);
+        return 1;
+    }
+    u32Bytes = u32BenchWriteRle(pcOut, pu16SimGetFrame(), (uint16_t) s32Width,
+                                (uint16_t) s32Height, BENCH_WIDTH);
+    if (u32Bytes == 0) {
+        fprintf(stderr, "%s: cannot write\n", pcOut);
+        return 1;
+    }
+    printf("%s: %dx%d, %u bytes\n", pcOut, (int) s32Width, (int) s32Height,
+           (unsigned) u32Bytes);
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    u32BenchPattern
+ ******************************************************************************/
+/** \brief        Test picture like a splash screen: flat background and
+ *                boxes, which compress well, and a colour gradient band,
+ *                which does not
+ *
+ *  \type         local
+ *
+ *  \param[in]    u16X, u16Y    pixel
+ *
+ *  \return       colour as 0xRRGGBB
+ *
+ ******************************************************************************/
+static uint32_t u32BenchPattern(uint16_t u16X, uint16_t u16Y)
+{
+
+    int32_t s32Dx = (int32_t) u16X - 160;
+    int32_t s32Dy = (int32_t) u16Y - 90;
+
+    if (u16Y >= 200) {
+        return ((uint32_t) (u16X * 255 / 319) << 16) |
+               ((uint32_t) ((u16Y - 200) * 6) << 8) | (255 - (u16X * 255 / 319));
+    }
+    if ((s32Dx * s32Dx) + (s32Dy * s32Dy) < 60 * 60) {
+        return 0xF0C020;
+    }
+    if ((u16Y >= 20) && (u16Y < 60) && (u16X >= 20) && (u16X < 80)) {
+        return 0x20A040;
+    }
+    return 0x102040;
+}
+
+/*******************************************************************************
+ *  function :    u16BenchExpect
+ ******************************************************************************/
+/** \brief        RGB565 pixel on the screen for a colour of the picture
+ *                stored in the given format
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32Rgb      colour as 0xRRGGBB
+ *  \param[in]    u8Format    format of the file
+ *
+ *  \return       RGB565 pixel
+ *
+ ******************************************************************************/
+static uint16_t u16BenchExpect(uint32_t u32Rgb, uint8_t u8Format)
+{
+
+    uint16_t u16R = (uint16_t) ((u32Rgb >> 16) & 0xFF);
+    uint16_t u16G = (uint16_t) ((u32Rgb >> 8) & 0xFF);
+    uint16_t u16B = (uint16_t) (u32Rgb & 0xFF);
+
+    if (u8Format == BENCH_RGB555) {
+        /* Five bits of green, the lowest bit of the six stays 0 */
+        return (uint16_t) (((u16R >> 3) << 11) | ((u16G >> 3) << 6) | (u16B >> 3));
+    }
+    return (uint16_t) (((u16R >> 3) << 11) | ((u16G >> 2) << 5) | (u16B >> 3));
+}
+
+/*******************************************************************************
+ *  function :    u8BenchWriteBmp
+ ******************************************************************************/
+/** \brief        Write the picture as BMP file
+ *
+ *  \type         local
+ *
+ *  \param[in]    pcPath      file
+ *  \param[in]    u8Format    BENCH_BGR24, BENCH_BGR24_TOP, BENCH_RGB565 or
+ *                            BENCH_RGB555
+ *
+ *  \return       0 on success, 1 if the file cannot be written
+ *
+ ******************************************************************************/
+static uint8_t u8BenchWriteBmp(const char *pcPath, uint8_t u8Format)
+{
+
+    uint8_t  u8Bits = ((u8Format == BENCH_BGR24) ||
+                       (u8Format == BENCH_BGR24_TOP)) ? 24 : 16;
+    uint32_t u32Header = (u8Format == BENCH_RGB565) ? 66 : 54;
+    uint32_t u32Stride = ((BENCH_WIDTH * (u8Bits / 8)) + 3) & ~3UL;
+    uint32_t u32Rgb;
+    uint16_t u16Row, u16Col, u16Y;
+    FILE *pfOut;
+
+    pfOut = fopen(pcPath, "wb");
+    if (pfOut == NULL) {
+        return 1;
+    }
+    fputc('B', pfOut);
+    fputc('M', pfOut);
+    vBenchPut32(pfOut, u32Header + (u32Stride * BENCH_HEIGHT));
+    vBenchPut32(pfOut, 0);
+    vBenchPut32(pfOut, u32Header);                  /* bfOffBits              */
+    vBenchPut32(pfOut, 40);                         /* biSize                 */
+    vBenchPut32(pfOut, BENCH_WIDTH);
+    vBenchPut32(pfOut, (u8Format == BENCH_BGR24_TOP) ?
+                (uint32_t) -BENCH_HEIGHT : BENCH_HEIGHT);
+    vBenchPut16(pfOut, 1);                          /* biPlanes               */
+    vBenchPut16(pfOut, u8Bits);
+    vBenchPut32(pfOut, (u8Format == BENCH_RGB565) ? 3 : 0);
+    vBenchPut32(pfOut, u32Stride * BENCH_HEIGHT);
+    vBenchPut32(pfOut, 2835);                       /* 72 dpi                 */
+    vBenchPut32(pfOut, 2835);
+    vBenchPut32(pfOut, 0);
+    vBenchPut32(pfOut, 0);
+    if (u8Format == BENCH_RGB565) {
+        vBenchPut32(pfOut, 0xF800);
+        vBenchPut32(pfOut, 0x07E0);
+        vBenchPut32(pfOut, 0x001F);
+    }
+
+    for (u16Row = 0; u16Row < BENCH_HEIGHT; u16Row++) {
+        u16Y = (u8Format == BENCH_BGR24_TOP) ? u16Row : (BENCH_HEIGHT - 1 - u16Row);
+        for (u16Col = 0; u16Col < BENCH_WIDTH; u16Col++) {
+            u32Rgb = u32BenchPattern(u16Col, u16Y);
+            if (u8Bits == 24) {
+                fputc((int) (u32Rgb & 0xFF), pfOut);
+                fputc((int) ((u32Rgb >> 8) & 0xFF), pfOut);
+                fputc((int) ((u32Rgb >> 16) & 0xFF), pfOut);
+            } else if (u8Format == BENCH_RGB565) {
+                vBenchPut16(pfOut, u16BenchExpect(u32Rgb, BENCH_RGB565));
+            } else {
+                vBenchPut16(pfOut, (uint16_t) ((((u32Rgb >> 19) & 0x1F) << 10) |
+                                               (((u32Rgb >> 11) & 0x1F) << 5) |
+                                               ((u32Rgb >> 3) & 0x1F)));
+            }
+        }
+        for (u16Col = BENCH_WIDTH * (u8Bits / 8); u16Col < u32Stride; u16Col++) {
+            fputc(0, pfOut);
+        }
+    }
+    return (fclose(pfOut) == 0) ? 0 : 1;
+}
+
+/*******************************************************************************
+ *  function :    u32BenchWriteRle
+ ******************************************************************************/
+/** \brief        Encode RGB565 pixels as RLE file. Two or more equal pixels
+ *                become a run packet (3 bytes), the others are collected in
+ *                literal packets, both up to 128 pixels.
+ *
+ *  \type         local
+ *
+ *  \param[in]    pcPath                file
+ *  \param[in]    pu16Src               first pixel
+ *  \param[in]    u16Width, u16Height   size
+ *  \param[in]    u16Stride             pixels from row to row in pu16Src
+ *
+ *  \return       bytes written, 0 if the file cannot be written
+ *
+ ******************************************************************************/
+static uint32_t u32BenchWriteRle(const char *pcPath, const uint16_t *pu16Src,
+                                 uint16_t u16Width, uint16_t u16Height,
+                                 uint16_t u16Stride)
+{
+
+    uint32_t u32Count = (uint32_t) u16Width * u16Height;
+    uint32_t u32Pixel = 0;
+    uint32_t u32Run;
+    uint32_t u32Bytes = 8;
+    FILE *pfOut;
+
+/* Pixel n of the image, row by row */
+#define PIXEL(n)  ( pu16Src[(((n) / u16Width) * u16Stride) + ((n) % u16Width)] )
+
+    pfOut = fopen(pcPath, "wb");
+    if (pfOut == NULL) {
+        return 0;
+    }
+    fwrite("RL16", 1, 4, pfOut);
+    vBenchPut16(pfOut, u16Width);
+    vBenchPut16(pfOut, u16Height);
+
+    while (u32Pixel < u32Count) {
+        for (u32Run = 1; (u32Pixel + u32Run < u32Count) && (u32Run < 128) &&
+                (PIXEL(u32Pixel + u32Run) == PIXEL(u32Pixel)); u32Run++) {
+        }
+        if (u32Run >= 2) {
+            fputc((int) (0x80 | (u32Run - 1)), pfOut);
+            vBenchPut16(pfOut, PIXEL(u32Pixel));
+            u32Pixel += u32Run;
+            u32Bytes += 3;
+            continue;
+        }
+        /* Literal up to the start of the next run */
+        for (u32Run = 1; (u32Pixel + u32Run < u32Count) && (u32Run < 128); u32Run++) {
+            if ((u32Pixel + u32Run + 1 < u32Count) &&
+                (PIXEL(u32Pixel + u32Run) == PIXEL(u32Pixel + u32Run + 1))) {
+                break;
+            }
+        }
+        fputc((int) (u32Run - 1), pfOut);
+        u32Bytes += 1 + (2 * u32Run);
+        for (; u32Run > 0; u32Run--, u32Pixel++) {
+            vBenchPut16(pfOut, PIXEL(u32Pixel));
+        }
+    }
+#undef PIXEL
+    return (fclose(pfOut) == 0) ? u32Bytes : 0;
+}
+
+/*******************************************************************************
+ *  function :    vBenchPut16
+ ******************************************************************************/
+/** \brief        Write a 16 bit value, little endian
+ *
+ *  \type         local
+ *
+ *  \param[in]    pfOut       file
+ *  \param[in]    u16Value    value
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchPut16(FILE *pfOut, uint16_t u16Value)
+{
+
+    fputc(u16Value & 0xFF, pfOut);
+    fputc(u16Value >> 8, pfOut);
+}
+
+/*******************************************************************************
+ *  function :    vBenchPut32
+ ******************************************************************************/
+/** \brief        Write a 32 bit value, little endian
+ *
+ *  \type         local
+ *
+ *  \param[in]    pfOut       file
+ *  \param[in]    u32Value    value
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchPut32(FILE *pfOut, uint32_t u32Value)
+{
+
+    vBenchPut16(pfOut, (uint16_t) (u32Value & 0xFFFF));
+    vBenchPut16(pfOut, (uint16_t) (u32Value >> 16));
+}
+
+/*******************************************************************************
+ *  function :    u64BenchNow
+ ******************************************************************************/
+/** \brief        Monotonic time
+ *
+ *  \type         local
+ *
+ *  \return       time in ns
+ *
+ ******************************************************************************/
+static uint64_t u64BenchNow(void)
+{
+
+    struct timespec sNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &sNow);
+    return ((uint64_t) sNow.tv_sec * 1000000000ULL) + (uint64_t) sNow.tv_nsec;
+}
@@ -0,0 +1,224 @@
+/******************************************************************************/
+/** \file       spanCheck.c
+ *******************************************************************************
+ *
+ *  \brief      Host check of the clipping in spanDraw.c. Every shape is
+ *              drawn once inside the screen through the emulated SSD1963
+ *              and then moved across the left, top, right or bottom border.
+ *              The moved shape has to be the same pixels, shifted and cut
+ *              at the border, a span outside the screen must not be drawn.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              main
+ *              u32SimGetTicks
+ *  functions  local:
+ *              u32CheckCase
+ *              vCheckDraw
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <string.h>
+
+#include <sim.h>
+#include <ssd1963.h>
+
+#include "spanDraw.h"
+
+//----- Macros -----------------------------------------------------------------
+#define CHECK_WIDTH           ( 320 )
+#define CHECK_HEIGHT          ( 240 )
+#define CHECK_PIXELS          ( CHECK_WIDTH * CHECK_HEIGHT )
+#define CHECK_CASES           ( sizeof(sCases) / sizeof(sCases[0]) )
+#define CHECK_COLOR           ( 0xFFFF )
+
+/* Shapes */
+#define CHECK_LINE            ( 0 )
+#define CHECK_RECT            ( 1 )
+#define CHECK_RECTF           ( 2 )
+#define CHECK_CIRCLE          ( 3 )
+#define CHECK_CIRCLEF         ( 4 )
+#define CHECK_ROUNDRECT       ( 5 )
+#define CHECK_ROUNDRECTF      ( 6 )
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    const char *pcName;
+    uint8_t     u8Shape;
+    uint16_t    u16X, u16Y;         /* Position inside the screen         */
+    uint16_t    u16A, u16B, u16R;   /* Size, line end or radius           */
+    uint16_t    u16MoveX, u16MoveY; /* Position across the border         */
+} CheckCase_t;
+
+//----- Function prototypes ----------------------------------------------------
+static uint32_t u32CheckCase(const CheckCase_t *psCase);
+static void     vCheckDraw(const CheckCase_t *psCase, uint16_t u16X,
+                           uint16_t u16Y);
+
+//----- Data -------------------------------------------------------------------
+static const CheckCase_t sCases[] = {
+    { "circle left",      CHECK_CIRCLE,     150, 120,   0,   0,  20,   5, 120 },
+    { "circle top",       CHECK_CIRCLE,     150, 120,   0,   0,  20, 150,   3 },
+    { "circle corner",    CHECK_CIRCLE,     150, 120,   0,   0,  30,   0,   0 },
+    { "circle right",     CHECK_CIRCLE,     150, 120,   0,   0,  20, 315, 120 },
+    { "circle bottom",    CHECK_CIRCLE,     150, 120,   0,   0,  20, 150, 236 },
+    { "circleF left",     CHECK_CIRCLEF,    150, 120,   0,   0,  20,   5, 120 },
+    { "circleF corner",   CHECK_CIRCLEF,    150, 120,   0,   0,  20,   5,   3 },
+    { "circleF right",    CHECK_CIRCLEF,    150, 120,   0,   0,  20, 310, 230 },
+    { "line right",       CHECK_LINE,       100, 100, 180, 150,   0, 250, 180 },
+    { "rect right",       CHECK_RECT,       100, 100,  40,  30,   0, 300, 220 },
+    { "rectF right",      CHECK_RECTF,      100, 100,  40,  30,   0, 300, 220 },
+    { "roundRect right",  CHECK_ROUNDRECT,  100, 100,  60,  40,  15, 290, 210 },
+    { "roundRectF right", CHECK_ROUNDRECTF, 100, 100,  60,  40,  15, 290, 210 },
+};
+
+static uint16_t u16Shape[CHECK_PIXELS]; /* Shape drawn inside the screen    */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    main
+ ******************************************************************************/
+/** \brief        Run every case and print the wrong pixels
+ *
+ *  \type         global
+ *
+ *  \return       0 on success, 1 on a wrong pixel
+ *
+ ******************************************************************************/
+int main(void)
+{
+
+    uint8_t u8Failed = 0;
+    uint32_t u32Case, u32Wrong;
+
+    SSD1963_Init();
+    printf("case               wrong\n");
+    for (u32Case = 0; u32Case < CHECK_CASES; u32Case++) {
+        u32Wrong = u32CheckCase(&sCases[u32Case]);
+        printf("%-17s %6u\n", sCases[u32Case].pcName, (unsigned) u32Wrong);
+        if (u32Wrong != 0) {
+            u8Failed = 1;
+        }
+    }
+    return u8Failed;
+}
+
+/*******************************************************************************
+ *  function :    u32SimGetTicks
+ ******************************************************************************/
+/** \brief        Virtual time for the emulated SSD1963, there is no tick
+ *
+ *  \type         global
+ *
+ *  \return       0
+ *
+ ******************************************************************************/
+uint32_t u32SimGetTicks(void)
+{
+
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    u32CheckCase
+ ******************************************************************************/
+/** \brief        Draw the shape inside the screen and across the border and
+ *                compare the second screen with the first one shifted
+ *
+ *  \type         local
+ *
+ *  \param[in]    psCase    shape and positions
+ *
+ *  \return       number of wrong pixels
+ *
+ ******************************************************************************/
+static uint32_t u32CheckCase(const CheckCase_t *psCase)
+{
+
+    const uint16_t *pu16Frame = pu16SimGetFrame();
+    int32_t s32DX = (int32_t) psCase->u16MoveX - psCase->u16X;
+    int32_t s32DY = (int32_t) psCase->u16MoveY - psCase->u16Y;
+    int32_t s32Col, s32Row, s32SrcX, s32SrcY;
+    uint32_t u32Wrong = 0;
+    uint16_t u16Expect;
+
+    SSD1963_FillArea(0, 0, CHECK_WIDTH - 1, CHECK_HEIGHT - 1, 0);
+    vCheckDraw(psCase, psCase->u16X, psCase->u16Y);
+    memcpy(u16Shape, pu16Frame, sizeof(u16Shape));
+
+    SSD1963_FillArea(0, 0, CHECK_WIDTH - 1, CHECK_HEIGHT - 1, 0);
+    vCheckDraw(psCase, psCase->u16MoveX, psCase->u16MoveY);
+    for (s32Row = 0; s32Row < CHECK_HEIGHT; s32Row++) {
+        for (s32Col = 0; s32Col < CHECK_WIDTH; s32Col++) {
+            s32SrcX = s32Col - s32DX;
+            s32SrcY = s32Row - s32DY;
+            u16Expect = 0;
+            if ((s32SrcX >= 0) && (s32SrcX < CHECK_WIDTH) &&
+                (s32SrcY >= 0) && (s32SrcY < CHECK_HEIGHT)) {
+                u16Expect = u16Shape[(s32SrcY * CHECK_WIDTH) + s32SrcX];
+            }
+            if (pu16Frame[(s32Row * CHECK_WIDTH) + s32Col] != u16Expect) {
+                u32Wrong++;
+            }
+        }
+    }
+    return u32Wrong;
+}
+
+/*******************************************************************************
+ *  function :    vCheckDraw
+ ******************************************************************************/
+/** \brief        Draw the shape of a case at a position
+ *
+ *  \type         local
+ *
+ *  \param[in]    psCase        shape and size
+ *  \param[in]    u16X, u16Y    position, the line end moves along
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vCheckDraw(const CheckCase_t *psCase, uint16_t u16X,
+                       uint16_t u16Y)
+{
+
+    switch (psCase->u8Shape) {
+    case CHECK_LINE:
+        vSdDrawLine(u16X, u16Y, u16X + psCase->u16A - psCase->u16X,
+                    u16Y + psCase->u16B - psCase->u16Y, CHECK_COLOR);
+        break;
+    case CHECK_RECT:
+        vSdDrawRect(u16X, u16Y, psCase->u16A, psCase->u16B, CHECK_COLOR);
+        break;
+    case CHECK_RECTF:
+        vSdDrawRectF(u16X, u16Y, psCase->u16A, psCase->u16B, CHECK_COLOR);
+        break;
+    case CHECK_CIRCLE:
+        vSdDrawCircle(u16X, u16Y, psCase->u16R, CHECK_COLOR);
+        break;
+    case CHECK_CIRCLEF:
+        vSdDrawCircleF(u16X, u16Y, psCase->u16R, CHECK_COLOR);
+        break;
+    case CHECK_ROUNDRECT:
+        vSdDrawRoundRect(u16X, u16Y, psCase->u16A, psCase->u16B,
+                         psCase->u16R, CHECK_COLOR);
+        break;
+    case CHECK_ROUNDRECTF:
+        vSdDrawRoundRectF(u16X, u16Y, psCase->u16A, psCase->u16B,
+                          psCase->u16R, CHECK_COLOR);
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,1028 @@
+/******************************************************************************/
+/** \file       benchTask.c
+ *******************************************************************************
+ *
+ *  \brief      Kernel micro-benchmarks. The measuring task runs every test
+ *              with peer tasks of higher priority, so each hand-off wakes the
+ *              peer at once and the peer takes the time stamp. The IO1
+ *              tests compare the BSP with the LED shadow of io1Service,
+ *              the text test sGUI with the glyph cache, the LCD tests the
+ *              CPU with DMA transfers of lcdDma, the shape tests the sGUI
+ *              primitives with the spans of spanDraw, the bitmap tests
+ *              LCD_BMP_DrawBitmap with the streaming decoder of bmpStream.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, IO1 LED update and snapshot
+ *               \li id101010, 17.10.2026, Text output with the glyph cache
+ *               \li id101010, 17.10.2026, Full screen fill and blit with DMA
+ *               \li id101010, 17.10.2026, Shapes with sGUI and spanDraw
+ *               \li id101010, 17.10.2026, Bitmaps from the SD card
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vBenchTask
+ *  functions  local:
+ *              vBenchClockInit
+ *              u32BenchNow
+ *              vStatsReset
+ *              vStatsAdd
+ *              vStatsPrint
+ *              vBenchTimer
+ *              vBenchYield
+ *              vBenchQueue
+ *              vBenchSemaphore
+ *              vBenchMutex
+ *              vBenchNotify
+ *              vBenchDelay
+ *              vBenchDelayUntil
+ *              vBenchIo1Led
+ *              vBenchIo1Read
+ *              vBenchText
+ *              vBenchLcd
+ *              vBenchShapes
+ *              vBenchBitmap
+ *              vYieldPeer
+ *              vEchoPeer
+ *              vSemaphorePeer
+ *              vMutexPeer
+ *              vNotifyPeer
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>
+#include <carme_io1.h>
+#include <lcd.h>
+#include <ff.h>
+#include <stdio.h>
+
+#ifdef CARME_SIM
+#include <time.h>
+#endif
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+#include <queue.h>
+#include <semphr.h>
+
+#include "benchTask.h"
+#include "io1Service.h"
+#include "glyphCache.h"
+#include "lcdDma.h"
+#include "spanDraw.h"
+#include "bmpStream.h"
+
+//----- Macros -----------------------------------------------------------------
+#define BENCH_SAMPLES         ( 1000 )  /* Samples per hand-off test          */
+#define BENCH_DELAY_SAMPLES   ( 100 )   /* Samples per delay test             */
+#define BENCH_DELAY_TICKS     ( 2 )     /* Delay of the jitter tests          */
+#define BENCH_PERIOD_MS       ( 5000 )  /* Pause between two runs             */
+#define BENCH_LOGMSG_SIZE     ( 80 )    /* sizeof(LogMsg) of U4A2             */
+#define BENCH_QUEUE_SIZES     ( sizeof(u8QueueSizes) / sizeof(u8QueueSizes[0]) )
+#define BENCH_TEXT_SAMPLES    ( 100 )   /* Strings per text test              */
+#define BENCH_TEXT_CHARS      ( sizeof(cBenchText) - 1 )
+#define BENCH_LCD_SAMPLES     ( 10 )    /* Frames per LCD test                */
+#define BENCH_LCD_WIDTH       ( LCD_HOR_RESOLUTION )
+#define BENCH_LCD_HEIGHT      ( LCD_VER_RESOLUTION )
+#define BENCH_SHAPE_SAMPLES   ( 10 )    /* Shapes per shape test              */
+#define BENCH_SHAPE_X         ( 160 )   /* Centre of the circles              */
+#define BENCH_SHAPE_Y         ( 120 )
+#define BENCH_SHAPE_R         ( 100 )
+#define BENCH_SHAPE_TESTS     ( sizeof(cShapeTest) / sizeof(cShapeTest[0]) )
+#define BENCH_BMP_SAMPLES     ( 5 )     /* Images per bitmap test             */
+#define BENCH_BMP_TESTS       ( sizeof(cBmpTest) / sizeof(cBmpTest[0]) )
+
+/* Time base: core clock cycles on the target, ns on the host */
+#ifdef CARME_SIM
+#define BENCH_UNITS_PER_S     ( 1000000000UL )
+#else
+#define BENCH_UNITS_PER_S     ( SystemCoreClock )
+#endif
+#define BENCH_TICK_UNITS      ( BENCH_UNITS_PER_S / configTICK_RATE_HZ )
+
+//----- Data types -------------------------------------------------------------
+/* Statistics of one test in time base units, signed for the jitter tests */
+typedef struct {
+    uint32_t u32Count;
+    int32_t  i32Min;
+    int32_t  i32Max;
+    int64_t  i64Sum;
+} BenchStats;
+
+//----- Function prototypes ----------------------------------------------------
+static void     vBenchClockInit(void);
+static uint32_t u32BenchNow(void);
+static void     vStatsReset(void);
+static void     vStatsAdd(int32_t i32Sample);
+static void     vStatsPrint(const char *pcTest, uint32_t u32Param);
+static void     vBenchTimer(void);
+static void     vBenchYield(void);
+static void     vBenchQueue(void);
+static void     vBenchSemaphore(void);
+static void     vBenchMutex(void);
+static void     vBenchNotify(void);
+static void     vBenchDelay(void);
+static void     vBenchDelayUntil(void);
+static void     vBenchIo1Led(void);
+static void     vBenchIo1Read(void);
+static void     vBenchText(void);
+static void     vBenchLcd(void);
+static void     vBenchShapes(void);
+static void     vBenchBitmap(void);
+static void     vYieldPeer(void *pvData);
+static void     vEchoPeer(void *pvData);
+static void     vSemaphorePeer(void *pvData);
+static void     vMutexPeer(void *pvData);
+static void     vNotifyPeer(void *pvData);
+
+//----- Data -------------------------------------------------------------------
+static const uint8_t u8QueueSizes[] = { 1, 4, 16, 32, 64, BENCH_LOGMSG_SIZE };
+static const char    cBenchText[] = "P3: eating     ";
+/* Shape tests and their nominal pixel counts: pi * r^2, 4 * sqrt(2) * r (the
+ * midpoint circle sets about 0.707 * r points per octant), a diagonal of the
+ * screen and the full screen */
+static const char * const cShapeTest[] = { "circlef", "circle", "line", "rectf" };
+static const uint32_t u32ShapePixels[] = { 31416, 566, 320, 76800 };
+/* Bitmap tests and their 320x240 files, written by make bmp-bench */
+static const char * const cBmpTest[] = { "bmp24", "bmp16", "rle" };
+static const char * const cBmpFile[] = { "0:bench24.bmp", "0:bench565.bmp",
+                                         "0:bench.rle" };
+
+static FATFS             sFs;           /* SD card of the bitmap tests        */
+
+static BenchStats        sStats;        /* Statistics of the running test     */
+static uint32_t          u32Run;        /* Number of the run, CSV column      */
+static volatile uint32_t u32Stamp;      /* Time stamp before a hand-off       */
+static volatile uint8_t  u8Owner;       /* Yield test: task of u32Stamp       */
+static volatile uint8_t  u8Stop;        /* Yield test: enough samples         */
+static QueueHandle_t     xPing[BENCH_QUEUE_SIZES];
+static QueueHandle_t     xPong[BENCH_QUEUE_SIZES];
+static SemaphoreHandle_t xSemaphore;
+static SemaphoreHandle_t xMutex;
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vBenchTask
+ ******************************************************************************/
+/** \brief        Run all benchmarks every BENCH_PERIOD_MS
+ *
+ *  \type         global
+ *
+ *  \param[in]    pvData    not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void  vBenchTask(void *pvData)
+{
+
+    uint32_t u32Size;
+
+    vBenchClockInit();
+    vIo1Init();
+    LCD_Init();
+    LCD_SetFont(&font_8x16);
+    vLcdDmaInit();
+    f_mount(&sFs, "0:", 0);
+
+    xSemaphore = xSemaphoreCreateBinary();
+    xMutex = xSemaphoreCreateMutex();
+    for (u32Size = 0; u32Size < BENCH_QUEUE_SIZES; u32Size++) {
+        xPing[u32Size] = xQueueCreate(1, u8QueueSizes[u32Size]);
+        xPong[u32Size] = xQueueCreate(1, u8QueueSizes[u32Size]);
+    }
+
+    for (;;) {
+        u32Run++;
+        printf("run,test,param,samples,min_ns,mean_ns,max_ns\r\n");
+        vBenchTimer();
+        vBenchYield();
+        vBenchQueue();
+        vBenchSemaphore();
+        vBenchMutex();
+        vBenchNotify();
+        vBenchDelay();
+        vBenchDelayUntil();
+        vBenchIo1Led();
+        vBenchIo1Read();
+        vBenchText();
+        vBenchLcd();
+        vBenchShapes();
+        vBenchBitmap();
+        vTaskDelay(BENCH_PERIOD_MS / portTICK_RATE_MS);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vBenchClockInit
+ ******************************************************************************/
+/** \brief        Start the DWT cycle counter
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchClockInit(void)
+{
+
+#ifndef CARME_SIM
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/*******************************************************************************
+ *  function :    u32BenchNow
+ ******************************************************************************/
+/** \brief        Current time in time base units. Differences are correct
+ *                across the wrap-around.
+ *
+ *  \type         local
+ *
+ *  \return       cycle counter (target) or monotonic clock in ns (host)
+ *
+ ******************************************************************************/
+static uint32_t u32BenchNow(void)
+{
+
+#ifdef CARME_SIM
+    struct timespec sNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &sNow);
+    return (uint32_t) ((uint64_t) sNow.tv_sec * 1000000000ULL + sNow.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/*******************************************************************************
+ *  function :    vStatsReset
+ ******************************************************************************/
+/** \brief        Start a new test
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vStatsReset(void)
+{
+
+    sStats.u32Count = 0;
+    sStats.i32Min = INT32_MAX;
+    sStats.i32Max = INT32_MIN;
+    sStats.i64Sum = 0;
+}
+
+/*******************************************************************************
+ *  function :    vStatsAdd
+ ******************************************************************************/
+/** \brief        Add one sample to the running test
+ *
+ *  \type         local
+ *
+ *  \param[in]    i32Sample   time in time base units
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vStatsAdd(int32_t i32Sample)
+{
+
+    sStats.u32Count++;
+    sStats.i64Sum += i32Sample;
+    if (i32Sample < sStats.i32Min) {
+        sStats.i32Min = i32Sample;
+    }
+    if (i32Sample > sStats.i32Max) {
+        sStats.i32Max = i32Sample;
+    }
+}
+
+/*******************************************************************************
+ *  function :    vStatsPrint
+ ******************************************************************************/
+/** \brief        Write the running test as CSV line, times in ns
+ *
+ *  \type         local
+ *
+ *  \param[in]    pcTest      name of the test
+ *  \param[in]    u32Param    parameter of the test (item size, ticks)
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vStatsPrint(const char *pcTest, uint32_t u32Param)
+{
+
+    int64_t i64Mean = 0;
+
+    if (sStats.u32Count == 0) {
+        sStats.i32Min = 0;
+        sStats.i32Max = 0;
+    } else {
+        i64Mean = sStats.i64Sum / (int64_t) sStats.u32Count;
+    }
+
+    printf("%u,%s,%u,%u,%d,%d,%d\r\n",
+           (unsigned) u32Run, pcTest, (unsigned) u32Param,
+           (unsigned) sStats.u32Count,
+           (int) ((int64_t) sStats.i32Min * 1000000000LL / BENCH_UNITS_PER_S),
+           (int) (i64Mean * 1000000000LL / BENCH_UNITS_PER_S),
+           (int) ((int64_t) sStats.i32Max * 1000000000LL / BENCH_UNITS_PER_S));
+}
+
+/*******************************************************************************
+ *  function :    vBenchTimer
+ ******************************************************************************/
+/** \brief        Cost of two back-to-back time stamps, to be subtracted from
+ *                the other results
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchTimer(void)
+{
+
+    uint32_t u32Sample;
+    uint32_t u32Start;
+
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+        u32Start = u32BenchNow();
+        vStatsAdd((int32_t) (u32BenchNow() - u32Start));
+    }
+    vStatsPrint("timer", 0);
+}
+
+/*******************************************************************************
+ *  function :    vBenchYield
+ ******************************************************************************/
+/** \brief        Task to task context switch: two peers of equal priority
+ *                yield to each other. They run until both have ended.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchYield(void)
+{
+
+    vStatsReset();
+    u8Owner = 0;
+    u8Stop = 0;
+    u32Stamp = u32BenchNow();
+
+    /* The first peer must not start before the second exists */
+    vTaskSuspendAll();
+    xTaskCreate(vYieldPeer, "Yield1", STACKSIZE_BENCH_PEER, (void *) 1,
+                PRIORITY_BENCH_PEER, NULL);
+    xTaskCreate(vYieldPeer, "Yield2", STACKSIZE_BENCH_PEER, (void *) 2,
+                PRIORITY_BENCH_PEER, NULL);
+    xTaskResumeAll();
+
+    vStatsPrint("switch", 0);
+}
+
+/*******************************************************************************
+ *  function :    vBenchQueue
+ ******************************************************************************/
+/** \brief        Queue ping-pong round trip by item size: send to the echo
+ *                peer and receive its answer
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchQueue(void)
+{
+
+    uint8_t u8Item[BENCH_LOGMSG_SIZE] = { 0 };
+    TaskHandle_t xPeer;
+    uint32_t u32Size;
+    uint32_t u32Sample;
+    uint32_t u32Start;
+
+    for (u32Size = 0; u32Size < BENCH_QUEUE_SIZES; u32Size++) {
+        xTaskCreate(vEchoPeer, "Echo", STACKSIZE_BENCH_PEER,
+                    (void *) (uintptr_t) u32Size, PRIORITY_BENCH_PEER, &xPeer);
+
+        vStatsReset();
+        for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+            u32Start = u32BenchNow();
+            xQueueSend(xPing[u32Size], u8Item, portMAX_DELAY);
+            xQueueReceive(xPong[u32Size], u8Item, portMAX_DELAY);
+            vStatsAdd((int32_t) (u32BenchNow() - u32Start));
+        }
+        vTaskDelete(xPeer);
+        vStatsPrint("queue_rtt", u8QueueSizes[u32Size]);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vBenchSemaphore
+ ******************************************************************************/
+/** \brief        Binary semaphore hand-off: give to the waiting peer
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchSemaphore(void)
+{
+
+    TaskHandle_t xPeer;
+    uint32_t u32Sample;
+
+    vStatsReset();
+    xTaskCreate(vSemaphorePeer, "Semaphore", STACKSIZE_BENCH_PEER, NULL,
+                PRIORITY_BENCH_PEER, &xPeer);
+    for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+        u32Stamp = u32BenchNow();
+        xSemaphoreGive(xSemaphore);
+    }
+    vTaskDelete(xPeer);
+    vStatsPrint("semaphore", 0);
+}
+
+/*******************************************************************************
+ *  function :    vBenchMutex
+ ******************************************************************************/
+/** \brief        Mutex hand-off: release the mutex the peer is waiting for
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchMutex(void)
+{
+
+    TaskHandle_t xPeer;
+    uint32_t u32Sample;
+
+    vStatsReset();
+    xTaskCreate(vMutexPeer, "Mutex", STACKSIZE_BENCH_PEER, NULL,
+                PRIORITY_BENCH_PEER, &xPeer);
+    for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+        xSemaphoreTake(xMutex, portMAX_DELAY);
+        xTaskNotifyGive(xPeer);         /* Peer blocks on the mutex */
+        u32Stamp = u32BenchNow();
+        xSemaphoreGive(xMutex);
+    }
+    vTaskDelete(xPeer);
+    vStatsPrint("mutex", 0);
+}
+
+/*******************************************************************************
+ *  function :    vBenchNotify
+ ******************************************************************************/
+/** \brief        Task notification wake-up of the waiting peer
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchNotify(void)
+{
+
+    TaskHandle_t xPeer;
+    uint32_t u32Sample;
+
+    vStatsReset();
+    xTaskCreate(vNotifyPeer, "Notify", STACKSIZE_BENCH_PEER, NULL,
+                PRIORITY_BENCH_PEER, &xPeer);
+    for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+        u32Stamp = u32BenchNow();
+        xTaskNotify(xPeer, 0, eNoAction);
+    }
+    vTaskDelete(xPeer);
+    vStatsPrint("notify", 0);
+}
+
+/*******************************************************************************
+ *  function :    vBenchDelay
+ ******************************************************************************/
+/** \brief        vTaskDelay wake-up jitter: deviation of the measured delay
+ *                from BENCH_DELAY_TICKS, started right after a tick
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchDelay(void)
+{
+
+    uint32_t u32Sample;
+    uint32_t u32Start;
+
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_DELAY_SAMPLES; u32Sample++) {
+        vTaskDelay(1);
+        u32Start = u32BenchNow();
+        vTaskDelay(BENCH_DELAY_TICKS);
+        vStatsAdd((int32_t) (u32BenchNow() - u32Start) -
+                  (int32_t) (BENCH_DELAY_TICKS * BENCH_TICK_UNITS));
+    }
+    vStatsPrint("delay", BENCH_DELAY_TICKS);
+}
+
+/*******************************************************************************
+ *  function :    vBenchDelayUntil
+ ******************************************************************************/
+/** \brief        vTaskDelayUntil wake-up jitter: deviation of the period
+ *                between two wake-ups from BENCH_DELAY_TICKS
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchDelayUntil(void)
+{
+
+    TickType_t xLastWake = xTaskGetTickCount();
+    uint32_t u32Sample;
+    uint32_t u32Last;
+    uint32_t u32Now;
+
+    vStatsReset();
+    vTaskDelayUntil(&xLastWake, BENCH_DELAY_TICKS);
+    u32Last = u32BenchNow();
+    for (u32Sample = 0; u32Sample < BENCH_DELAY_SAMPLES; u32Sample++) {
+        vTaskDelayUntil(&xLastWake, BENCH_DELAY_TICKS);
+        u32Now = u32BenchNow();
+        vStatsAdd((int32_t) (u32Now - u32Last) -
+                  (int32_t) (BENCH_DELAY_TICKS * BENCH_TICK_UNITS));
+        u32Last = u32Now;
+    }
+    vStatsPrint("delay_until", BENCH_DELAY_TICKS);
+}
+
+/*******************************************************************************
+ *  function :    vBenchIo1Led
+ ******************************************************************************/
+/** \brief        One LED update. Param 0: toggle with CARME_IO1_LED_Get and
+ *                CARME_IO1_LED_Set like U1A2, 1: vIo1LedToggle. Both store
+ *                the latch once, the BSP updates its shadow bit by bit.
+ *                Param 2: BSP write of the current value, one bus store,
+ *                3: vIo1LedWrite of the current value, no bus store.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchIo1Led(void)
+{
+
+    uint32_t u32Sample;
+    uint32_t u32Start;
+    uint8_t u8Led;
+
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+        u32Start = u32BenchNow();
+        CARME_IO1_LED_Get(&u8Led);
+        CARME_IO1_LED_Set(u8Led ^ 0x0F, 0x0F);
+        vStatsAdd((int32_t) (u32BenchNow() - u32Start));
+    }
+    vStatsPrint("io1_led", 0);
+
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+        u32Start = u32BenchNow();
+        vIo1LedToggle(0x0F);
+        vStatsAdd((int32_t) (u32BenchNow() - u32Start));
+    }
+    vStatsPrint("io1_led", 1);
+
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+        u32Start = u32BenchNow();
+        CARME_IO1_LED_Set(0x00, 0x0F);
+        vStatsAdd((int32_t) (u32BenchNow() - u32Start));
+    }
+    vStatsPrint("io1_led", 2);
+
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+        u32Start = u32BenchNow();
+        vIo1LedWrite(u8Io1LedGet(), 0x0F);
+        vStatsAdd((int32_t) (u32BenchNow() - u32Start));
+    }
+    vStatsPrint("io1_led", 3);
+}
+
+/*******************************************************************************
+ *  function :    vBenchIo1Read
+ ******************************************************************************/
+/** \brief        Reading the board. Param 0: CARME_IO1_SWITCH_Get,
+ *                CARME_IO1_BUTTON_Get and CARME_IO1_LED_Get one after the
+ *                other, 1: vIo1Snapshot.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchIo1Read(void)
+{
+
+    Io1Snapshot_t sSnapshot;
+    uint32_t u32Sample;
+    uint32_t u32Start;
+
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+        u32Start = u32BenchNow();
+        CARME_IO1_SWITCH_Get(&sSnapshot.u8Switch);
+        CARME_IO1_BUTTON_Get(&sSnapshot.u8Button);
+        CARME_IO1_LED_Get(&sSnapshot.u8Led);
+        vStatsAdd((int32_t) (u32BenchNow() - u32Start));
+    }
+    vStatsPrint("io1_read", 0);
+
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_SAMPLES; u32Sample++) {
+        u32Start = u32BenchNow();
+        vIo1Snapshot(&sSnapshot);
+        vStatsAdd((int32_t) (u32BenchNow() - u32Start));
+    }
+    vStatsPrint("io1_read", 1);
+}
+
+/*******************************************************************************
+ *  function :    vBenchText
+ ******************************************************************************/
+/** \brief        Text output per character of a philosopher state line in
+ *                font_8x16, 1e9 / mean_ns gives characters per second.
+ *                Param 0: LCD_DisplayStringXY, 1: vGcDisplayStringXY with
+ *                all glyphs cached, 2: vGcDisplayStringXY with an empty
+ *                cache, every glyph is expanded.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchText(void)
+{
+
+    uint32_t u32Sample;
+    uint32_t u32Start;
+
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_TEXT_SAMPLES; u32Sample++) {
+        u32Start = u32BenchNow();
+        LCD_DisplayStringXY(0, 0, cBenchText);
+        vStatsAdd((int32_t) ((u32BenchNow() - u32Start) / BENCH_TEXT_CHARS));
+    }
+    vStatsPrint("text", 0);
+
+    vGcInit();
+    vGcDisplayStringXY(0, 0, cBenchText);
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_TEXT_SAMPLES; u32Sample++) {
+        u32Start = u32BenchNow();
+        vGcDisplayStringXY(0, 0, cBenchText);
+        vStatsAdd((int32_t) ((u32BenchNow() - u32Start) / BENCH_TEXT_CHARS));
+    }
+    vStatsPrint("text", 1);
+
+    vStatsReset();
+    for (u32Sample = 0; u32Sample < BENCH_TEXT_SAMPLES; u32Sample++) {
+        vGcInit();
+        u32Start = u32BenchNow();
+        vGcDisplayStringXY(0, 0, cBenchText);
+        vStatsAdd((int32_t) ((u32BenchNow() - u32Start) / BENCH_TEXT_CHARS));
+    }
+    vStatsPrint("text", 2);
+}
+
+/*******************************************************************************
+ *  function :    vBenchLcd
+ ******************************************************************************/
+/** \brief        A full screen fill and a 320x240 blit from the PSRAM, time
+ *                per frame. Param 0: LCD_FillArea / LCD_WriteArea on the
+ *                CPU, 1: the CPU time of submitting the DMA job, 2: submit
+ *                and wait for the end of the job.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchLcd(void)
+{
+
+    uint16_t *pu16Blit = (uint16_t *) FSMC_PSRAM_BASE;
+    uint32_t u32Pixel;
+    uint32_t u32Param;
+    uint32_t u32Sample;
+    uint32_t u32Start;
+    uint16_t u16Color;
+
+    for (u32Pixel = 0; u32Pixel < BENCH_LCD_WIDTH * BENCH_LCD_HEIGHT;
+            u32Pixel++) {
+        pu16Blit[u32Pixel] = (uint16_t) u32Pixel;
+    }
+
+    for (u32Param = 0; u32Param < 3; u32Param++) {
+        vStatsReset();
+        for (u32Sample = 0; u32Sample < BENCH_LCD_SAMPLES; u32Sample++) {
+            u16Color = (u32Sample & 1) ? GUI_COLOR_BLUE : GUI_COLOR_BLACK;
+            u32Start = u32BenchNow();
+            if (u32Param == 0) {
+                LCD_FillArea(0, 0, BENCH_LCD_WIDTH - 1, BENCH_LCD_HEIGHT - 1,
+                             u16Color);
+            } else {
+                xLcdDmaFillArea(0, 0, BENCH_LCD_WIDTH - 1, BENCH_LCD_HEIGHT - 1,
+                                u16Color, portMAX_DELAY);
+            }
+            if (u32Param == 2) {
+                xLcdDmaWaitIdle(portMAX_DELAY);
+            }
+            vStatsAdd((int32_t) (u32BenchNow() - u32Start));
+            xLcdDmaWaitIdle(portMAX_DELAY);
+        }
+        vStatsPrint("lcd_fill", u32Param);
+    }
+
+    for (u32Param = 0; u32Param < 3; u32Param++) {
+        vStatsReset();
+        for (u32Sample = 0; u32Sample < BENCH_LCD_SAMPLES; u32Sample++) {
+            u32Start = u32BenchNow();
+            if (u32Param == 0) {
+                LCD_WriteArea(0, 0, BENCH_LCD_WIDTH - 1, BENCH_LCD_HEIGHT - 1,
+                              pu16Blit);
+            } else {
+                xLcdDmaWriteArea(0, 0, BENCH_LCD_WIDTH - 1, BENCH_LCD_HEIGHT - 1,
+                                 pu16Blit, portMAX_DELAY);
+            }
+            if (u32Param == 2) {
+                xLcdDmaWaitIdle(portMAX_DELAY);
+            }
+            vStatsAdd((int32_t) (u32BenchNow() - u32Start));
+            xLcdDmaWaitIdle(portMAX_DELAY);
+        }
+        vStatsPrint("lcd_blit", u32Param);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vBenchShapes
+ ******************************************************************************/
+/** \brief        Geometry primitives, time per pixel, 1e9 / mean_ns gives
+ *                pixels per second. circlef and circle have a radius of 100,
+ *                line goes from corner to corner, rectf covers the screen.
+ *                Param 0: the sGUI function, 1: the spanDraw function.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchShapes(void)
+{
+
+    uint32_t u32Test;
+    uint32_t u32Param;
+    uint32_t u32Sample;
+    uint32_t u32Start;
+    uint16_t u16Color;
+
+    for (u32Test = 0; u32Test < BENCH_SHAPE_TESTS; u32Test++) {
+        for (u32Param = 0; u32Param < 2; u32Param++) {
+            vStatsReset();
+            for (u32Sample = 0; u32Sample < BENCH_SHAPE_SAMPLES; u32Sample++) {
+                u16Color = (u32Sample & 1) ? GUI_COLOR_BLUE : GUI_COLOR_BLACK;
+                u32Start = u32BenchNow();
+                switch ((u32Test << 1) | u32Param) {
+                case 0:
+                    LCD_DrawCircleF(BENCH_SHAPE_X, BENCH_SHAPE_Y, BENCH_SHAPE_R,
+                                    u16Color);
+                    break;
+                case 1:
+                    vSdDrawCircleF(BENCH_SHAPE_X, BENCH_SHAPE_Y, BENCH_SHAPE_R,
+                                   u16Color);
+                    break;
+                case 2:
+                    LCD_DrawCircle(BENCH_SHAPE_X, BENCH_SHAPE_Y, BENCH_SHAPE_R,
+                                   u16Color);
+                    break;
+                case 3:
+                    vSdDrawCircle(BENCH_SHAPE_X, BENCH_SHAPE_Y, BENCH_SHAPE_R,
+                                  u16Color);
+                    break;
+                case 4:
+                    LCD_DrawLine(0, 0, BENCH_LCD_WIDTH - 1,
+                                 BENCH_LCD_HEIGHT - 1, u16Color);
+                    break;
+                case 5:
+                    vSdDrawLine(0, 0, BENCH_LCD_WIDTH - 1,
+                                BENCH_LCD_HEIGHT - 1, u16Color);
+                    break;
+                case 6:
+                    LCD_DrawRectF(0, 0, BENCH_LCD_WIDTH - 1,
+                                  BENCH_LCD_HEIGHT - 1, u16Color);
+                    break;
+                default:
+                    vSdDrawRectF(0, 0, BENCH_LCD_WIDTH - 1,
+                                 BENCH_LCD_HEIGHT - 1, u16Color);
+                    break;
+                }
+                vStatsAdd((int32_t) ((u32BenchNow() - u32Start) /
+                                     u32ShapePixels[u32Test]));
+            }
+            vStatsPrint(cShapeTest[u32Test], u32Param);
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    vBenchBitmap
+ ******************************************************************************/
+/** \brief        A full screen image from the SD card, time per image,
+ *                76800 * 1e9 / mean_ns gives pixels per second. Param 0:
+ *                LCD_BMP_DrawBitmap (not for RLE), 1: eBsDrawFile. Only the
+ *                images drawn without error are counted, without the files
+ *                the tests have no samples.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBenchBitmap(void)
+{
+
+    uint32_t u32Test;
+    uint32_t u32Param;
+    uint32_t u32Sample;
+    uint32_t u32Start;
+    uint32_t u32Time;
+    BMP_STATUS eStatus;
+
+    for (u32Test = 0; u32Test < BENCH_BMP_TESTS; u32Test++) {
+        for (u32Param = 0; u32Param < 2; u32Param++) {
+            if ((u32Param == 0) && (u32Test == BENCH_BMP_TESTS - 1)) {
+                continue;
+            }
+            vStatsReset();
+            for (u32Sample = 0; u32Sample < BENCH_BMP_SAMPLES; u32Sample++) {
+                u32Start = u32BenchNow();
+                if (u32Param == 0) {
+                    eStatus = LCD_BMP_DrawBitmap(cBmpFile[u32Test], 0, 0);
+                } else {
+                    eStatus = eBsDrawFile(cBmpFile[u32Test], 0, 0);
+                }
+                u32Time = u32BenchNow() - u32Start;
+                if (eStatus == BMP_OK) {
+                    vStatsAdd((int32_t) u32Time);
+                }
+            }
+            vStatsPrint(cBmpTest[u32Test], u32Param);
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    vYieldPeer
+ ******************************************************************************/
+/** \brief        Yield test peer. A sample is taken when the stamp was set
+ *                by the other peer, i.e. a switch happened.
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvData    peer number, 1 or 2
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vYieldPeer(void *pvData)
+{
+
+    uint8_t u8Self = (uint8_t) (uintptr_t) pvData;
+    uint32_t u32Now;
+
+    while (u8Stop == 0) {
+        u32Now = u32BenchNow();
+        if ((u8Owner != 0) && (u8Owner != u8Self)) {
+            vStatsAdd((int32_t) (u32Now - u32Stamp));
+            if (sStats.u32Count >= BENCH_SAMPLES) {
+                u8Stop = 1;
+            }
+        }
+        u8Owner = u8Self;
+        u32Stamp = u32BenchNow();
+        taskYIELD();
+    }
+    vTaskDelete(NULL);
+}
+
+/*******************************************************************************
+ *  function :    vEchoPeer
+ ******************************************************************************/
+/** \brief        Queue test peer, returns every item
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvData    index into u8QueueSizes
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vEchoPeer(void *pvData)
+{
+
+    uint32_t u32Size = (uint32_t) (uintptr_t) pvData;
+    uint8_t u8Item[BENCH_LOGMSG_SIZE];
+
+    for (;;) {
+        xQueueReceive(xPing[u32Size], u8Item, portMAX_DELAY);
+        xQueueSend(xPong[u32Size], u8Item, portMAX_DELAY);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSemaphorePeer
+ ******************************************************************************/
+/** \brief        Semaphore test peer
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvData    not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSemaphorePeer(void *pvData)
+{
+
+    for (;;) {
+        xSemaphoreTake(xSemaphore, portMAX_DELAY);
+        vStatsAdd((int32_t) (u32BenchNow() - u32Stamp));
+    }
+}
+
+/*******************************************************************************
+ *  function :    vMutexPeer
+ ******************************************************************************/
+/** \brief        Mutex test peer, waits for the mutex held by the measuring
+ *                task
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvData    not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vMutexPeer(void *pvData)
+{
+
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        xSemaphoreTake(xMutex, portMAX_DELAY);
+        vStatsAdd((int32_t) (u32BenchNow() - u32Stamp));
+        xSemaphoreGive(xMutex);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vNotifyPeer
+ ******************************************************************************/
+/** \brief        Notification test peer
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvData    not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vNotifyPeer(void *pvData)
+{
+
+    for (;;) {
+        xTaskNotifyWait(0, 0, NULL, portMAX_DELAY);
+        vStatsAdd((int32_t) (u32BenchNow() - u32Stamp));
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef BENCHTASK_H_
+#define BENCHTASK_H_
+/******************************************************************************/
+/** \file       benchTask.h
+ *******************************************************************************
+ *
+ *  \brief      Kernel micro-benchmarks. Measures context switch, queue
+ *              ping-pong, semaphore, mutex and notification hand-off and the
+ *              wake-up jitter of vTaskDelay/vTaskDelayUntil, and the cost of
+ *              an IO1 LED update and board read with the BSP and with
+ *              io1Service (io1_led, io1_read), and the text output through
+ *              sGUI and through the glyph cache (text, time per character)
+ *              and lines, circles and rectangles through sGUI and spanDraw
+ *              (circlef, circle, line, rectf, time per pixel) and full
+ *              screen images from the SD card through sGUI and bmpStream
+ *              (bmp24, bmp16, rle, time per image).
+ *              The results are written as CSV lines to the UART:
+ *
+ *                run,test,param,samples,min_ns,mean_ns,max_ns
+ *
+ *              On the target the times are taken with the DWT cycle counter,
+ *              in the host simulation with the monotonic clock.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vBenchTask
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+
+//----- Macros -----------------------------------------------------------------
+#define PRIORITY_BENCH_TASK   ( 2 )     /* Measuring task                     */
+#define PRIORITY_BENCH_PEER   ( 3 )     /* Tasks woken by the measuring task  */
+#define STACKSIZE_BENCH_TASK  ( 512 )
+#define STACKSIZE_BENCH_PEER  ( 256 )
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern void  vBenchTask(void *pvData);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* BENCHTASK_H_ */
@@ -0,0 +1,596 @@
+/******************************************************************************/
+/** \file       bmpStream.c
+ *******************************************************************************
+ *
+ *  \brief      Streaming BMP and RLE decoder. A chunk holds as many rows as
+ *              fit into BS_CHUNK_PIXELS; BMP chunks are read with a single
+ *              f_read, RLE files through u8Raw byte by byte. The rows of a
+ *              bottom-up BMP are stored reversed in the buffer, so every
+ *              chunk is one window from the top. With BS_DMA the end of a
+ *              window gives xDone, a buffer is filled again only after the
+ *              window sent from it has ended.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              eBsDrawFile
+ *  functions  local:
+ *              eBsDrawBmp
+ *              eBsDrawRle
+ *              vBsClip
+ *              vBsConvert
+ *              pu16BsBuffer
+ *              vBsSend
+ *              vBsDrain
+ *              vBsDone
+ *              s32BsByte
+ *              s32BsPixel
+ *              u16BsGet16
+ *              u32BsGet32
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <string.h>                     /* String handling                    */
+#include <ff.h>
+
+#include "bmpStream.h"
+#if BS_DMA
+#include "lcdDma.h"                     /* FreeRTOS.h first                   */
+#include <semphr.h>
+#endif
+
+//----- Macros -----------------------------------------------------------------
+#define BS_HEADER_BYTES       ( 66 )    /* BMP headers and the colour masks   */
+#define BS_BMP_MIN_BYTES      ( 54 )    /* File and info header               */
+#define BS_RLE_HEADER         ( 8 )     /* Magic, width and height            */
+#define BS_BI_RGB             ( 0 )     /* biCompression                      */
+#define BS_BI_BITFIELDS       ( 3 )
+
+/* Pixel formats of the file */
+#define BS_BGR24              ( 0 )
+#define BS_RGB565             ( 1 )
+#define BS_RGB555             ( 2 )
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    FIL      sFile;
+    uint16_t u16X, u16Y;                /* Upper left corner on the screen    */
+    uint16_t u16Width;                  /* Visible columns                    */
+    uint16_t u16Height;                 /* Visible rows                       */
+    uint16_t u16Pos;                    /* RLE: next byte in u8Raw            */
+    uint16_t u16Len;                    /* RLE: bytes in u8Raw                */
+    uint8_t  u8Buffer;                  /* Pixel buffer of the next chunk     */
+    uint8_t  u8Pending;                 /* Windows sent and not yet ended     */
+} BsStream_t;
+
+//----- Function prototypes ----------------------------------------------------
+static BMP_STATUS eBsDrawBmp(UINT uHeader);
+static BMP_STATUS eBsDrawRle(UINT uHeader);
+static void       vBsClip(uint16_t u16Width, uint16_t u16Height);
+static void       vBsConvert(const uint8_t *pu8Src, uint16_t *pu16Dst,
+                             uint16_t u16Count, uint8_t u8Format);
+static uint16_t  *pu16BsBuffer(void);
+static void       vBsSend(uint16_t u16Row, uint16_t u16Rows);
+static void       vBsDrain(void);
+#if BS_DMA
+static void       vBsDone(void *pvContext, BaseType_t *pxWoken);
+#endif
+static int32_t    s32BsByte(void);
+static int32_t    s32BsPixel(void);
+static uint16_t   u16BsGet16(const uint8_t *pu8Src);
+static uint32_t   u32BsGet32(const uint8_t *pu8Src);
+
+//----- Data -------------------------------------------------------------------
+static BsStream_t sStream;
+static uint8_t    u8Raw[BS_RAW_BYTES];
+/* Pixel buffers, in SRAM and not in the CCM, the DMA cannot reach it */
+static uint16_t   u16Pixels[2][BS_CHUNK_PIXELS];
+#if BS_DMA
+static SemaphoreHandle_t xDone;         /* Given at the end of every window   */
+#endif
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    eBsDrawFile
+ ******************************************************************************/
+/** \brief        Draw a BMP or RLE file, the type is taken from the first
+ *                bytes. Returns when the last window has been sent.
+ *
+ *  \type         global
+ *
+ *  \param[in]    pcFile            file name, e.g. "0:splash.rle"
+ *  \param[in]    u16Xpos, u16Ypos  upper left corner
+ *
+ *  \return       BMP_OK or the error like LCD_BMP_DrawBitmap
+ *
+ ******************************************************************************/
+BMP_STATUS eBsDrawFile(const char *pcFile, uint16_t u16Xpos, uint16_t u16Ypos)
+{
+
+    BMP_STATUS eStatus;
+    UINT uRead;
+
+    if ((u16Xpos > SCRN_RIGHT) || (u16Ypos > SCRN_BOTTOM)) {
+        return BMP_INVALID_ARGUMENT;
+    }
+#if BS_DMA
+    if (xDone == NULL) {
+        xDone = xSemaphoreCreateCounting(2, 0);
+    }
+#endif
+    if (f_open(&sStream.sFile, pcFile, FA_READ | FA_OPEN_EXISTING) != FR_OK) {
+        return BMP_FILE_NOT_FOUND;
+    }
+    sStream.u16X = u16Xpos;
+    sStream.u16Y = u16Ypos;
+    sStream.u8Buffer = 0;
+    sStream.u8Pending = 0;
+
+    if (f_read(&sStream.sFile, u8Raw, BS_HEADER_BYTES, &uRead) != FR_OK) {
+        eStatus = BMP_IO_ERROR;
+    } else if ((uRead >= BS_BMP_MIN_BYTES) &&
+               (u8Raw[0] == 'B') && (u8Raw[1] == 'M')) {
+        eStatus = eBsDrawBmp(uRead);
+    } else if ((uRead >= BS_RLE_HEADER) && (memcmp(u8Raw, "RL16", 4) == 0)) {
+        eStatus = eBsDrawRle(uRead);
+    } else {
+        eStatus = BMP_FILE_INVALID;
+    }
+
+    vBsDrain();
+    f_close(&sStream.sFile);
+    return eStatus;
+}
+
+/*******************************************************************************
+ *  function :    eBsDrawBmp
+ ******************************************************************************/
+/** \brief        Draw an uncompressed BMP file. The rows below the screen
+ *                are skipped with f_lseek, each chunk is one f_read.
+ *
+ *  \type         local
+ *
+ *  \param[in]    uHeader   bytes of the file in u8Raw
+ *
+ *  \return       BMP_OK, BMP_FILE_NOT_SUPPORTED, BMP_FILE_INVALID,
+ *                BMP_OUT_OF_MEMORY or BMP_IO_ERROR
+ *
+ ******************************************************************************/
+static BMP_STATUS eBsDrawBmp(UINT uHeader)
+{
+
+    uint32_t u32Offset = u32BsGet32(&u8Raw[10]);
+    int32_t  s32Width = (int32_t) u32BsGet32(&u8Raw[18]);
+    int32_t  s32Height = (int32_t) u32BsGet32(&u8Raw[22]);
+    uint16_t u16Bits = u16BsGet16(&u8Raw[28]);
+    uint32_t u32Compression = u32BsGet32(&u8Raw[30]);
+    uint32_t u32Stride;
+    uint32_t u32Start;
+    uint32_t u32Bytes;
+    uint8_t  u8TopDown = 0;
+    uint8_t  u8Format;
+    uint16_t u16Rows;
+    uint16_t u16Done;
+    uint16_t u16Row;
+    uint16_t *pu16Dst;
+    UINT     uRead;
+
+    if (s32Height < 0) {
+        u8TopDown = 1;
+        s32Height = -s32Height;
+    }
+    if ((s32Width <= 0) || (s32Width > UINT16_MAX) ||
+        (s32Height == 0) || (s32Height > UINT16_MAX)) {
+        return BMP_FILE_INVALID;
+    }
+
+    if ((u16Bits == 24) && (u32Compression == BS_BI_RGB)) {
+        u8Format = BS_BGR24;
+    } else if ((u16Bits == 16) && (u32Compression == BS_BI_RGB)) {
+        u8Format = BS_RGB555;
+    } else if ((u16Bits == 16) && (u32Compression == BS_BI_BITFIELDS) &&
+               (uHeader >= BS_HEADER_BYTES) &&
+               (u32BsGet32(&u8Raw[54]) == 0xF800) &&
+               (u32BsGet32(&u8Raw[58]) == 0x07E0) &&
+               (u32BsGet32(&u8Raw[62]) == 0x001F)) {
+        u8Format = BS_RGB565;
+    } else if ((u16Bits == 16) && (u32Compression == BS_BI_BITFIELDS) &&
+               (uHeader >= BS_HEADER_BYTES) &&
+               (u32BsGet32(&u8Raw[54]) == 0x7C00) &&
+               (u32BsGet32(&u8Raw[58]) == 0x03E0) &&
+               (u32BsGet32(&u8Raw[62]) == 0x001F)) {
+        u8Format = BS_RGB555;
+    } else {
+        return BMP_FILE_NOT_SUPPORTED;
+    }
+
+    /* Rows are padded to 4 bytes */
+    u32Stride = (((uint32_t) s32Width * (u16Bits / 8)) + 3) & ~3UL;
+    vBsClip((uint16_t) s32Width, (uint16_t) s32Height);
+    u16Rows = BS_CHUNK_PIXELS / sStream.u16Width;
+    if (u16Rows > BS_RAW_BYTES / u32Stride) {
+        u16Rows = (uint16_t) (BS_RAW_BYTES / u32Stride);
+    }
+    if (u16Rows == 0) {
+        return BMP_OUT_OF_MEMORY;
+    }
+
+    /* A bottom-up file starts with the last row */
+    u32Start = u32Offset;
+    if (u8TopDown == 0) {
+        u32Start += ((uint32_t) s32Height - sStream.u16Height) * u32Stride;
+    }
+    if ((f_lseek(&sStream.sFile, u32Start) != FR_OK) ||
+        (f_tell(&sStream.sFile) != u32Start)) {
+        return BMP_FILE_INVALID;
+    }
+
+    for (u16Done = 0; u16Done < sStream.u16Height; u16Done += u16Rows) {
+        if (u16Rows > sStream.u16Height - u16Done) {
+            u16Rows = sStream.u16Height - u16Done;
+        }
+        u32Bytes = u16Rows * u32Stride;
+        if (f_read(&sStream.sFile, u8Raw, u32Bytes, &uRead) != FR_OK) {
+            return BMP_IO_ERROR;
+        }
+        if (uRead < u32Bytes) {
+            return BMP_FILE_INVALID;
+        }
+        pu16Dst = pu16BsBuffer();
+        for (u16Row = 0; u16Row < u16Rows; u16Row++) {
+            vBsConvert(&u8Raw[u16Row * u32Stride],
+                       &pu16Dst[(u8TopDown ? u16Row : (u16Rows - 1 - u16Row)) *
+                                sStream.u16Width],
+                       sStream.u16Width, u8Format);
+        }
+        vBsSend(u8TopDown ? u16Done : (sStream.u16Height - u16Done - u16Rows),
+                u16Rows);
+    }
+    return BMP_OK;
+}
+
+/*******************************************************************************
+ *  function :    eBsDrawRle
+ ******************************************************************************/
+/** \brief        Draw an RLE file. The packets are decoded into the pixel
+ *                buffer, a chunk is sent whenever its rows are complete.
+ *
+ *  \type         local
+ *
+ *  \param[in]    uHeader   bytes of the file in u8Raw
+ *
+ *  \return       BMP_OK or BMP_FILE_INVALID
+ *
+ ******************************************************************************/
+static BMP_STATUS eBsDrawRle(UINT uHeader)
+{
+
+    uint16_t u16Width = u16BsGet16(&u8Raw[4]);
+    uint16_t u16Height = u16BsGet16(&u8Raw[6]);
+    uint16_t u16Rows;
+    uint16_t u16Done = 0;               /* Rows sent                          */
+    uint16_t u16Row = 0;                /* Row in the chunk                   */
+    uint16_t u16Col = 0;                /* Column in the image                */
+    uint16_t u16Count;
+    uint16_t *pu16Dst;
+    int32_t  s32Ctrl;
+    int32_t  s32Pixel = 0;
+
+    if ((u16Width == 0) || (u16Height == 0)) {
+        return BMP_FILE_INVALID;
+    }
+    sStream.u16Pos = BS_RLE_HEADER;
+    sStream.u16Len = (uint16_t) uHeader;
+    vBsClip(u16Width, u16Height);
+    u16Rows = BS_CHUNK_PIXELS / sStream.u16Width;
+    pu16Dst = pu16BsBuffer();
+
+    while (u16Done < sStream.u16Height) {
+        s32Ctrl = s32BsByte();
+        if (s32Ctrl < 0) {
+            return BMP_FILE_INVALID;
+        }
+        u16Count = (uint16_t) (s32Ctrl & 0x7F) + 1;
+        if (s32Ctrl & 0x80) {
+            s32Pixel = s32BsPixel();
+        }
+        for (; u16Count > 0; u16Count--) {
+            if ((s32Ctrl & 0x80) == 0) {
+                s32Pixel = s32BsPixel();
+            }
+            if (s32Pixel < 0) {
+                return BMP_FILE_INVALID;
+            }
+            if (u16Col < sStream.u16Width) {
+                pu16Dst[(u16Row * sStream.u16Width) + u16Col] =
+                    (uint16_t) s32Pixel;
+            }
+            if (++u16Col < u16Width) {
+                continue;
+            }
+            /* End of a row, send the chunk when it is full */
+            u16Col = 0;
+            u16Row++;
+            if ((u16Row == u16Rows) ||
+                (u16Done + u16Row == sStream.u16Height)) {
+                vBsSend(u16Done, u16Row);
+                u16Done += u16Row;
+                u16Row = 0;
+                if (u16Done == sStream.u16Height) {
+                    break;
+                }
+                pu16Dst = pu16BsBuffer();
+            }
+        }
+    }
+    return BMP_OK;
+}
+
+/*******************************************************************************
+ *  function :    vBsClip
+ ******************************************************************************/
+/** \brief        Visible part of an image at the position of the stream
+ *
+ *  \type         local
+ *
+ *  \param[in]    u16Width, u16Height   size of the image
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBsClip(uint16_t u16Width, uint16_t u16Height)
+{
+
+    sStream.u16Width = u16Width;
+    sStream.u16Height = u16Height;
+    if (u16Width > SCRN_RIGHT + 1 - sStream.u16X) {
+        sStream.u16Width = SCRN_RIGHT + 1 - sStream.u16X;
+    }
+    if (u16Height > SCRN_BOTTOM + 1 - sStream.u16Y) {
+        sStream.u16Height = SCRN_BOTTOM + 1 - sStream.u16Y;
+    }
+}
+
+/*******************************************************************************
+ *  function :    vBsConvert
+ ******************************************************************************/
+/** \brief        Convert the pixels of one BMP row to RGB565
+ *
+ *  \type         local
+ *
+ *  \param[in]    pu8Src    row in the file format
+ *  \param[out]   pu16Dst   RGB565 pixels
+ *  \param[in]    u16Count  pixels
+ *  \param[in]    u8Format  BS_BGR24, BS_RGB565 or BS_RGB555
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBsConvert(const uint8_t *pu8Src, uint16_t *pu16Dst,
+                       uint16_t u16Count, uint8_t u8Format)
+{
+
+    uint16_t u16Pixel;
+
+    if (u8Format == BS_RGB565) {
+        /* Little endian in the file and in memory */
+        memcpy(pu16Dst, pu8Src, u16Count * sizeof(uint16_t));
+    } else if (u8Format == BS_RGB555) {
+        for (; u16Count > 0; u16Count--) {
+            u16Pixel = (uint16_t) (pu8Src[0] | (pu8Src[1] << 8));
+            *pu16Dst++ = (uint16_t) (((u16Pixel & 0x7FE0) << 1) |
+                                     (u16Pixel & 0x001F));
+            pu8Src += 2;
+        }
+    } else {
+        for (; u16Count > 0; u16Count--) {
+            *pu16Dst++ = (uint16_t) (((pu8Src[2] & 0xF8) << 8) |
+                                     ((pu8Src[1] & 0xFC) << 3) |
+                                     (pu8Src[0] >> 3));
+            pu8Src += 3;
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    pu16BsBuffer
+ ******************************************************************************/
+/** \brief        Pixel buffer for the next chunk. With BS_DMA it was sent two
+ *                windows ago, wait until that window has ended.
+ *
+ *  \type         local
+ *
+ *  \return       buffer of BS_CHUNK_PIXELS pixels
+ *
+ ******************************************************************************/
+static uint16_t *pu16BsBuffer(void)
+{
+
+#if BS_DMA
+    if (sStream.u8Pending == 2) {
+        /* Windows end in order, the first one to end is the older */
+        xSemaphoreTake(xDone, portMAX_DELAY);
+        sStream.u8Pending--;
+    }
+#endif
+    return u16Pixels[sStream.u8Buffer];
+}
+
+/*******************************************************************************
+ *  function :    vBsSend
+ ******************************************************************************/
+/** \brief        Send the current pixel buffer as one window and switch to
+ *                the other buffer
+ *
+ *  \type         local
+ *
+ *  \param[in]    u16Row    first image row of the chunk
+ *  \param[in]    u16Rows   rows of the chunk
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBsSend(uint16_t u16Row, uint16_t u16Rows)
+{
+
+    uint16_t u16X1 = sStream.u16X;
+    uint16_t u16Y1 = sStream.u16Y + u16Row;
+    uint16_t u16X2 = u16X1 + sStream.u16Width - 1;
+    uint16_t u16Y2 = u16Y1 + u16Rows - 1;
+#if BS_DMA
+    LcdDmaJob_t sJob;
+
+    sJob.u16X1 = u16X1;
+    sJob.u16Y1 = u16Y1;
+    sJob.u16X2 = u16X2;
+    sJob.u16Y2 = u16Y2;
+    sJob.pu16Data = u16Pixels[sStream.u8Buffer];
+    sJob.u16Stride = sStream.u16Width;
+    sJob.u16Color = 0;
+    sJob.pfDone = vBsDone;
+    sJob.pvContext = NULL;
+    xLcdDmaSubmit(&sJob, portMAX_DELAY);
+    sStream.u8Pending++;
+#else
+    LCD_WriteArea(u16X1, u16Y1, u16X2, u16Y2, u16Pixels[sStream.u8Buffer]);
+#endif
+    sStream.u8Buffer ^= 1;
+}
+
+/*******************************************************************************
+ *  function :    vBsDrain
+ ******************************************************************************/
+/** \brief        Wait until the windows sent from the pixel buffers have
+ *                ended
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBsDrain(void)
+{
+
+#if BS_DMA
+    for (; sStream.u8Pending > 0; sStream.u8Pending--) {
+        xSemaphoreTake(xDone, portMAX_DELAY);
+    }
+#endif
+}
+
+#if BS_DMA
+/*******************************************************************************
+ *  function :    vBsDone
+ ******************************************************************************/
+/** \brief        End of a window, called by lcdDma in the interrupt
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvContext   not used
+ *  \param[out]   pxWoken     set if a task was woken
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vBsDone(void *pvContext, BaseType_t *pxWoken)
+{
+
+    (void) pvContext;
+    xSemaphoreGiveFromISR(xDone, pxWoken);
+}
+#endif
+
+/*******************************************************************************
+ *  function :    s32BsByte
+ ******************************************************************************/
+/** \brief        Next byte of an RLE file, u8Raw is refilled with one f_read
+ *                when it is empty
+ *
+ *  \type         local
+ *
+ *  \return       byte, -1 at the end of the file or on an error
+ *
+ ******************************************************************************/
+static int32_t s32BsByte(void)
+{
+
+    UINT uRead;
+
+    if (sStream.u16Pos == sStream.u16Len) {
+        if ((f_read(&sStream.sFile, u8Raw, BS_RAW_BYTES, &uRead) != FR_OK) ||
+            (uRead == 0)) {
+            return -1;
+        }
+        sStream.u16Pos = 0;
+        sStream.u16Len = (uint16_t) uRead;
+    }
+    return u8Raw[sStream.u16Pos++];
+}
+
+/*******************************************************************************
+ *  function :    s32BsPixel
+ ******************************************************************************/
+/** \brief        Next RGB565 pixel of an RLE file
+ *
+ *  \type         local
+ *
+ *  \return       pixel, -1 at the end of the file or on an error
+ *
+ ******************************************************************************/
+static int32_t s32BsPixel(void)
+{
+
+    int32_t s32Low = s32BsByte();
+    int32_t s32High = s32BsByte();
+
+    if ((s32Low < 0) || (s32High < 0)) {
+        return -1;
+    }
+    return s32Low | (s32High << 8);
+}
+
+/*******************************************************************************
+ *  function :    u16BsGet16
+ ******************************************************************************/
+/** \brief        Little endian 16 bit value of a header, not aligned
+ *
+ *  \type         local
+ *
+ *  \param[in]    pu8Src    first byte
+ *
+ *  \return       value
+ *
+ ******************************************************************************/
+static uint16_t u16BsGet16(const uint8_t *pu8Src)
+{
+
+    return (uint16_t) (pu8Src[0] | (pu8Src[1] << 8));
+}
+
+/*******************************************************************************
+ *  function :    u32BsGet32
+ ******************************************************************************/
+/** \brief        Little endian 32 bit value of a header, not aligned
+ *
+ *  \type         local
+ *
+ *  \param[in]    pu8Src    first byte
+ *
+ *  \return       value
+ *
+ ******************************************************************************/
+static uint32_t u32BsGet32(const uint8_t *pu8Src)
+{
+
+    return (uint32_t) pu8Src[0] | ((uint32_t) pu8Src[1] << 8) |
+           ((uint32_t) pu8Src[2] << 16) | ((uint32_t) pu8Src[3] << 24);
+}
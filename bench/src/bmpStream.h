@@ -0,0 +1,56 @@
+#ifndef BMPSTREAM_H_
+#define BMPSTREAM_H_
+/******************************************************************************/
+/** \file       bmpStream.h
+ *******************************************************************************
+ *
+ *  \brief      Streaming image decoder from FatFs to the display. The file
+ *              is read in chunks of rows with f_read, every chunk is
+ *              converted to RGB565 and sent as one LCD_WriteArea window.
+ *              With BS_DMA set the window is a job of lcdDma and two pixel
+ *              buffers alternate: the next chunk is read and converted
+ *              while the DMA sends the previous one. sGUI reads and draws
+ *              the bitmap pixel by pixel.
+ *
+ *              Supported are uncompressed BMP files with 24 bit (BGR) and
+ *              16 bit (X1R5G5B5, or bit fields R5G6B5 / X1R5G5B5) pixels,
+ *              bottom-up or top-down, and RLE files:
+ *
+ *                "RL16", width, height     (u16 little endian)
+ *                packets in rows from the top, may cross row ends:
+ *                  0x00..0x7F  n + 1 RGB565 pixels follow
+ *                  0x80..0xFF  the next RGB565 pixel (n & 0x7F) + 1 times
+ *
+ *              The image is clipped at the right and bottom screen border.
+ *              One task draws at a time, with BS_DMA it waits on the
+ *              semaphore the lcdDma callback gives after every window.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    eBsDrawFile
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <lcd.h>                        /* BMP_STATUS                         */
+
+//----- Macros -----------------------------------------------------------------
+#ifndef BS_DMA
+#define BS_DMA                ( 1 )     /* Windows by lcdDma, 0: by the CPU   */
+#endif
+
+#define BS_CHUNK_PIXELS       ( 2048 )  /* Pixels per window and buffer       */
+#define BS_RAW_BYTES          ( 3 * BS_CHUNK_PIXELS ) /* f_read buffer        */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+extern BMP_STATUS eBsDrawFile(const char *pcFile, uint16_t u16Xpos,
+                              uint16_t u16Ypos);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* BMPSTREAM_H_ */
@@ -0,0 +1,59 @@
+#ifndef IO1SERVICE_H_
+#define IO1SERVICE_H_
+/******************************************************************************/
+/** \file       io1Service.h
+ *******************************************************************************
+ *
+ *  \brief      Front end of the CARME IO1 board. The LED latch on the
+ *              external bus is write only, the service keeps its value in a
+ *              RAM shadow. An update changes the shadow with one atomic
+ *              read-modify-write and stores it to the latch, so tasks and
+ *              interrupts with different masks never lose a bit and an
+ *              update that changes nothing skips the bus. vIo1Snapshot
+ *              reads switches, buttons and LEDs together.
+ *              Once vIo1Init is called, use the service instead of
+ *              CARME_IO1_LED_Set/Get, the shadow of the BSP is not updated.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vIo1Init
+ *              vIo1LedWrite
+ *              vIo1LedToggle
+ *              u8Io1LedGet
+ *              vIo1Snapshot
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <carme_io1.h>                  /* CARMEIO1 Board Support Package     */
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+
+//----- Macros -----------------------------------------------------------------
+#ifndef CARME_IO1_LED_LATCH
+/* LED latch of the IO1 board, FSMC bank 1 region 4 */
+#define CARME_IO1_LED_LATCH   ( ( volatile uint8_t * ) 0x6C000200 )
+#endif
+
+//----- Data types -------------------------------------------------------------
+typedef struct {
+    uint8_t    u8Switch;                /* Switches S0..S7                    */
+    uint8_t    u8Button;                /* Buttons T0..T3                     */
+    uint8_t    u8Led;                   /* LEDs, from the shadow              */
+    TickType_t xTick;                   /* Tick count of the reading          */
+} Io1Snapshot_t;
+
+//----- Function prototypes ----------------------------------------------------
+extern void    vIo1Init(void);
+extern void    vIo1LedWrite(uint8_t u8Value, uint8_t u8Mask);
+extern void    vIo1LedToggle(uint8_t u8Mask);
+extern uint8_t u8Io1LedGet(void);
+extern void    vIo1Snapshot(Io1Snapshot_t *psSnapshot);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* IO1SERVICE_H_ */
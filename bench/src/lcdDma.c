@@ -0,0 +1,378 @@
+/******************************************************************************/
+/** \file       lcdDma.c
+ *******************************************************************************
+ *
+ *  \brief      LCD jobs with DMA2 stream 1. Memory to memory is the only
+ *              mode that needs no request line, the source is the pixel
+ *              buffer (or the fill colour, not incremented), the destination
+ *              the fixed data register of the SSD1963 on the FSMC. A job is
+ *              split into transfers of at most LCD_DMA_CHUNK pixels, or one
+ *              row if the rows are not contiguous in the buffer; the
+ *              controller keeps filling the same window.
+ *              The host simulation has no DMA, a job is drawn at once.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vLcdDmaInit
+ *              xLcdDmaSubmit
+ *              xLcdDmaFillArea
+ *              xLcdDmaWriteArea
+ *              xLcdDmaWaitIdle
+ *              vLcdDmaNotifyTask
+ *              DMA2_Stream1_IRQHandler
+ *  functions  local:
+ *              vLcdDmaStart
+ *              vLcdDmaChunk
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>                      /* CARME Module                       */
+#include <lcd.h>
+
+#ifndef CARME_SIM
+#include <ssd1963.h>                    /* SSD1963_SetArea                    */
+#include <ssd1963_lld.h>                /* GL_LCD                             */
+#include <ssd1963_cmd.h>
+#endif
+
+#include "lcdDma.h"                 /* FreeRTOS.h first                   */
+#include <queue.h>
+#include <semphr.h>
+
+//----- Macros -----------------------------------------------------------------
+#define LCD_DMA_IRQ_PRIORITY  ( configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 2 )
+#define LCD_DMA_FLAGS         ( DMA_FLAG_TCIF1 | DMA_FLAG_HTIF1 | DMA_FLAG_TEIF1 | \
+                                DMA_FLAG_DMEIF1 | DMA_FLAG_FEIF1 )
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+#ifndef CARME_SIM
+static void vLcdDmaStart(void);
+static void vLcdDmaChunk(void);
+#endif
+
+//----- Data -------------------------------------------------------------------
+#ifndef CARME_SIM
+static QueueHandle_t     xJobs;         /* Jobs behind the running one        */
+static SemaphoreHandle_t xIdle;         /* Given when the last job ends       */
+static volatile uint8_t  u8Busy;        /* A job is running                   */
+static LcdDmaJob_t       sJob;          /* Running job                        */
+static const uint16_t   *pu16Next;      /* Source of the next transfer        */
+static uint32_t          u32Left;       /* Pixels of the job still to send    */
+static uint16_t          u16Width;      /* Pixels per row of the job          */
+#endif
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vLcdDmaInit
+ ******************************************************************************/
+/** \brief        Set up DMA2 stream 1 and its interrupt. LCD_Init has to be
+ *                called first. Jobs may be submitted before the scheduler
+ *                starts, they complete once it runs.
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vLcdDmaInit(void)
+{
+
+#ifndef CARME_SIM
+    NVIC_InitTypeDef sNvic;
+
+    xJobs = xQueueCreate(LCD_DMA_QUEUE, sizeof(LcdDmaJob_t));
+    xIdle = xSemaphoreCreateBinary();
+
+    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA2, ENABLE);
+    DMA_DeInit(DMA2_Stream1);
+    DMA_ITConfig(DMA2_Stream1, DMA_IT_TC, ENABLE);
+
+    sNvic.NVIC_IRQChannel = DMA2_Stream1_IRQn;
+    sNvic.NVIC_IRQChannelPreemptionPriority = LCD_DMA_IRQ_PRIORITY;
+    sNvic.NVIC_IRQChannelSubPriority = 0;
+    sNvic.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&sNvic);
+#endif
+}
+
+/*******************************************************************************
+ *  function :    xLcdDmaSubmit
+ ******************************************************************************/
+/** \brief        Queue a job, it starts at once if the DMA is idle. The job
+ *                is copied, the pixels must stay valid until it ends.
+ *
+ *  \type         global
+ *
+ *  \param[in]    psJob     job
+ *  \param[in]    xWait     ticks to wait for room in the queue
+ *
+ *  \return       pdPASS, errQUEUE_FULL if the queue stayed full
+ *
+ ******************************************************************************/
+BaseType_t xLcdDmaSubmit(const LcdDmaJob_t *psJob, TickType_t xWait)
+{
+
+#ifdef CARME_SIM
+    BaseType_t xWoken = pdFALSE;
+    uint16_t u16Y;
+
+    if (psJob->pu16Data == NULL) {
+        LCD_FillArea(psJob->u16X1, psJob->u16Y1, psJob->u16X2, psJob->u16Y2,
+                     psJob->u16Color);
+    } else {
+        for (u16Y = psJob->u16Y1; u16Y <= psJob->u16Y2; u16Y++) {
+            LCD_WriteArea(psJob->u16X1, u16Y, psJob->u16X2, u16Y,
+                          (uint16_t *) &psJob->pu16Data[(u16Y - psJob->u16Y1) *
+                                                        psJob->u16Stride]);
+        }
+    }
+    if (psJob->pfDone != NULL) {
+        psJob->pfDone(psJob->pvContext, &xWoken);
+    }
+    return pdPASS;
+#else
+    if (xQueueSend(xJobs, psJob, xWait) != pdPASS) {
+        return errQUEUE_FULL;
+    }
+
+    /* Enqueued first: the interrupt cannot go idle with a job left behind */
+    taskENTER_CRITICAL();
+    if ((u8Busy == 0) && (xQueueReceive(xJobs, &sJob, 0) == pdPASS)) {
+        u8Busy = 1;
+        vLcdDmaStart();
+    }
+    taskEXIT_CRITICAL();
+    return pdPASS;
+#endif
+}
+
+/*******************************************************************************
+ *  function :    xLcdDmaFillArea
+ ******************************************************************************/
+/** \brief        Fill a window with one colour, like LCD_FillArea
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16X1, u16Y1  upper left corner
+ *  \param[in]    u16X2, u16Y2  lower right corner
+ *  \param[in]    u16Color      RGB565 colour
+ *  \param[in]    xWait         ticks to wait for room in the queue
+ *
+ *  \return       pdPASS, errQUEUE_FULL if the queue stayed full
+ *
+ ******************************************************************************/
+BaseType_t xLcdDmaFillArea(uint16_t u16X1, uint16_t u16Y1,
+                           uint16_t u16X2, uint16_t u16Y2,
+                           uint16_t u16Color, TickType_t xWait)
+{
+
+    LcdDmaJob_t sFill = { u16X1, u16Y1, u16X2, u16Y2, NULL, 0, u16Color,
+                          NULL, NULL };
+
+    return xLcdDmaSubmit(&sFill, xWait);
+}
+
+/*******************************************************************************
+ *  function :    xLcdDmaWriteArea
+ ******************************************************************************/
+/** \brief        Copy a buffer into a window, like LCD_WriteArea. The
+ *                buffer holds the rows one after the other.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u16X1, u16Y1  upper left corner
+ *  \param[in]    u16X2, u16Y2  lower right corner
+ *  \param[in]    pu16Data      pixels, valid until the job ends
+ *  \param[in]    xWait         ticks to wait for room in the queue
+ *
+ *  \return       pdPASS, errQUEUE_FULL if the queue stayed full
+ *
+ ******************************************************************************/
+BaseType_t xLcdDmaWriteArea(uint16_t u16X1, uint16_t u16Y1,
+                            uint16_t u16X2, uint16_t u16Y2,
+                            const uint16_t *pu16Data, TickType_t xWait)
+{
+
+    LcdDmaJob_t sWrite = { u16X1, u16Y1, u16X2, u16Y2, pu16Data,
+                           (uint16_t) (u16X2 - u16X1 + 1), 0, NULL, NULL };
+
+    return xLcdDmaSubmit(&sWrite, xWait);
+}
+
+/*******************************************************************************
+ *  function :    xLcdDmaWaitIdle
+ ******************************************************************************/
+/** \brief        Block until all queued jobs have ended. Must not be called
+ *                before the scheduler runs.
+ *
+ *  \type         global
+ *
+ *  \param[in]    xWait     ticks to wait for the end of each job
+ *
+ *  \return       pdPASS, pdFAIL on timeout
+ *
+ ******************************************************************************/
+BaseType_t xLcdDmaWaitIdle(TickType_t xWait)
+{
+
+#ifndef CARME_SIM
+    uint8_t u8Running;
+
+    for (;;) {
+        taskENTER_CRITICAL();
+        u8Running = u8Busy;
+        taskEXIT_CRITICAL();
+        if (u8Running == 0) {
+            break;
+        }
+        /* A stale give of an earlier idle only repeats the check */
+        if (xSemaphoreTake(xIdle, xWait) != pdPASS) {
+            return pdFAIL;
+        }
+    }
+#endif
+    return pdPASS;
+}
+
+/*******************************************************************************
+ *  function :    vLcdDmaNotifyTask
+ ******************************************************************************/
+/** \brief        Callback for pfDone which notifies a task, so the task can
+ *                wait for its job with ulTaskNotifyTake
+ *
+ *  \type         global
+ *
+ *  \param[in]    pvContext   TaskHandle_t of the task
+ *  \param[out]   pxWoken     set if the task has a higher priority
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vLcdDmaNotifyTask(void *pvContext, BaseType_t *pxWoken)
+{
+
+    vTaskNotifyGiveFromISR((TaskHandle_t) pvContext, pxWoken);
+}
+
+#ifndef CARME_SIM
+/*******************************************************************************
+ *  function :    DMA2_Stream1_IRQHandler
+ ******************************************************************************/
+/** \brief        End of a transfer: start the next piece of the job, or end
+ *                the job and start the next one from the queue
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void DMA2_Stream1_IRQHandler(void)
+{
+
+    BaseType_t xWoken = pdFALSE;
+
+    if (DMA_GetITStatus(DMA2_Stream1, DMA_IT_TCIF1) != RESET) {
+        DMA_ClearITPendingBit(DMA2_Stream1, DMA_IT_TCIF1);
+
+        if (u32Left != 0) {
+            vLcdDmaChunk();
+        } else {
+            if (sJob.pfDone != NULL) {
+                sJob.pfDone(sJob.pvContext, &xWoken);
+            }
+            if (xQueueReceiveFromISR(xJobs, &sJob, &xWoken) == pdPASS) {
+                vLcdDmaStart();
+            } else {
+                u8Busy = 0;
+                xSemaphoreGiveFromISR(xIdle, &xWoken);
+            }
+        }
+    }
+    portYIELD_FROM_ISR(xWoken);
+}
+
+/*******************************************************************************
+ *  function :    vLcdDmaStart
+ ******************************************************************************/
+/** \brief        Open the window of sJob and start its first transfer
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vLcdDmaStart(void)
+{
+
+    u16Width = sJob.u16X2 - sJob.u16X1 + 1;
+    u32Left = (uint32_t) u16Width * (sJob.u16Y2 - sJob.u16Y1 + 1);
+    pu16Next = sJob.pu16Data;
+
+    SSD1963_SetArea(sJob.u16X1, sJob.u16Y1, sJob.u16X2, sJob.u16Y2);
+    SSD1963_WriteCommand(CMD_WR_MEMSTART);
+    vLcdDmaChunk();
+}
+
+/*******************************************************************************
+ *  function :    vLcdDmaChunk
+ ******************************************************************************/
+/** \brief        Start the next transfer of sJob: up to LCD_DMA_CHUNK pixels
+ *                of a fill or of contiguous rows, else one row
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vLcdDmaChunk(void)
+{
+
+    DMA_InitTypeDef sDma;
+    uint32_t u32Count = (u32Left > LCD_DMA_CHUNK) ? LCD_DMA_CHUNK : u32Left;
+
+    DMA_StructInit(&sDma);
+    if (pu16Next == NULL) {
+        sDma.DMA_PeripheralBaseAddr = (uintptr_t) &sJob.u16Color;
+        sDma.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    } else {
+        if (sJob.u16Stride != u16Width) {
+            u32Count = u16Width;
+        }
+        sDma.DMA_PeripheralBaseAddr = (uintptr_t) pu16Next;
+        sDma.DMA_PeripheralInc = DMA_PeripheralInc_Enable;
+        pu16Next += (sJob.u16Stride != u16Width) ? sJob.u16Stride : u32Count;
+    }
+    u32Left -= u32Count;
+
+    /* The peripheral port is the source in memory to memory mode */
+    sDma.DMA_Channel = DMA_Channel_0;
+    sDma.DMA_Memory0BaseAddr = (uintptr_t) &GL_LCD->DATA;
+    sDma.DMA_DIR = DMA_DIR_MemoryToMemory;
+    sDma.DMA_BufferSize = u32Count;
+    sDma.DMA_MemoryInc = DMA_MemoryInc_Disable;
+    sDma.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    sDma.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+    sDma.DMA_Mode = DMA_Mode_Normal;
+    sDma.DMA_Priority = DMA_Priority_Medium;
+    sDma.DMA_FIFOMode = DMA_FIFOMode_Enable; /* No direct mode memory to memory */
+    sDma.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+    sDma.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+    sDma.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+
+    DMA_ClearFlag(DMA2_Stream1, LCD_DMA_FLAGS);
+    DMA_Init(DMA2_Stream1, &sDma);
+    DMA_Cmd(DMA2_Stream1, ENABLE);
+}
+#endif
@@ -0,0 +1,74 @@
+/******************************************************************************/
+/** \file       main.c
+ *******************************************************************************
+ *
+ *  \brief      Kernel micro-benchmarks, results as CSV over UART0
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              main
+ *  functions  local:
+ *              .
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>
+#include <uart.h>
+#include <stdio.h>                      /* Standard Input/Output              */
+
+#include <FreeRTOS.h>                   /* All freeRTOS headers               */
+#include <task.h>
+
+#include "benchTask.h"
+
+//----- Macros -----------------------------------------------------------------
+//----- Data types -------------------------------------------------------------
+//----- Function prototypes ----------------------------------------------------
+//----- Data -------------------------------------------------------------------
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    main
+ ******************************************************************************/
+/** \brief        Initialize UART and OS
+ *
+ *  \type         global
+ *
+ *  \return       error code
+ *
+ ******************************************************************************/
+int  main(void)
+{
+
+    USART_InitTypeDef USART_InitStruct;
+
+    /* Ensure all priority bits are assigned as preemption priority bits. */
+    NVIC_PriorityGroupConfig(NVIC_PriorityGroup_4);
+
+    /* Initialize UART */
+    USART_StructInit(&USART_InitStruct);
+    USART_InitStruct.USART_BaudRate = 115200;
+    CARME_UART_Init(CARME_UART0, &USART_InitStruct);
+
+    xTaskCreate(vBenchTask,
+                "Bench",
+                STACKSIZE_BENCH_TASK,
+                NULL,
+                PRIORITY_BENCH_TASK,
+                NULL);
+    vTaskStartScheduler();
+
+    /* code never reached */
+    for (;;) {
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+/******************************************************************************/
+/** \file       FreeRTOSConfig.h
+ *******************************************************************************
+ *
+ *  \brief      FreeRTOS configuration of the host simulation. Same settings
+ *              as libs/FreeRTOS/FreeRTOSConfig.h of the exercises, for the
+ *              POSIX port of the kernel. Tasks are pthreads with host stacks,
+ *              the heap is larger and configASSERT reports and aborts.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+extern uint32_t SystemCoreClock;
+
+//----- Macros -----------------------------------------------------------------
+#define configUSE_PREEMPTION            1
+#define configUSE_IDLE_HOOK             0
+#define configUSE_TICK_HOOK             0
+#define configCPU_CLOCK_HZ              ( SystemCoreClock )
+#define configTICK_RATE_HZ              ( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES            ( 5 )
+#define configMINIMAL_STACK_SIZE        ( ( unsigned short ) 2048 )
+#define configTOTAL_HEAP_SIZE           ( ( size_t ) ( 4 * 1024 * 1024 ) )
+#define configMAX_TASK_NAME_LEN         ( 10 )
+#define configUSE_TRACE_FACILITY        1
+#define configUSE_16_BIT_TICKS          0
+#define configIDLE_SHOULD_YIELD         1
+#define configUSE_MUTEXES               1
+#define configQUEUE_REGISTRY_SIZE       8
+#define configCHECK_FOR_STACK_OVERFLOW  0   /* Tasks run on pthread stacks    */
+#define configUSE_RECURSIVE_MUTEXES     1
+#define configUSE_MALLOC_FAILED_HOOK    1
+#define configUSE_APPLICATION_TASK_TAG  0
+#define configUSE_COUNTING_SEMAPHORES   1
+#define configGENERATE_RUN_TIME_STATS   0
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES           0
+#define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
+
+/* Software timer definitions. */
+#define configUSE_TIMERS                1
+#define configTIMER_TASK_PRIORITY       ( 2 )
+#define configTIMER_QUEUE_LENGTH        10
+#define configTIMER_TASK_STACK_DEPTH    ( configMINIMAL_STACK_SIZE * 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+#define INCLUDE_vTaskPrioritySet                1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskCleanUpResources           1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_vTaskDelayUntil                 1
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_pcTaskGetTaskName               1
+#define INCLUDE_uxTaskGetStackHighWaterMark     1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+
+/* Interrupt priorities of the target, used by the applications for NVIC_Init.
+The POSIX port has no interrupt priorities. */
+#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY         0xf
+#define configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY    5
+
+/* Report the failed assertion instead of hanging like on the board */
+extern void vSimAssert(const char *pcFile, unsigned long ulLine);
+#define configASSERT( x ) if( ( x ) == 0 ) { vSimAssert( __FILE__, __LINE__ ); }
+
+/* Count the kernel ticks in the simulation (script, harness, SIM_TICKS) */
+extern void vSimRtosTick(void);
+#define traceTASK_INCREMENT_TICK( xTickCount ) vSimRtosTick()
+
+#endif /* FREERTOS_CONFIG_H */
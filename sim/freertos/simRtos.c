@@ -0,0 +1,226 @@
+/******************************************************************************/
+/** \file       simRtos.c
+ *******************************************************************************
+ *
+ *  \brief      Glue between the FreeRTOS POSIX port and the host simulation.
+ *              The kernel ticks are counted by the simulation, so the script,
+ *              the harness hook and SIM_TICKS work like without the RTOS. The
+ *              tick runs in a signal handler, the stop request is handed to
+ *              a thread which ends the process.
+ *              Interrupts of the simulated peripherals are raised by a task
+ *              of the highest priority, so their handlers may use the
+ *              FromISR API and yield without disturbing the kernel tick.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Interrupt task
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vSimRtosTick
+ *              vSimAssert
+ *              vApplicationMallocFailedHook
+ *              vSimRtosIrqStart
+ *  functions  local:
+ *              vSimRtosInit
+ *              pvSimStopThread
+ *              vSimIrqTask
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <sim.h>
+#include "../src/simInternal.h"
+
+//----- Macros -----------------------------------------------------------------
+#define SIM_STOP_WAIT_MS    ( 100 )     /* Wait for stdout before exiting     */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static void vSimRtosInit(void) __attribute__((constructor));
+static void *pvSimStopThread(void *pvArg);
+static void vSimIrqTask(void *pvData);
+
+//----- Data -------------------------------------------------------------------
+static sem_t sStop;                     /* Posted once SIM_TICKS is reached   */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vSimRtosTick
+ ******************************************************************************/
+/** \brief        Called by the kernel on every tick (traceTASK_INCREMENT_TICK)
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimRtosTick(void)
+{
+
+    if (u8SimTick()) {
+        /* Signal context: only post, the stop thread does the rest */
+        sem_post(&sStop);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimAssert
+ ******************************************************************************/
+/** \brief        configASSERT of the simulation
+ *
+ *  \type         global
+ *
+ *  \param[in]    pcFile    source file of the assertion
+ *  \param[in]    ulLine    line of the assertion
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimAssert(const char *pcFile, unsigned long ulLine)
+{
+
+    fprintf(stderr, "sim: assertion failed at %s:%lu\n", pcFile, ulLine);
+    abort();
+}
+
+/*******************************************************************************
+ *  function :    vApplicationMallocFailedHook
+ ******************************************************************************/
+/** \brief        pvPortMalloc ran out of heap
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vApplicationMallocFailedHook(void)
+{
+
+    fprintf(stderr, "sim: FreeRTOS heap exhausted\n");
+    abort();
+}
+
+/*******************************************************************************
+ *  function :    vSimRtosIrqStart
+ ******************************************************************************/
+/** \brief        Called by simCore.c when the first interrupt source is
+ *                attached, creates the interrupt task
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimRtosIrqStart(void)
+{
+
+    if (xTaskCreate(vSimIrqTask, "SimIrq", configMINIMAL_STACK_SIZE, NULL,
+                    configMAX_PRIORITIES - 1, NULL) != pdPASS) {
+        fprintf(stderr, "sim: cannot create the interrupt task\n");
+        abort();
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimRtosInit
+ ******************************************************************************/
+/** \brief        Start the stop thread before main runs
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimRtosInit(void)
+{
+
+    pthread_t sThread;
+    sigset_t sAll, sOld;
+
+    sem_init(&sStop, 0, 0);
+
+    /* The thread must not take the tick signal of the port */
+    sigfillset(&sAll);
+    pthread_sigmask(SIG_SETMASK, &sAll, &sOld);
+    pthread_create(&sThread, NULL, pvSimStopThread, NULL);
+    pthread_detach(sThread);
+    pthread_sigmask(SIG_SETMASK, &sOld, NULL);
+}
+
+/*******************************************************************************
+ *  function :    pvSimStopThread
+ ******************************************************************************/
+/** \brief        End the process once SIM_TICKS ticks are reached. A task
+ *                may be stopped inside printf, so exit (which flushes stdout)
+ *                is only used if stdout is free.
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvArg     not used
+ *
+ *  \return       does not return
+ *
+ ******************************************************************************/
+static void *pvSimStopThread(void *pvArg)
+{
+
+    const struct timespec sWait = { 0, 1000000L };
+    uint32_t u32Ms;
+
+    (void) pvArg;
+    while (sem_wait(&sStop) != 0) {
+        /* Interrupted, wait again */
+    }
+
+    for (u32Ms = 0; u32Ms < SIM_STOP_WAIT_MS; u32Ms++) {
+        if (ftrylockfile(stdout) == 0) {
+            funlockfile(stdout);
+            exit(0);
+        }
+        nanosleep(&sWait, NULL);
+    }
+    _exit(0);
+    return NULL;
+}
+
+/*******************************************************************************
+ *  function :    vSimIrqTask
+ ******************************************************************************/
+/** \brief        Poll the interrupt sources once per tick. Runs at the
+ *                highest priority, so a handler preempts all tasks like on
+ *                the target, only at tick granularity.
+ *
+ *  \type         local
+ *
+ *  \param[in]    pvData    not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimIrqTask(void *pvData)
+{
+
+    (void) pvData;
+    for (;;) {
+        vTaskDelay(1);
+        vSimIrqPoll();
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef __CAN_H__
+#define __CAN_H__
+/******************************************************************************/
+/** \file       can.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the CARME CAN module, there is no CAN bus in
+ *              the simulation.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>
+
+//----- Implementation ---------------------------------------------------------
+static inline void CARME_CAN_Interrupt_Handler(void) {
+}
+
+#endif /* __CAN_H__ */
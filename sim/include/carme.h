@@ -0,0 +1,37 @@
+#ifndef __CARME_H__
+#define __CARME_H__
+/******************************************************************************/
+/** \file       carme.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the CARME module header
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stm32f4xx.h>
+
+//----- Macros -----------------------------------------------------------------
+#define CARME_NO_ERROR              0x0     /* No error                       */
+#define CARME_ERROR_IO1_BASE        0x10    /* CARME IO1 errors               */
+#define CARME_ERROR_IO2_BASE        0x20    /* CARME IO2 errors               */
+#define CARME_ERROR_UART_BASE       0x30    /* UART errors                    */
+
+#define CARME_GPIO_TO_EXTILINE(GPIO_PIN)    ( ( uint32_t ) ( GPIO_PIN ) )
+
+/* External RAM of the module, a static array on the host */
+#define SIM_PSRAM_SIZE              ( 1024 * 1024 )
+#define FSMC_PSRAM_BASE             ( ( uintptr_t ) u8SimPsram )
+
+//----- Data types -------------------------------------------------------------
+typedef uint8_t ERROR_CODES;
+
+//----- Function prototypes ----------------------------------------------------
+extern void CARME_Init(void);
+
+//----- Data -------------------------------------------------------------------
+extern uint8_t u8SimPsram[SIM_PSRAM_SIZE];
+
+#endif /* __CARME_H__ */
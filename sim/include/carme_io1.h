@@ -0,0 +1,33 @@
+#ifndef __CARME_IO1_H__
+#define __CARME_IO1_H__
+/******************************************************************************/
+/** \file       carme_io1.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the CARME IO1 board. LEDs, switches and
+ *              buttons are plain state which is driven by the simulation
+ *              (see sim.h).
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>
+
+//----- Macros -----------------------------------------------------------------
+/* LED latch written directly by io1Service.c */
+#define CARME_IO1_LED_LATCH     ( &u8SimLedLatch )
+
+//----- Function prototypes ----------------------------------------------------
+extern void CARME_IO1_Init(void);
+extern void CARME_IO1_LED_Set(uint8_t write, uint8_t mask);
+extern void CARME_IO1_LED_Get(uint8_t *pStatus);
+extern void CARME_IO1_SWITCH_Get(uint8_t *pStatus);
+extern void CARME_IO1_BUTTON_Get(uint8_t *pStatus);
+extern void CARME_IO1_BUTTON_Interrupt(FunctionalState NewState);
+
+//----- Data -------------------------------------------------------------------
+extern volatile uint8_t u8SimLedLatch;
+
+#endif /* __CARME_IO1_H__ */
@@ -0,0 +1,28 @@
+#ifndef __CARME_IO2_H__
+#define __CARME_IO2_H__
+/******************************************************************************/
+/** \file       carme_io2.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the CARME IO2 board. The ADC channels return
+ *              values driven by the simulation (see sim.h).
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <carme.h>
+
+//----- Data types -------------------------------------------------------------
+typedef enum _CARME_IO2_ADC_CHANNEL {
+    CARME_IO2_ADC_PORT0 = 0,        /* Port 0, Poti */
+    CARME_IO2_ADC_PORT1 = 1,        /* Port 1 */
+    CARME_IO2_ADC_PORT2 = 2         /* Port 2 */
+} CARME_IO2_ADC_CHANNEL;
+
+//----- Function prototypes ----------------------------------------------------
+extern void CARME_IO2_Init(void);
+extern void CARME_IO2_ADC_Get(CARME_IO2_ADC_CHANNEL channel, uint16_t *pValue);
+
+#endif /* __CARME_IO2_H__ */
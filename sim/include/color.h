@@ -0,0 +1,34 @@
+#ifndef __COLOR_H__
+#define __COLOR_H__
+/******************************************************************************/
+/** \file       color.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the sGUI color definitions
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+//----- Macros -----------------------------------------------------------------
+#define GUI_COLOR_BLACK         0x0000      /* Black screen color             */
+#define GUI_COLOR_WHITE         0xFFFF      /* White screen color             */
+#define GUI_COLOR_LIGHT_GRAY    0xBDF7      /* Light Gray screen color        */
+#define GUI_COLOR_DARK_GREY     0x7BEF      /* Dark Gray screen color         */
+#define GUI_COLOR_RED           0xF800      /* Red screen color               */
+#define GUI_COLOR_YELLOW        0xFFE0      /* Yellow screen color            */
+#define GUI_COLOR_ORANGE        0xFBE0      /* Orange screen color            */
+#define GUI_COLOR_BROWN         0x79E0      /* Brown screen color             */
+#define GUI_COLOR_GREEN         0x07E0      /* Green screen color             */
+#define GUI_COLOR_CYAN          0x07FF      /* Cyan screen color              */
+#define GUI_COLOR_BLUE          0x001F      /* Blue screen color              */
+#define GUI_COLOR_PINK          0xF81F      /* Pink screen color              */
+#define GUI_COLOR_MAGENTA       0xF81F      /* Magenta screen color           */
+
+//----- Data types -------------------------------------------------------------
+typedef uint16_t LCDCOLOR;
+
+#endif /* __COLOR_H__ */
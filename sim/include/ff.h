@@ -0,0 +1,74 @@
+#ifndef _FATFS
+#define _FATFS
+/******************************************************************************/
+/** \file       ff.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for FatFs. The files of the SD card are read
+ *              from the host directory SIM_FS_ROOT (default: current
+ *              directory) by simFatFs.c. Only the read path is provided.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <stdint.h>
+
+//----- Macros -----------------------------------------------------------------
+#define FA_READ             0x01
+#define FA_OPEN_EXISTING    0x00
+
+#define f_eof(fp)           (((fp)->fptr == (fp)->fsize) ? 1 : 0)
+#define f_tell(fp)          ((fp)->fptr)
+#define f_size(fp)          ((fp)->fsize)
+
+//----- Data types -------------------------------------------------------------
+typedef unsigned char   BYTE;
+typedef unsigned short  WORD;
+typedef unsigned int    UINT;
+typedef unsigned long   DWORD;
+typedef char            TCHAR;
+
+typedef struct {
+    BYTE  fs_type;              /* 0 while not mounted */
+} FATFS;
+
+typedef struct {
+    FILE  *pfHost;              /* Host file */
+    DWORD  fptr;                /* Read pointer */
+    DWORD  fsize;               /* File size */
+} FIL;
+
+typedef enum {
+    FR_OK = 0,
+    FR_DISK_ERR,
+    FR_INT_ERR,
+    FR_NOT_READY,
+    FR_NO_FILE,
+    FR_NO_PATH,
+    FR_INVALID_NAME,
+    FR_DENIED,
+    FR_EXIST,
+    FR_INVALID_OBJECT,
+    FR_WRITE_PROTECTED,
+    FR_INVALID_DRIVE,
+    FR_NOT_ENABLED,
+    FR_NO_FILESYSTEM,
+    FR_MKFS_ABORTED,
+    FR_TIMEOUT,
+    FR_LOCKED,
+    FR_NOT_ENOUGH_CORE,
+    FR_TOO_MANY_OPEN_FILES,
+    FR_INVALID_PARAMETER
+} FRESULT;
+
+//----- Function prototypes ----------------------------------------------------
+extern FRESULT f_mount(FATFS *fs, const TCHAR *path, BYTE opt);
+extern FRESULT f_open(FIL *fp, const TCHAR *path, BYTE mode);
+extern FRESULT f_close(FIL *fp);
+extern FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br);
+extern FRESULT f_lseek(FIL *fp, DWORD ofs);
+
+#endif /* _FATFS */
@@ -0,0 +1,50 @@
+#ifndef __FONT_H__
+#define __FONT_H__
+/******************************************************************************/
+/** \file       font.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the sGUI fonts. The fonts only carry their
+ *              geometry, the glyph bitmaps are part of the target library.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+//----- Data types -------------------------------------------------------------
+typedef struct _FONT_T {
+    uint8_t width;          /* Font width in pixel */
+    uint8_t height;         /* Font height in pixel */
+    uint8_t datasize;       /* Font datasize in bytes */
+    void *data;             /* Pointer to the data buffer */
+} FONT_T;
+
+//----- Data -------------------------------------------------------------------
+extern FONT_T font_4x6;
+extern FONT_T font_5x7;
+extern FONT_T font_5x7W;
+extern FONT_T font_5x8;
+extern FONT_T font_6x9;
+extern FONT_T font_6x10;
+extern FONT_T font_6x12;
+extern FONT_T font_6x13;
+extern FONT_T font_6x13B;
+extern FONT_T font_6x13O;
+extern FONT_T font_7x13;
+extern FONT_T font_7x13B;
+extern FONT_T font_7x13O;
+extern FONT_T font_7x14;
+extern FONT_T font_7x14B;
+extern FONT_T font_8x8;
+extern FONT_T font_8x13;
+extern FONT_T font_8x13B;
+extern FONT_T font_8x13O;
+extern FONT_T font_8x16;
+extern FONT_T font_8x16B;
+extern FONT_T font_9x15;
+extern FONT_T font_9x15B;
+
+#endif /* __FONT_H__ */
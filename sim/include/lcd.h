@@ -0,0 +1,73 @@
+#ifndef __LCD_H__
+#define __LCD_H__
+/******************************************************************************/
+/** \file       lcd.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the sGUI library. Same interface as the
+ *              target library, drawing goes to the framebuffer of simLcd.c.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include "color.h"
+#include "font.h"
+#include "lcd_lld.h"
+
+//----- Data types -------------------------------------------------------------
+typedef enum _BMP_STATUS {
+    BMP_OK = 0,                 /* No error */
+    BMP_ERROR,                  /* General error */
+    BMP_OUT_OF_MEMORY,          /* Could not allocate enough memory */
+    BMP_IO_ERROR,               /* General input/output error */
+    BMP_FILE_NOT_FOUND,         /* File not found */
+    BMP_FILE_NOT_SUPPORTED,     /* File is not a supported BMP variant */
+    BMP_FILE_INVALID,           /* File is not a BMP image or is invalid */
+    BMP_INVALID_ARGUMENT,       /* An argument is invalid or out of range */
+    BMP_TYPE_MISMATCH,          /* Action not compatible with the BMP type */
+    BMP_ERROR_NUM               /* Other error */
+} BMP_STATUS;
+
+//----- Function prototypes ----------------------------------------------------
+/* Text functionality */
+void LCD_SetTextColor(LCDCOLOR Color);
+void LCD_SetBackColor(LCDCOLOR Color);
+void LCD_SetFont(FONT_T *pFont);
+FONT_T* LCD_GetFont(void);
+uint8_t LCD_GetLineCount(void);
+void LCD_ClearLine(uint8_t Line);
+void LCD_DisplayCharXY(uint16_t x, uint16_t y, char Ascii);
+void LCD_DisplayCharLine(uint8_t Line, uint8_t Column, char Ascii);
+void LCD_DisplayStringXY(uint16_t x, uint16_t y, const char *ptr);
+void LCD_DisplayStringLine(uint8_t Line, const char *ptr);
+void LCD_DisplayStringCenterLine(uint8_t Line, const char *ptr);
+
+/* Log console functionality */
+void LCD_Log_AddMsg(char *ptr);
+void LCD_Log_Update(void);
+
+/* Simple geometric functionality */
+void LCD_DrawLine(uint16_t Xstart, uint16_t Ystart, uint16_t Xstop,
+                  uint16_t Ystop, LCDCOLOR Color);
+void LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t width,
+                  uint16_t height, LCDCOLOR Color);
+void LCD_DrawRectF(uint16_t Xpos, uint16_t Ypos, uint16_t width,
+                   uint16_t height, LCDCOLOR Color);
+void LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius,
+                    LCDCOLOR Color);
+void LCD_DrawCircleF(uint8_t Xpos, uint16_t Ypos, uint16_t Radius,
+                     LCDCOLOR Color);
+
+/* Bitmap functionality */
+BMP_STATUS LCD_BMP_DrawBitmap(const char *filename, uint16_t Xpos,
+                              uint16_t Ypos);
+
+//----- Implementation ---------------------------------------------------------
+static inline void LCD_Clear(LCDCOLOR Color) {
+    LCD_FillArea(SCRN_LEFT, SCRN_TOP, SCRN_RIGHT, SCRN_BOTTOM, Color);
+}
+
+#endif /* __LCD_H__ */
@@ -0,0 +1,46 @@
+#ifndef __LCD_LLD_H__
+#define __LCD_LLD_H__
+/******************************************************************************/
+/** \file       lcd_lld.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the sGUI low level driver. The SSD1963
+ *              functions drive the emulated controller of simSsd1963.c.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include "ssd1963.h"
+
+//----- Macros -----------------------------------------------------------------
+#define LCD_HOR_RESOLUTION      320ULL  /* Unsigned like lcd_conf.h     */
+#define LCD_VER_RESOLUTION      240ULL
+
+#define SCRN_LEFT               0
+#define SCRN_TOP                0
+#define SCRN_RIGHT              LCD_HOR_RESOLUTION-1
+#define SCRN_BOTTOM             LCD_VER_RESOLUTION-1
+
+//----- Implementation ---------------------------------------------------------
+static inline void LCD_Init(void) {
+    SSD1963_Init();
+}
+
+static inline void LCD_FillArea(uint16_t x1, uint16_t y1, uint16_t x2,
+                                uint16_t y2, uint16_t color) {
+    SSD1963_FillArea(x1, y1, x2, y2, color);
+}
+
+static inline void LCD_WriteArea(uint16_t x1, uint16_t y1, uint16_t x2,
+                                 uint16_t y2, uint16_t *pData) {
+    SSD1963_WriteArea(x1, y1, x2, y2, pData);
+}
+
+static inline void LCD_WritePixel(uint16_t x, uint16_t y, uint16_t pixel) {
+    SSD1963_WritePixel(x, y, pixel);
+}
+
+#endif /* __LCD_LLD_H__ */
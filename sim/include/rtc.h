@@ -0,0 +1,47 @@
+#ifndef __RTC_H__
+#define __RTC_H__
+/******************************************************************************/
+/** \file       rtc.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the CARME RTC, the time is the local time of
+ *              the host.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <time.h>
+#include <carme.h>
+
+//----- Data types -------------------------------------------------------------
+typedef struct _CARME_RTC_TIME_t {
+    uint8_t sec;                    /* Seconds:         range 0-59 */
+    uint8_t min;                    /* Minutes:         range 0-59 */
+    uint8_t hour;                   /* Hours:           range 0-23 */
+    uint8_t day;                    /* Day of Month:    range 1-31 */
+    uint8_t month;                  /* Month:           range 1-12 */
+    uint8_t year;                   /* Year since 2000: range 0-99 */
+    uint8_t wday;                   /* Day of the week: range 1-7 */
+} CARME_RTC_TIME_t;
+
+//----- Implementation ---------------------------------------------------------
+static inline void CARME_RTC_Init(void) {
+}
+
+static inline void CARME_RTC_GetTime(CARME_RTC_TIME_t *psTime) {
+    time_t sNow = time(NULL);
+    struct tm sTm;
+
+    localtime_r(&sNow, &sTm);
+    psTime->sec = (uint8_t) sTm.tm_sec;
+    psTime->min = (uint8_t) sTm.tm_min;
+    psTime->hour = (uint8_t) sTm.tm_hour;
+    psTime->day = (uint8_t) sTm.tm_mday;
+    psTime->month = (uint8_t) (sTm.tm_mon + 1);
+    psTime->year = (uint8_t) (sTm.tm_year % 100);
+    psTime->wday = (uint8_t) (sTm.tm_wday + 1);
+}
+
+#endif /* __RTC_H__ */
@@ -0,0 +1,78 @@
+#ifndef SIM_H_
+#define SIM_H_
+/******************************************************************************/
+/** \file       sim.h
+ *******************************************************************************
+ *
+ *  \brief      Control interface of the host simulation. Used by the host
+ *              harnesses in U<x>/A<y>/sim to drive the board state and to
+ *              read back the virtual time.
+ *
+ *              Environment variables read at start-up:
+ *               SIM_TICKS     stop the simulation after that many ticks
+ *               SIM_REALTIME  1: sleep in WFI instead of skipping idle time
+ *               SIM_SCRIPT    file with timed board inputs, see simScript.c
+ *               SIM_UART_PTY  1: UART output to a new pseudo terminal
+ *               SIM_LCD_TRACE 1: print the text drawn on the LCD to stderr
+ *               SIM_LCD_FRAME end a LCD frame every that many ticks
+ *               SIM_LCD_PPM   PPM snapshot at the end of every LCD frame
+ *               SIM_FS_ROOT   host directory holding the SD card files
+ *               SIM_ADC_FILE  recorded ADC samples, see simAdc.c
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    u8SimTick
+ *              u32SimGetTicks
+ *              u64SimGetTimeNs
+ *              u64SimGetIdleNs
+ *              vSimSetTickHook
+ *              vSimSetButtons
+ *              vSimSetButton
+ *              vSimSetSwitches
+ *              vSimSetAdc
+ *              u8SimGetLeds
+ *              pu16SimGetFrame
+ *              vSimLcdEndFrame
+ *              u8SimLcdSnapshot
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+/* Hook called in interrupt context on every simulated tick */
+typedef void (*SimTickHook)(uint32_t u32Tick);
+
+/* Bus accesses of the emulated SSD1963 in one frame */
+typedef struct {
+    uint32_t u32Writes;             /* Command and data writes                */
+    uint32_t u32Reads;              /* Data reads                             */
+    uint32_t u32Windows;            /* Memory starts after a window change    */
+    uint32_t u32Pixels;             /* Pixels written                         */
+} SimLcdStats;
+
+//----- Function prototypes ----------------------------------------------------
+extern uint8_t  u8SimTick(void);
+extern uint32_t u32SimGetTicks(void);
+extern uint64_t u64SimGetTimeNs(void);
+extern uint64_t u64SimGetIdleNs(void);
+extern void     vSimSetTickHook(SimTickHook pfHook);
+
+extern void     vSimSetButtons(uint8_t u8Buttons);
+extern void     vSimSetButton(uint8_t u8Button, uint8_t u8Pressed);
+extern void     vSimSetSwitches(uint8_t u8Switches);
+extern void     vSimSetAdc(uint8_t u8Channel, uint16_t u16Value);
+extern uint8_t  u8SimGetLeds(void);
+
+extern const uint16_t *pu16SimGetFrame(void);
+extern void     vSimLcdEndFrame(SimLcdStats *psStats);
+extern uint8_t  u8SimLcdSnapshot(const char *pcFile);
+
+//----- Data -------------------------------------------------------------------
+
+#endif /* SIM_H_ */
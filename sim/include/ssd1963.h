@@ -0,0 +1,40 @@
+#ifndef __SSD1963_H__
+#define __SSD1963_H__
+/******************************************************************************/
+/** \file       ssd1963.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the SSD1963 driver. The functions talk to
+ *              the emulated controller of simSsd1963.c through the same
+ *              command and data writes as the target driver.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include "ssd1963_lld.h"
+#include "ssd1963_cmd.h"
+
+//----- Function prototypes ----------------------------------------------------
+extern void     SSD1963_Init(void);
+extern void     SSD1963_WritePixel(uint16_t x, uint16_t y, uint16_t color);
+extern uint16_t SSD1963_ReadPixel(uint16_t x, uint16_t y);
+extern void     SSD1963_SetArea(uint16_t x1, uint16_t y1, uint16_t x2,
+                                uint16_t y2);
+extern void     SSD1963_FillArea(uint16_t x1, uint16_t y1, uint16_t x2,
+                                 uint16_t y2, uint16_t color);
+extern void     SSD1963_WriteArea(uint16_t x1, uint16_t y1, uint16_t x2,
+                                  uint16_t y2, uint16_t *pData);
+
+//----- Implementation ---------------------------------------------------------
+static inline void SSD1963_DisplayOff(void) {
+    SSD1963_WriteCommand(CMD_BLANK_DISPLAY);
+}
+
+static inline void SSD1963_DisplayOn(void) {
+    SSD1963_WriteCommand(CMD_ON_DISPLAY);
+}
+
+#endif /* __SSD1963_H__ */
@@ -0,0 +1,34 @@
+#ifndef __SSD1963_CMD_H__
+#define __SSD1963_CMD_H__
+/******************************************************************************/
+/** \file       ssd1963_cmd.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the SSD1963 command codes. Only the frame
+ *              memory commands are decoded by simSsd1963.c, the others are
+ *              accepted and counted as bus writes.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Macros -----------------------------------------------------------------
+#define CMD_NOP                 0x00        /* No operation                   */
+#define CMD_SOFT_RESET          0x01        /* Software reset                 */
+#define CMD_ENT_SLEEP           0x10
+#define CMD_EXIT_SLEEP          0x11
+#define CMD_BLANK_DISPLAY       0x28
+#define CMD_ON_DISPLAY          0x29
+#define CMD_SET_COLUMN          0x2A        /* Start and end column           */
+#define CMD_SET_PAGE            0x2B        /* Start and end row              */
+#define CMD_WR_MEMSTART         0x2C        /* Write pixels into the window   */
+#define CMD_RD_MEMSTART         0x2E        /* Read pixels from the window    */
+#define CMD_SET_TEAR_OFF        0x34
+#define CMD_SET_TEAR_ON         0x35
+#define CMD_SET_ADDR_MODE       0x36
+#define CMD_SET_PIXEL_FORMAT    0x3A
+#define CMD_WR_MEM_AUTO         0x3C        /* Continue writing pixels        */
+#define CMD_RD_MEM_AUTO         0x3E        /* Continue reading pixels        */
+#define CMD_RD_DDB_START        0xA1
+
+#endif /* __SSD1963_CMD_H__ */
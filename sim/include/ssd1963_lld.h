@@ -0,0 +1,25 @@
+#ifndef __SSD1963_LLD_H__
+#define __SSD1963_LLD_H__
+/******************************************************************************/
+/** \file       ssd1963_lld.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the SSD1963 bus access. On the target these
+ *              are inline writes to the FSMC registers GL_LCD->CMD and DATA,
+ *              on the host they feed the controller emulated by
+ *              simSsd1963.c.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+//----- Function prototypes ----------------------------------------------------
+extern void     SSD1963_LLD_Init(void);
+extern void     SSD1963_WriteCommand(uint16_t cmd);
+extern void     SSD1963_WriteData(uint16_t data);
+extern uint16_t SSD1963_ReadData(void);
+
+#endif /* __SSD1963_LLD_H__ */
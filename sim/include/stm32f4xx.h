@@ -0,0 +1,301 @@
+#ifndef __STM32F4xx_H
+#define __STM32F4xx_H
+/******************************************************************************/
+/** \file       stm32f4xx.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the STM32F4 device header. Provides just the
+ *              types and core functions used by the exercises. The SysTick
+ *              and the interrupt mask are mapped onto SIGALRM by simCore.c.
+ *              ADC1 with DMA2 stream 0 is simulated by simAdc.c, the EXTI
+ *              lines of the IO1 buttons by simIo.c, the TXE interrupt of
+ *              USART1 by simUart.c.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+#include <stddef.h>
+
+//----- Macros -----------------------------------------------------------------
+#define __IO    volatile
+
+#define NVIC_PriorityGroup_4    ( ( uint32_t ) 0x300 )
+
+#define GPIO_Pin_0              ( ( uint16_t ) 0x0001 )
+#define GPIO_Pin_1              ( ( uint16_t ) 0x0002 )
+#define GPIO_Pin_2              ( ( uint16_t ) 0x0004 )
+#define GPIO_Pin_3              ( ( uint16_t ) 0x0008 )
+#define GPIO_Pin_4              ( ( uint16_t ) 0x0010 )
+#define GPIO_Pin_5              ( ( uint16_t ) 0x0020 )
+#define GPIO_Pin_6              ( ( uint16_t ) 0x0040 )
+#define GPIO_Pin_7              ( ( uint16_t ) 0x0080 )
+#define GPIO_Pin_8              ( ( uint16_t ) 0x0100 )
+#define GPIO_Pin_9              ( ( uint16_t ) 0x0200 )
+#define GPIO_Pin_10             ( ( uint16_t ) 0x0400 )
+#define GPIO_Pin_11             ( ( uint16_t ) 0x0800 )
+#define GPIO_Pin_12             ( ( uint16_t ) 0x1000 )
+#define GPIO_Pin_13             ( ( uint16_t ) 0x2000 )
+#define GPIO_Pin_14             ( ( uint16_t ) 0x4000 )
+#define GPIO_Pin_15             ( ( uint16_t ) 0x8000 )
+
+/* Cycle counter, reading DWT->CYCCNT samples the host clock */
+#define DWT                     ( psSimDwt() )
+#define CoreDebug               ( &sSimCoreDebug )
+#define DWT_CTRL_CYCCNTENA_Msk          ( 0x1UL )
+#define CoreDebug_DEMCR_TRCENA_Msk      ( 0x1UL << 24 )
+
+#define USART1                  ( &sSimUsart[0] )
+#define USART3                  ( &sSimUsart[1] )
+#define USART_FLAG_TXE          ( ( uint16_t ) 0x0080 )
+#define USART_FLAG_TC           ( ( uint16_t ) 0x0040 )
+#define USART_FLAG_RXNE         ( ( uint16_t ) 0x0020 )
+#define USART_FLAG_ORE          ( ( uint16_t ) 0x0008 )
+#define USART_IT_TXE            ( ( uint16_t ) 0x0727 )
+#define USART_IT_RXNE           ( ( uint16_t ) 0x0525 )
+#define USART1_IRQn             ( 37 )
+
+/* General purpose timers, reading a register samples the host clock */
+#define SIM_TIMERS              ( 3 )
+#define TIM2                    ( psSimTim(&sSimTim[0]) )
+#define TIM3                    ( psSimTim(&sSimTim[1]) )
+#define TIM4                    ( psSimTim(&sSimTim[2]) )
+#define RCC_APB1Periph_TIM2     ( ( uint32_t ) 0x00000001 )
+#define RCC_APB1Periph_TIM3     ( ( uint32_t ) 0x00000002 )
+#define RCC_APB1Periph_TIM4     ( ( uint32_t ) 0x00000004 )
+#define TIM_CR1_CEN             ( ( uint16_t ) 0x0001 )
+#define TIM_CR2_MMS             ( ( uint16_t ) 0x0070 )
+#define TIM_CounterMode_Up      ( ( uint16_t ) 0x0000 )
+#define TIM_CKD_DIV1            ( ( uint16_t ) 0x0000 )
+#define TIM_TRGOSource_Reset    ( ( uint16_t ) 0x0000 )
+#define TIM_TRGOSource_Update   ( ( uint16_t ) 0x0020 )
+#define TIM_IT_Update           ( ( uint16_t ) 0x0001 )
+#define TIM4_IRQn               ( 30 )
+
+/* ADC1, scans of the regular group started by a timer, see simAdc.c */
+#define ADC1                    ( &sSimAdc )
+#define RCC_APB2Periph_ADC1     ( ( uint32_t ) 0x00000100 )
+#define ADC_Resolution_12b      ( ( uint32_t ) 0x00000000 )
+#define ADC_Resolution_10b      ( ( uint32_t ) 0x01000000 )
+#define ADC_ExternalTrigConvEdge_None       ( ( uint32_t ) 0x00000000 )
+#define ADC_ExternalTrigConvEdge_Rising     ( ( uint32_t ) 0x10000000 )
+#define ADC_ExternalTrigConv_T1_CC1         ( ( uint32_t ) 0x00000000 )
+#define ADC_ExternalTrigConv_T2_TRGO        ( ( uint32_t ) 0x06000000 )
+#define ADC_ExternalTrigConv_T3_TRGO        ( ( uint32_t ) 0x08000000 )
+#define ADC_DataAlign_Right     ( ( uint32_t ) 0x00000000 )
+#define ADC_Channel_8           ( ( uint8_t ) 0x08 )
+#define ADC_Channel_10          ( ( uint8_t ) 0x0A )
+#define ADC_Channel_12          ( ( uint8_t ) 0x0C )
+#define ADC_SampleTime_480Cycles    ( ( uint8_t ) 0x07 )
+#define SIM_ADC_RANKS           ( 16 )
+
+/* DMA2 stream 0, peripheral to memory only */
+#define DMA2_Stream0            ( &sSimDma2Stream0 )
+#define RCC_AHB1Periph_DMA2     ( ( uint32_t ) 0x00400000 )
+#define DMA_SxCR_EN             ( ( uint32_t ) 0x00000001 )
+#define DMA_Channel_0           ( ( uint32_t ) 0x00000000 )
+#define DMA_DIR_PeripheralToMemory          ( ( uint32_t ) 0x00000000 )
+#define DMA_PeripheralInc_Disable           ( ( uint32_t ) 0x00000000 )
+#define DMA_MemoryInc_Enable                ( ( uint32_t ) 0x00000400 )
+#define DMA_PeripheralDataSize_HalfWord     ( ( uint32_t ) 0x00000800 )
+#define DMA_MemoryDataSize_HalfWord         ( ( uint32_t ) 0x00002000 )
+#define DMA_Mode_Normal         ( ( uint32_t ) 0x00000000 )
+#define DMA_Mode_Circular       ( ( uint32_t ) 0x00000100 )
+#define DMA_Priority_High       ( ( uint32_t ) 0x00020000 )
+#define DMA_IT_TC               ( ( uint32_t ) 0x00000010 )
+#define DMA_IT_HT               ( ( uint32_t ) 0x00000008 )
+#define DMA_IT_HTIF0            ( ( uint32_t ) 0x10004010 )
+#define DMA_IT_TCIF0            ( ( uint32_t ) 0x10008020 )
+
+#define DMA2_Stream0_IRQn       ( 56 )
+
+/* External interrupt lines, line n is pin n of the selected port */
+#define EXTI                    ( &sSimExti )
+#define EXTI_Line0              ( ( uint32_t ) 0x00001 )
+#define EXTI_Line7              ( ( uint32_t ) 0x00080 )
+#define EXTI_Line8              ( ( uint32_t ) 0x00100 )
+#define EXTI_Line14             ( ( uint32_t ) 0x04000 )
+#define EXTI_Line15             ( ( uint32_t ) 0x08000 )
+#define EXTI0_IRQn              ( 6 )
+#define EXTI9_5_IRQn            ( 23 )
+#define EXTI15_10_IRQn          ( 40 )
+
+//----- Data types -------------------------------------------------------------
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+
+typedef struct {
+    __IO uint32_t CTRL;
+    __IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+typedef struct {
+    __IO uint16_t SR;                   /* Receive flags only                 */
+    __IO uint16_t DR;                   /* Received byte                      */
+    __IO uint16_t CR1;                  /* Interrupt enables only             */
+} USART_TypeDef;
+
+typedef struct {
+    __IO uint32_t IMR;
+    __IO uint32_t EMR;
+    __IO uint32_t RTSR;
+    __IO uint32_t FTSR;
+    __IO uint32_t SWIER;
+    __IO uint32_t PR;
+} EXTI_TypeDef;
+
+typedef struct {
+    __IO uint16_t CR1;
+    __IO uint16_t CR2;
+    __IO uint16_t DIER;
+    __IO uint16_t SR;
+    __IO uint32_t CNT;
+    __IO uint16_t PSC;
+    __IO uint32_t ARR;
+} TIM_TypeDef;
+
+typedef struct {
+    uint16_t TIM_Prescaler;
+    uint16_t TIM_CounterMode;
+    uint32_t TIM_Period;
+    uint16_t TIM_ClockDivision;
+    uint8_t  TIM_RepetitionCounter;
+} TIM_TimeBaseInitTypeDef;
+
+typedef struct {
+    __IO uint32_t CR2;
+    __IO uint32_t DR;
+} ADC_TypeDef;
+
+typedef struct {
+    uint32_t ADC_Resolution;
+    FunctionalState ADC_ScanConvMode;
+    FunctionalState ADC_ContinuousConvMode;
+    uint32_t ADC_ExternalTrigConvEdge;
+    uint32_t ADC_ExternalTrigConv;
+    uint32_t ADC_DataAlign;
+    uint8_t  ADC_NbrOfConversion;
+} ADC_InitTypeDef;
+
+/* Addresses are uintptr_t: the host has 64 bit pointers */
+typedef struct {
+    __IO uint32_t  CR;
+    __IO uint32_t  NDTR;
+    __IO uintptr_t PAR;
+    __IO uintptr_t M0AR;
+} DMA_Stream_TypeDef;
+
+typedef struct {
+    uint32_t  DMA_Channel;
+    uintptr_t DMA_PeripheralBaseAddr;
+    uintptr_t DMA_Memory0BaseAddr;
+    uint32_t  DMA_DIR;
+    uint32_t  DMA_BufferSize;
+    uint32_t  DMA_PeripheralInc;
+    uint32_t  DMA_MemoryInc;
+    uint32_t  DMA_PeripheralDataSize;
+    uint32_t  DMA_MemoryDataSize;
+    uint32_t  DMA_Mode;
+    uint32_t  DMA_Priority;
+    uint32_t  DMA_FIFOMode;
+    uint32_t  DMA_FIFOThreshold;
+    uint32_t  DMA_MemoryBurst;
+    uint32_t  DMA_PeripheralBurst;
+} DMA_InitTypeDef;
+
+typedef struct {
+    uint8_t NVIC_IRQChannel;
+    uint8_t NVIC_IRQChannelPreemptionPriority;
+    uint8_t NVIC_IRQChannelSubPriority;
+    FunctionalState NVIC_IRQChannelCmd;
+} NVIC_InitTypeDef;
+
+typedef struct {
+    uint32_t USART_BaudRate;
+    uint16_t USART_WordLength;
+    uint16_t USART_StopBits;
+    uint16_t USART_Parity;
+    uint16_t USART_Mode;
+    uint16_t USART_HardwareFlowControl;
+} USART_InitTypeDef;
+
+//----- Function prototypes ----------------------------------------------------
+extern uint32_t SysTick_Config(uint32_t u32Ticks);
+extern void __WFI(void);
+extern void __disable_irq(void);
+extern void __enable_irq(void);
+extern DWT_Type *psSimDwt(void);
+extern TIM_TypeDef *psSimTim(TIM_TypeDef *psTim);
+extern void TIM_TimeBaseStructInit(TIM_TimeBaseInitTypeDef *psInit);
+extern void TIM_TimeBaseInit(TIM_TypeDef *psTim, TIM_TimeBaseInitTypeDef *psInit);
+extern void TIM_Cmd(TIM_TypeDef *psTim, FunctionalState NewState);
+extern void TIM_SelectOutputTrigger(TIM_TypeDef *psTim, uint16_t u16Source);
+extern void TIM_ITConfig(TIM_TypeDef *psTim, uint16_t u16It, FunctionalState NewState);
+extern void TIM_ClearITPendingBit(TIM_TypeDef *psTim, uint16_t u16It);
+extern void RCC_APB1PeriphClockCmd(uint32_t u32Periph, FunctionalState NewState);
+extern void RCC_APB2PeriphClockCmd(uint32_t u32Periph, FunctionalState NewState);
+extern void RCC_AHB1PeriphClockCmd(uint32_t u32Periph, FunctionalState NewState);
+extern void NVIC_Init(NVIC_InitTypeDef *psInit);
+extern void ADC_StructInit(ADC_InitTypeDef *psInit);
+extern void ADC_Init(ADC_TypeDef *psAdc, ADC_InitTypeDef *psInit);
+extern void ADC_RegularChannelConfig(ADC_TypeDef *psAdc, uint8_t u8Channel,
+                                     uint8_t u8Rank, uint8_t u8SampleTime);
+extern void ADC_DMARequestAfterLastTransferCmd(ADC_TypeDef *psAdc,
+                                               FunctionalState NewState);
+extern void ADC_DMACmd(ADC_TypeDef *psAdc, FunctionalState NewState);
+extern void ADC_Cmd(ADC_TypeDef *psAdc, FunctionalState NewState);
+extern void DMA_DeInit(DMA_Stream_TypeDef *psStream);
+extern void DMA_StructInit(DMA_InitTypeDef *psInit);
+extern void DMA_Init(DMA_Stream_TypeDef *psStream, DMA_InitTypeDef *psInit);
+extern void DMA_ITConfig(DMA_Stream_TypeDef *psStream, uint32_t u32It,
+                         FunctionalState NewState);
+extern void DMA_Cmd(DMA_Stream_TypeDef *psStream, FunctionalState NewState);
+extern ITStatus DMA_GetITStatus(DMA_Stream_TypeDef *psStream, uint32_t u32It);
+extern void DMA_ClearITPendingBit(DMA_Stream_TypeDef *psStream, uint32_t u32It);
+extern void USART_SendData(USART_TypeDef *psUsart, uint16_t u16Data);
+extern uint16_t USART_ReceiveData(USART_TypeDef *psUsart);
+extern FlagStatus USART_GetFlagStatus(USART_TypeDef *psUsart,
+                                      uint16_t u16Flag);
+extern void USART_ITConfig(USART_TypeDef *psUsart, uint16_t u16It,
+                           FunctionalState NewState);
+extern ITStatus USART_GetITStatus(USART_TypeDef *psUsart, uint16_t u16It);
+
+//----- Data -------------------------------------------------------------------
+extern uint32_t SystemCoreClock;
+extern CoreDebug_Type sSimCoreDebug;
+extern USART_TypeDef sSimUsart[2];
+extern TIM_TypeDef sSimTim[SIM_TIMERS];
+extern ADC_TypeDef sSimAdc;
+extern DMA_Stream_TypeDef sSimDma2Stream0;
+extern EXTI_TypeDef sSimExti;
+
+//----- Implementation ---------------------------------------------------------
+static inline void NVIC_PriorityGroupConfig(uint32_t u32Group) {
+    (void) u32Group;
+}
+
+static inline void USART_StructInit(USART_InitTypeDef *psInit) {
+    psInit->USART_BaudRate = 9600;
+    psInit->USART_WordLength = 0;
+    psInit->USART_StopBits = 0;
+    psInit->USART_Parity = 0;
+    psInit->USART_Mode = 0;
+    psInit->USART_HardwareFlowControl = 0;
+}
+
+static inline ITStatus EXTI_GetITStatus(uint32_t u32Line) {
+    return ((EXTI->PR & EXTI->IMR & u32Line) != 0) ? SET : RESET;
+}
+
+/* Atomic, the simulation sets pending bits from the tick */
+static inline void EXTI_ClearITPendingBit(uint32_t u32Line) {
+    __atomic_fetch_and(&EXTI->PR, ~u32Line, __ATOMIC_SEQ_CST);
+}
+
+#endif /* __STM32F4xx_H */
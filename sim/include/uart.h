@@ -0,0 +1,41 @@
+#ifndef __UART_H__
+#define __UART_H__
+/******************************************************************************/
+/** \file       uart.h
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the CARME UART module. Output goes to
+ *              stdout, like printf does through syscalls.c on the target.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <carme.h>
+
+//----- Macros -----------------------------------------------------------------
+#define CARME_UART0     USART1      /* CARME UART Port 0                      */
+#define CARME_UART1     USART3      /* CARME UART Port 1                      */
+
+#define CARME_ERROR_UART_NO_DATA    (CARME_ERROR_UART_BASE+0)
+
+//----- Implementation ---------------------------------------------------------
+static inline void CARME_UART_Init(USART_TypeDef *UARTx,
+                                   USART_InitTypeDef *pUSART_InitStruct) {
+    (void) UARTx;
+    (void) pUSART_InitStruct;
+}
+
+static inline void CARME_UART_SendChar(USART_TypeDef *UARTx, char c) {
+    (void) UARTx;
+    putchar(c);
+}
+
+static inline void CARME_UART_SendString(USART_TypeDef *UARTx, char *pStr) {
+    (void) UARTx;
+    fputs(pStr, stdout);
+}
+
+#endif /* __UART_H__ */
@@ -0,0 +1,51 @@
+#Host simulation of the CARME-M4 board, included by the exercise Makefiles.
+#Builds the application sources together with the stand-ins in $(SIM_DIR)
+#and the harness in ./sim into a native executable.
+#Needs: TARGET, SRC_DIR, BUILD_DIR, CFILES and SIM_DIR set by the includer.
+#FreeRTOS exercises set SIM_RTOS=1 and need a FreeRTOS-Kernel checkout with
+#the POSIX port: make sim FREERTOS_KERNEL=/path/to/FreeRTOS-Kernel
+
+SIM_CC?=gcc
+SIM_BUILD_DIR=$(BUILD_DIR)/sim
+SIM_TARGET=$(SIM_BUILD_DIR)/$(TARGET)
+SIM_TICKS?=10000
+
+#Target only files are replaced by the stand-ins
+SIM_CFILES=$(filter-out %/syscalls.c %/tiny_printf.c,$(CFILES))
+SIM_CFILES+=$(wildcard $(SIM_DIR)/src/*.c) $(wildcard ./sim/*.c)
+SIM_HFILES=$(wildcard $(SIM_DIR)/include/*.h $(SIM_DIR)/src/*.h) $(shell find $(SRC_DIR) -name '*.h')
+
+SIM_CPPFLAGS=-I$(SIM_DIR)/include -I$(SRC_DIR) -DCARME_SIM
+SIM_CFLAGS?=-O2 -g -Wall -Wno-unused-variable -Wno-unused-but-set-variable
+SIM_LDFLAGS?=
+SIM_LDLIBS=
+
+#Kernel with the POSIX port instead of libFreeRTOS.a
+ifeq ($(SIM_RTOS),1)
+FREERTOS_KERNEL?=$(SIM_DIR)/FreeRTOS-Kernel
+SIM_PORT_DIR=$(FREERTOS_KERNEL)/portable/ThirdParty/GCC/Posix
+SIM_CFILES+=$(wildcard $(SIM_DIR)/freertos/*.c)
+SIM_KERNEL_CFILES=$(addprefix $(FREERTOS_KERNEL)/,tasks.c queue.c list.c timers.c event_groups.c)
+SIM_KERNEL_CFILES+=$(SIM_PORT_DIR)/port.c $(SIM_PORT_DIR)/utils/wait_for_event.c
+SIM_KERNEL_CFILES+=$(FREERTOS_KERNEL)/portable/MemMang/heap_4.c
+SIM_HFILES+=$(wildcard $(SIM_DIR)/freertos/*.h)
+SIM_CPPFLAGS+=-I$(SIM_DIR)/freertos -I$(FREERTOS_KERNEL)/include
+SIM_CPPFLAGS+=-I$(SIM_PORT_DIR) -I$(SIM_PORT_DIR)/utils
+SIM_LDLIBS+=-lpthread
+endif
+
+.PHONY: sim sim-run
+
+#Build the host executable
+sim: $(SIM_TARGET)
+
+$(SIM_TARGET): $(SIM_CFILES) $(SIM_HFILES)
+	@echo Building host simulation...
+	@test "$(SIM_RTOS)" != 1 -o -f $(FREERTOS_KERNEL)/tasks.c || \
+		(echo "FreeRTOS-Kernel not found, set FREERTOS_KERNEL"; exit 1)
+	$(MKDIR) $(SIM_BUILD_DIR)
+	$(SIM_CC) $(SIM_CFLAGS) $(SIM_CPPFLAGS) -o $@ $(SIM_CFILES) $(SIM_KERNEL_CFILES) $(SIM_LDFLAGS) $(SIM_LDLIBS)
+
+#Run for SIM_TICKS virtual ticks
+sim-run: sim
+	SIM_TICKS=$(SIM_TICKS) $(SIM_TARGET)
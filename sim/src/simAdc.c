@@ -0,0 +1,734 @@
+/******************************************************************************/
+/** \file       simAdc.c
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for ADC1 with DMA2 stream 0. The regular group
+ *              is converted on every update event of the trigger timer
+ *              (TIM2 or TIM3 TRGO), the DMA copies the results to memory
+ *              and raises the half transfer and transfer complete
+ *              interrupts. The due scans are caught up on every tick from
+ *              the virtual time.
+ *              The converted values come from the IO2 inputs set with
+ *              vSimSetAdc or the script. If SIM_ADC_FILE names a file of
+ *              recorded samples, it is played back instead, one scan per
+ *              line and restarting at the end:
+ *                  # port0 port1 port2
+ *                  512 0 1023
+ *                  515 0 1023
+ *              A missing column takes the value of the IO2 input.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              ADC_StructInit
+ *              ADC_Init
+ *              ADC_RegularChannelConfig
+ *              ADC_DMARequestAfterLastTransferCmd
+ *              ADC_DMACmd
+ *              ADC_Cmd
+ *              DMA_DeInit
+ *              DMA_StructInit
+ *              DMA_Init
+ *              DMA_ITConfig
+ *              DMA_Cmd
+ *              DMA_GetITStatus
+ *              DMA_ClearITPendingBit
+ *  functions  local:
+ *              vSimAdcPoll
+ *              vSimAdcScan
+ *              u16SimAdcSample
+ *              vSimDmaTransfer
+ *              u32SimDmaFlag
+ *              u64SimAdcPeriodNs
+ *              vSimAdcLoad
+ *              vSimAdcReport
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <stm32f4xx.h>
+#include <sim.h>
+#include "simInternal.h"
+
+//----- Macros -----------------------------------------------------------------
+#define SIM_ADC_CR2_ADON    ( ( uint32_t ) 0x00000001 )
+#define SIM_ADC_CR2_DMA     ( ( uint32_t ) 0x00000100 )
+#define SIM_ADC_CR2_DDS     ( ( uint32_t ) 0x00000200 )
+
+#define SIM_ADC_PORTS       ( 3 )           /* IO2 inputs, file columns       */
+#define SIM_ADC_CATCH_UP    ( 10000 )       /* Scans per poll at most         */
+#define SIM_ADC_NONE        ( INT32_MIN )   /* Column missing in the file     */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+void DMA2_Stream0_IRQHandler(void) __attribute__((weak));
+
+static void     vSimAdcPoll(void);
+static void     vSimAdcScan(void);
+static uint16_t u16SimAdcSample(uint8_t u8Channel);
+static void     vSimDmaTransfer(uint16_t u16Value);
+static uint32_t u32SimDmaFlag(uint32_t u32It);
+static uint64_t u64SimAdcPeriodNs(void);
+static void     vSimAdcLoad(void);
+static void     vSimAdcReport(void);
+
+//----- Data -------------------------------------------------------------------
+ADC_TypeDef sSimAdc;
+DMA_Stream_TypeDef sSimDma2Stream0;
+
+static ADC_InitTypeDef sAdcInit;            /* Settings of ADC1               */
+static uint8_t   u8RankChannel[SIM_ADC_RANKS]; /* Channel of every rank       */
+static uint8_t   u8Running;                 /* Trigger seen running           */
+static uint64_t  u64NextNs;                 /* Virtual time of next trigger   */
+
+static uint32_t  u32DmaSize;                /* Items of the DMA buffer        */
+static uint32_t  u32DmaMode;                /* Normal or circular             */
+static uint32_t  u32DmaIt;                  /* Enabled interrupts, DMA_IT_xx  */
+static uint32_t  u32DmaFlags;               /* Pending interrupts, DMA_IT_xx  */
+
+static int32_t  *pi32Samples;               /* Recorded scans, SIM_ADC_PORTS  */
+static uint32_t  u32SampleScans;            /* Scans in the file              */
+static uint32_t  u32SampleNext;             /* Next scan to play              */
+static uint8_t   u8Loaded;                  /* SIM_ADC_FILE read              */
+
+static uint32_t  u32Scans;                  /* Converted scans                */
+static uint32_t  u32Interrupts;             /* DMA interrupts raised          */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    ADC_StructInit
+ ******************************************************************************/
+/** \brief        Default settings: 12 bit, single conversion, no trigger
+ *
+ *  \type         global
+ *
+ *  \param[out]   psInit    ADC settings
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void ADC_StructInit(ADC_InitTypeDef *psInit)
+{
+
+    psInit->ADC_Resolution = ADC_Resolution_12b;
+    psInit->ADC_ScanConvMode = DISABLE;
+    psInit->ADC_ContinuousConvMode = DISABLE;
+    psInit->ADC_ExternalTrigConvEdge = ADC_ExternalTrigConvEdge_None;
+    psInit->ADC_ExternalTrigConv = ADC_ExternalTrigConv_T1_CC1;
+    psInit->ADC_DataAlign = ADC_DataAlign_Right;
+    psInit->ADC_NbrOfConversion = 1;
+}
+
+/*******************************************************************************
+ *  function :    ADC_Init
+ ******************************************************************************/
+/** \brief        Configure ADC1
+ *
+ *  \type         global
+ *
+ *  \param[in]    psAdc     ADC stand-in
+ *  \param[in]    psInit    ADC settings
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void ADC_Init(ADC_TypeDef *psAdc, ADC_InitTypeDef *psInit)
+{
+
+    (void) psAdc;
+    sAdcInit = *psInit;
+    if ((sAdcInit.ADC_NbrOfConversion == 0) ||
+        (sAdcInit.ADC_NbrOfConversion > SIM_ADC_RANKS)) {
+        sAdcInit.ADC_NbrOfConversion = 1;
+    }
+    if (sAdcInit.ADC_ScanConvMode == DISABLE) {
+        sAdcInit.ADC_NbrOfConversion = 1;
+    }
+}
+
+/*******************************************************************************
+ *  function :    ADC_RegularChannelConfig
+ ******************************************************************************/
+/** \brief        Assign a channel to a rank of the regular group
+ *
+ *  \type         global
+ *
+ *  \param[in]    psAdc         ADC stand-in
+ *  \param[in]    u8Channel     ADC_Channel_x
+ *  \param[in]    u8Rank        1 .. SIM_ADC_RANKS
+ *  \param[in]    u8SampleTime  not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void ADC_RegularChannelConfig(ADC_TypeDef *psAdc, uint8_t u8Channel,
+                              uint8_t u8Rank, uint8_t u8SampleTime)
+{
+
+    (void) psAdc;
+    (void) u8SampleTime;
+    if ((u8Rank >= 1) && (u8Rank <= SIM_ADC_RANKS)) {
+        u8RankChannel[u8Rank - 1] = u8Channel;
+    }
+}
+
+/*******************************************************************************
+ *  function :    ADC_DMARequestAfterLastTransferCmd
+ ******************************************************************************/
+/** \brief        Keep requesting the DMA after its last transfer, needed for
+ *                a circular buffer
+ *
+ *  \type         global
+ *
+ *  \param[in]    psAdc     ADC stand-in
+ *  \param[in]    NewState  ENABLE or DISABLE
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void ADC_DMARequestAfterLastTransferCmd(ADC_TypeDef *psAdc,
+                                        FunctionalState NewState)
+{
+
+    if (NewState != DISABLE) {
+        psAdc->CR2 |= SIM_ADC_CR2_DDS;
+    } else {
+        psAdc->CR2 &= ~SIM_ADC_CR2_DDS;
+    }
+}
+
+/*******************************************************************************
+ *  function :    ADC_DMACmd
+ ******************************************************************************/
+/** \brief        Enable the DMA requests of ADC1
+ *
+ *  \type         global
+ *
+ *  \param[in]    psAdc     ADC stand-in
+ *  \param[in]    NewState  ENABLE or DISABLE
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void ADC_DMACmd(ADC_TypeDef *psAdc, FunctionalState NewState)
+{
+
+    if (NewState != DISABLE) {
+        psAdc->CR2 |= SIM_ADC_CR2_DMA;
+    } else {
+        psAdc->CR2 &= ~SIM_ADC_CR2_DMA;
+    }
+}
+
+/*******************************************************************************
+ *  function :    ADC_Cmd
+ ******************************************************************************/
+/** \brief        Power ADC1 on or off. The first power on attaches the
+ *                converter to the simulated interrupts.
+ *
+ *  \type         global
+ *
+ *  \param[in]    psAdc     ADC stand-in
+ *  \param[in]    NewState  ENABLE or DISABLE
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void ADC_Cmd(ADC_TypeDef *psAdc, FunctionalState NewState)
+{
+
+    if (NewState != DISABLE) {
+        psAdc->CR2 |= SIM_ADC_CR2_ADON;
+        if (!u8Loaded) {
+            vSimAdcLoad();
+            atexit(vSimAdcReport);
+            vSimIrqAttach(vSimAdcPoll);
+        }
+    } else {
+        psAdc->CR2 &= ~SIM_ADC_CR2_ADON;
+    }
+}
+
+/*******************************************************************************
+ *  function :    DMA_DeInit
+ ******************************************************************************/
+/** \brief        Reset DMA2 stream 0
+ *
+ *  \type         global
+ *
+ *  \param[in]    psStream  stream stand-in
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void DMA_DeInit(DMA_Stream_TypeDef *psStream)
+{
+
+    psStream->CR = 0;
+    psStream->NDTR = 0;
+    psStream->PAR = 0;
+    psStream->M0AR = 0;
+    u32DmaSize = 0;
+    u32DmaMode = DMA_Mode_Normal;
+    u32DmaIt = 0;
+    u32DmaFlags = 0;
+}
+
+/*******************************************************************************
+ *  function :    DMA_StructInit
+ ******************************************************************************/
+/** \brief        Default settings, all zero
+ *
+ *  \type         global
+ *
+ *  \param[out]   psInit    DMA settings
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void DMA_StructInit(DMA_InitTypeDef *psInit)
+{
+
+    psInit->DMA_Channel = DMA_Channel_0;
+    psInit->DMA_PeripheralBaseAddr = 0;
+    psInit->DMA_Memory0BaseAddr = 0;
+    psInit->DMA_DIR = DMA_DIR_PeripheralToMemory;
+    psInit->DMA_BufferSize = 0;
+    psInit->DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    psInit->DMA_MemoryInc = 0;
+    psInit->DMA_PeripheralDataSize = 0;
+    psInit->DMA_MemoryDataSize = 0;
+    psInit->DMA_Mode = DMA_Mode_Normal;
+    psInit->DMA_Priority = 0;
+    psInit->DMA_FIFOMode = 0;
+    psInit->DMA_FIFOThreshold = 0;
+    psInit->DMA_MemoryBurst = 0;
+    psInit->DMA_PeripheralBurst = 0;
+}
+
+/*******************************************************************************
+ *  function :    DMA_Init
+ ******************************************************************************/
+/** \brief        Configure DMA2 stream 0. Only half words from the ADC to
+ *                incremented memory are simulated.
+ *
+ *  \type         global
+ *
+ *  \param[in]    psStream  stream stand-in
+ *  \param[in]    psInit    DMA settings
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void DMA_Init(DMA_Stream_TypeDef *psStream, DMA_InitTypeDef *psInit)
+{
+
+    if ((psInit->DMA_MemoryInc != DMA_MemoryInc_Enable) ||
+        (psInit->DMA_MemoryDataSize != DMA_MemoryDataSize_HalfWord)) {
+        fprintf(stderr, "sim: DMA only to incremented half words\n");
+        abort();
+    }
+    psStream->PAR = psInit->DMA_PeripheralBaseAddr;
+    psStream->M0AR = psInit->DMA_Memory0BaseAddr;
+    psStream->NDTR = psInit->DMA_BufferSize;
+    u32DmaSize = psInit->DMA_BufferSize;
+    u32DmaMode = psInit->DMA_Mode;
+}
+
+/*******************************************************************************
+ *  function :    DMA_ITConfig
+ ******************************************************************************/
+/** \brief        Enable the half transfer and transfer complete interrupts
+ *
+ *  \type         global
+ *
+ *  \param[in]    psStream  stream stand-in
+ *  \param[in]    u32It     DMA_IT_HT and/or DMA_IT_TC
+ *  \param[in]    NewState  ENABLE or DISABLE
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void DMA_ITConfig(DMA_Stream_TypeDef *psStream, uint32_t u32It,
+                  FunctionalState NewState)
+{
+
+    (void) psStream;
+    if (NewState != DISABLE) {
+        u32DmaIt |= u32It & (DMA_IT_HT | DMA_IT_TC);
+    } else {
+        u32DmaIt &= ~u32It;
+    }
+}
+
+/*******************************************************************************
+ *  function :    DMA_Cmd
+ ******************************************************************************/
+/** \brief        Start or stop the stream
+ *
+ *  \type         global
+ *
+ *  \param[in]    psStream  stream stand-in
+ *  \param[in]    NewState  ENABLE or DISABLE
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void DMA_Cmd(DMA_Stream_TypeDef *psStream, FunctionalState NewState)
+{
+
+    if (NewState != DISABLE) {
+        psStream->CR |= DMA_SxCR_EN;
+    } else {
+        psStream->CR &= ~DMA_SxCR_EN;
+    }
+}
+
+/*******************************************************************************
+ *  function :    DMA_GetITStatus
+ ******************************************************************************/
+/** \brief        Pending interrupt of stream 0
+ *
+ *  \type         global
+ *
+ *  \param[in]    psStream  stream stand-in
+ *  \param[in]    u32It     DMA_IT_HTIF0 or DMA_IT_TCIF0
+ *
+ *  \return       SET if pending and enabled
+ *
+ ******************************************************************************/
+ITStatus DMA_GetITStatus(DMA_Stream_TypeDef *psStream, uint32_t u32It)
+{
+
+    uint32_t u32Flag = u32SimDmaFlag(u32It);
+
+    (void) psStream;
+    return ((u32DmaFlags & u32DmaIt & u32Flag) != 0) ? SET : RESET;
+}
+
+/*******************************************************************************
+ *  function :    DMA_ClearITPendingBit
+ ******************************************************************************/
+/** \brief        Clear a pending interrupt of stream 0
+ *
+ *  \type         global
+ *
+ *  \param[in]    psStream  stream stand-in
+ *  \param[in]    u32It     DMA_IT_HTIF0 or DMA_IT_TCIF0
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void DMA_ClearITPendingBit(DMA_Stream_TypeDef *psStream, uint32_t u32It)
+{
+
+    (void) psStream;
+    u32DmaFlags &= ~u32SimDmaFlag(u32It);
+}
+
+/*******************************************************************************
+ *  function :    vSimAdcPoll
+ ******************************************************************************/
+/** \brief        Interrupt source: convert the scans triggered since the
+ *                last poll. A backlog of more than SIM_ADC_CATCH_UP scans is
+ *                dropped, like triggers missed by a busy converter.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimAdcPoll(void)
+{
+
+    uint64_t u64Now = u64SimGetTimeNs();
+    uint64_t u64Period = u64SimAdcPeriodNs();
+    uint32_t u32Count = 0;
+
+    if ((u64Period == 0) || !(sSimAdc.CR2 & SIM_ADC_CR2_ADON)) {
+        u8Running = 0;
+        return;
+    }
+    if (!u8Running) {
+        u8Running = 1;
+        u64NextNs = u64Now + u64Period;
+        return;
+    }
+    while ((u64NextNs <= u64Now) && (u32Count < SIM_ADC_CATCH_UP)) {
+        vSimAdcScan();
+        u64NextNs += u64Period;
+        u32Count++;
+    }
+    if (u64NextNs <= u64Now) {
+        u64NextNs = u64Now + u64Period;
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimAdcScan
+ ******************************************************************************/
+/** \brief        Convert all ranks of the regular group
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimAdcScan(void)
+{
+
+    uint8_t u8Rank;
+
+    for (u8Rank = 0; u8Rank < sAdcInit.ADC_NbrOfConversion; u8Rank++) {
+        sSimAdc.DR = u16SimAdcSample(u8RankChannel[u8Rank]);
+        if (sSimAdc.CR2 & SIM_ADC_CR2_DMA) {
+            vSimDmaTransfer((uint16_t) sSimAdc.DR);
+        }
+    }
+    u32Scans++;
+    if (u32SampleScans != 0) {
+        u32SampleNext = (u32SampleNext + 1) % u32SampleScans;
+    }
+}
+
+/*******************************************************************************
+ *  function :    u16SimAdcSample
+ ******************************************************************************/
+/** \brief        Value of a channel in the current scan
+ *
+ *  \type         local
+ *
+ *  \param[in]    u8Channel     ADC_Channel_x
+ *
+ *  \return       converted value in the configured resolution
+ *
+ ******************************************************************************/
+static uint16_t u16SimAdcSample(uint8_t u8Channel)
+{
+
+    int32_t i32Value = SIM_ADC_NONE;
+    uint8_t u8Port;
+    uint16_t u16Max;
+
+    /* IO2 ports 0, 1 and 2 are channels 8, 10 and 12 */
+    switch (u8Channel) {
+        case ADC_Channel_8:  u8Port = 0; break;
+        case ADC_Channel_10: u8Port = 1; break;
+        case ADC_Channel_12: u8Port = 2; break;
+        default:             return 0;
+    }
+
+    u16Max = (sAdcInit.ADC_Resolution == ADC_Resolution_10b) ? 0x3FF : 0xFFF;
+    if (u32SampleScans != 0) {
+        i32Value = pi32Samples[u32SampleNext * SIM_ADC_PORTS + u8Port];
+    }
+    if (i32Value == SIM_ADC_NONE) {
+        /* The IO2 inputs are 10 bit */
+        i32Value = u16SimAdcGet(u8Port);
+        if (u16Max == 0xFFF) {
+            i32Value <<= 2;
+        }
+    }
+    if (i32Value < 0) {
+        i32Value = 0;
+    }
+    return (i32Value > u16Max) ? u16Max : (uint16_t) i32Value;
+}
+
+/*******************************************************************************
+ *  function :    vSimDmaTransfer
+ ******************************************************************************/
+/** \brief        Store one conversion and raise the interrupts that are due
+ *
+ *  \type         local
+ *
+ *  \param[in]    u16Value  converted value
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimDmaTransfer(uint16_t u16Value)
+{
+
+    DMA_Stream_TypeDef *psStream = &sSimDma2Stream0;
+    uint16_t *pu16Memory = (uint16_t *) psStream->M0AR;
+    uint32_t u32Raised = 0;
+
+    if (!(psStream->CR & DMA_SxCR_EN) || (psStream->NDTR == 0) ||
+        (pu16Memory == NULL)) {
+        return;
+    }
+
+    pu16Memory[u32DmaSize - psStream->NDTR] = u16Value;
+    psStream->NDTR--;
+
+    if (psStream->NDTR == u32DmaSize / 2) {
+        u32Raised = DMA_IT_HT;
+    } else if (psStream->NDTR == 0) {
+        u32Raised = DMA_IT_TC;
+        if (u32DmaMode == DMA_Mode_Circular) {
+            psStream->NDTR = u32DmaSize;
+        } else {
+            psStream->CR &= ~DMA_SxCR_EN;
+        }
+        if (!(sSimAdc.CR2 & SIM_ADC_CR2_DDS)) {
+            sSimAdc.CR2 &= ~SIM_ADC_CR2_DMA;
+        }
+    }
+
+    u32DmaFlags |= u32Raised;
+    if ((u32Raised & u32DmaIt) && u8SimNvicEnabled(DMA2_Stream0_IRQn) &&
+        (DMA2_Stream0_IRQHandler != NULL)) {
+        u32Interrupts++;
+        DMA2_Stream0_IRQHandler();
+    }
+}
+
+/*******************************************************************************
+ *  function :    u32SimDmaFlag
+ ******************************************************************************/
+/** \brief        Map a stream 0 interrupt flag onto DMA_IT_HT or DMA_IT_TC
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32It     DMA_IT_HTIF0 or DMA_IT_TCIF0
+ *
+ *  \return       DMA_IT_xx, 0 for other flags
+ *
+ ******************************************************************************/
+static uint32_t u32SimDmaFlag(uint32_t u32It)
+{
+
+    if (u32It == DMA_IT_HTIF0) {
+        return DMA_IT_HT;
+    }
+    if (u32It == DMA_IT_TCIF0) {
+        return DMA_IT_TC;
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    u64SimAdcPeriodNs
+ ******************************************************************************/
+/** \brief        Period of the trigger timer
+ *
+ *  \type         local
+ *
+ *  \return       period in ns, 0 if no running timer triggers ADC1
+ *
+ ******************************************************************************/
+static uint64_t u64SimAdcPeriodNs(void)
+{
+
+    TIM_TypeDef *psTim;
+
+    if (sAdcInit.ADC_ExternalTrigConvEdge == ADC_ExternalTrigConvEdge_None) {
+        return 0;
+    }
+    if (sAdcInit.ADC_ExternalTrigConv == ADC_ExternalTrigConv_T2_TRGO) {
+        psTim = &sSimTim[0];
+    } else if (sAdcInit.ADC_ExternalTrigConv == ADC_ExternalTrigConv_T3_TRGO) {
+        psTim = &sSimTim[1];
+    } else {
+        return 0;
+    }
+    if (!(psTim->CR1 & TIM_CR1_CEN) ||
+        ((psTim->CR2 & TIM_CR2_MMS) != TIM_TRGOSource_Update)) {
+        return 0;
+    }
+
+    /* Timer clock is SystemCoreClock / 2 */
+    return ((uint64_t) (psTim->PSC + 1U) * ((uint64_t) psTim->ARR + 1U) * 1000U) /
+           (SystemCoreClock / 2U / 1000000U);
+}
+
+/*******************************************************************************
+ *  function :    vSimAdcLoad
+ ******************************************************************************/
+/** \brief        Read the recorded samples named by SIM_ADC_FILE
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimAdcLoad(void)
+{
+
+    const char *pcName = getenv("SIM_ADC_FILE");
+    FILE *psFile;
+    char cLine[256];
+    char *pcPos;
+    char *pcEnd;
+    uint32_t u32Size = 0;
+    int32_t *pi32New;
+    uint8_t u8Port;
+
+    u8Loaded = 1;
+    if (pcName == NULL) {
+        return;
+    }
+    if ((psFile = fopen(pcName, "r")) == NULL) {
+        perror(pcName);
+        exit(1);
+    }
+
+    while (fgets(cLine, sizeof(cLine), psFile) != NULL) {
+        pcPos = cLine;
+        while ((*pcPos == ' ') || (*pcPos == '\t')) {
+            pcPos++;
+        }
+        if ((*pcPos == '#') || (*pcPos == '\n') || (*pcPos == '\r') || (*pcPos == '\0')) {
+            continue;
+        }
+        if (u32SampleScans == u32Size) {
+            u32Size = (u32Size != 0) ? (u32Size * 2) : 1024;
+            pi32New = realloc(pi32Samples, u32Size * SIM_ADC_PORTS * sizeof(int32_t));
+            if (pi32New == NULL) {
+                fprintf(stderr, "sim: %s too large\n", pcName);
+                exit(1);
+            }
+            pi32Samples = pi32New;
+        }
+        for (u8Port = 0; u8Port < SIM_ADC_PORTS; u8Port++) {
+            pi32Samples[u32SampleScans * SIM_ADC_PORTS + u8Port] =
+                (int32_t) strtol(pcPos, &pcEnd, 0);
+            if (pcEnd == pcPos) {
+                pi32Samples[u32SampleScans * SIM_ADC_PORTS + u8Port] = SIM_ADC_NONE;
+            }
+            pcPos = pcEnd;
+        }
+        u32SampleScans++;
+    }
+    fclose(psFile);
+}
+
+/*******************************************************************************
+ *  function :    vSimAdcReport
+ ******************************************************************************/
+/** \brief        Print the throughput when the simulation ends
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimAdcReport(void)
+{
+
+    fprintf(stderr, "sim: adc %u scans, %u DMA interrupts\n",
+            (unsigned) u32Scans, (unsigned) u32Interrupts);
+}
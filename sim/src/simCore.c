@@ -0,0 +1,603 @@
+/******************************************************************************/
+/** \file       simCore.c
+ *******************************************************************************
+ *
+ *  \brief      Core of the host simulation. The SysTick is mapped onto
+ *              SIGALRM, masking interrupts blocks the signal and WFI waits
+ *              for it.
+ *              By default the idle time in WFI is skipped: the pending tick
+ *              is delivered at once and the virtual clock is advanced by the
+ *              time which would have been slept. Busy time is real host
+ *              time, so a frame which takes too long still sees the tick
+ *              arriving while it is running.
+ *              With FreeRTOS the POSIX port owns the time base and reports
+ *              every tick through u8SimTick, idle time is not skipped then.
+ *              Simulated peripherals attach an interrupt source which is
+ *              polled on every tick. With FreeRTOS the sources are polled by
+ *              a task of the highest priority instead (vSimRtosIrqStart),
+ *              a handler may then yield like on the target.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, External ticks, script, DWT
+ *               \li id101010, 17.10.2026, Interrupt sources, NVIC
+ *               \li id101010, 17.10.2026, LCD frames
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              SysTick_Config
+ *              __WFI
+ *              __disable_irq
+ *              __enable_irq
+ *              Default_Handler
+ *              CARME_Init
+ *              psSimDwt
+ *              u8SimTick
+ *              u32SimGetTicks
+ *              u64SimGetTimeNs
+ *              u64SimGetIdleNs
+ *              vSimSetTickHook
+ *              NVIC_Init
+ *              u8SimNvicEnabled
+ *              vSimIrqAttach
+ *              vSimIrqPoll
+ *  functions  local:
+ *              vSimInit
+ *              vSimReport
+ *              vSimSignal
+ *              vSimTick
+ *              vSimArmTimer
+ *              u64SimNow
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+
+#include <stm32f4xx.h>
+#include <carme.h>
+#include <sim.h>
+#include "simInternal.h"
+
+//----- Macros -----------------------------------------------------------------
+#define SIM_CORE_CLOCK      ( 168000000 )   /* Simulated core clock in Hz     */
+#define SIM_IRQS            ( 82 )          /* Interrupt lines of the F407    */
+#define SIM_IRQ_SOURCES     ( 8 )           /* Attached peripherals           */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+void SysTick_Handler(void) __attribute__((weak));
+void vSimRtosIrqStart(void) __attribute__((weak));
+
+static void vSimInit(void) __attribute__((constructor));
+static void vSimReport(void);
+static void vSimSignal(int iSignal);
+static void vSimTick(void);
+static void vSimArmTimer(void);
+static uint64_t u64SimNow(void);
+
+//----- Data -------------------------------------------------------------------
+uint32_t SystemCoreClock = SIM_CORE_CLOCK;
+CoreDebug_Type sSimCoreDebug;
+USART_TypeDef sSimUsart[2];
+uint8_t u8SimPsram[SIM_PSRAM_SIZE] __attribute__((aligned(4)));
+
+static DWT_Type           sDwt;             /* Cycle counter stand-in         */
+
+static sigset_t           sTickMask;        /* Signal standing for SysTick    */
+static uint64_t           u64StartNs;       /* Host time at start-up          */
+static uint64_t           u64SkippedNs;     /* Idle time skipped in WFI       */
+static uint64_t           u64IdleNs;        /* Total time spent in WFI        */
+static uint64_t           u64LastTickNs;    /* Virtual time of the last tick  */
+static uint32_t           u32TickNs;        /* Tick period, 0 if not started  */
+static uint32_t           u32RunTicks;      /* Stop after that many ticks     */
+static uint8_t            u8Realtime;       /* Sleep instead of skipping      */
+static volatile uint32_t  u32Ticks;         /* Delivered ticks                */
+static SimTickHook        pfTickHook;       /* Harness hook                   */
+static uint8_t            u8NvicEnabled[SIM_IRQS]; /* Enabled interrupt lines */
+static SimIrqSource       pfIrqSource[SIM_IRQ_SOURCES]; /* Peripherals        */
+static uint8_t            u8IrqSources;     /* Attached sources               */
+static uint8_t            u8IrqTask;        /* Sources polled by the RTOS glue*/
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    SysTick_Config
+ ******************************************************************************/
+/** \brief        Start the simulated SysTick
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Ticks   Reload value in core clock cycles
+ *
+ *  \return       0 on success
+ *
+ ******************************************************************************/
+uint32_t SysTick_Config(uint32_t u32Ticks)
+{
+
+    u32TickNs = (uint32_t) (((uint64_t) u32Ticks * 1000000000ULL) / SystemCoreClock);
+    if (u32TickNs < 1000) {
+        u32TickNs = 1000;
+    }
+    u64LastTickNs = u64SimGetTimeNs();
+    vSimArmTimer();
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    __WFI
+ ******************************************************************************/
+/** \brief        Wait for interrupt. Returns at once if a tick is pending,
+ *                like the core does with a pending but masked interrupt.
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void __WFI(void)
+{
+
+    sigset_t sOld;
+    sigset_t sWait;
+    uint64_t u64Now;
+    uint64_t u64Next;
+
+    sigprocmask(SIG_BLOCK, &sTickMask, &sOld);
+    sigpending(&sWait);
+
+    if (!sigismember(&sWait, SIGALRM)) {
+        if (u8Realtime || (u32TickNs == 0)) {
+            u64Now = u64SimNow();
+            sWait = sOld;
+            sigdelset(&sWait, SIGALRM);
+            sigsuspend(&sWait);
+            u64IdleNs += u64SimNow() - u64Now;
+        } else {
+            /* Skip the rest of the tick period */
+            u64Now = u64SimGetTimeNs();
+            u64Next = u64LastTickNs + u32TickNs;
+            if (u64Next > u64Now) {
+                u64SkippedNs += u64Next - u64Now;
+                u64IdleNs += u64Next - u64Now;
+            }
+            vSimArmTimer();
+            vSimTick();
+        }
+    }
+    sigprocmask(SIG_SETMASK, &sOld, NULL);
+
+    if ((u32RunTicks != 0) && (u32Ticks >= u32RunTicks)) {
+        exit(0);
+    }
+}
+
+/*******************************************************************************
+ *  function :    __disable_irq
+ ******************************************************************************/
+/** \brief        Mask the simulated interrupts
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void __disable_irq(void)
+{
+
+    sigprocmask(SIG_BLOCK, &sTickMask, NULL);
+}
+
+/*******************************************************************************
+ *  function :    __enable_irq
+ ******************************************************************************/
+/** \brief        Unmask the simulated interrupts, a pending tick is taken
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void __enable_irq(void)
+{
+
+    sigprocmask(SIG_UNBLOCK, &sTickMask, NULL);
+}
+
+/*******************************************************************************
+ *  function :    Default_Handler
+ ******************************************************************************/
+/** \brief        Unexpected exception, stop the simulation
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void Default_Handler(void)
+{
+
+    fprintf(stderr, "sim: unexpected exception\n");
+    abort();
+}
+
+/*******************************************************************************
+ *  function :    CARME_Init
+ ******************************************************************************/
+/** \brief        Initialize the CARME module, nothing to do on the host
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void CARME_Init(void)
+{
+}
+
+/*******************************************************************************
+ *  function :    psSimDwt
+ ******************************************************************************/
+/** \brief        Access to the DWT. The cycle counter is updated from the
+ *                virtual time (clock_gettime) at SystemCoreClock.
+ *
+ *  \type         global
+ *
+ *  \return       DWT stand-in
+ *
+ ******************************************************************************/
+DWT_Type *psSimDwt(void)
+{
+
+    if (sDwt.CTRL & DWT_CTRL_CYCCNTENA_Msk) {
+        sDwt.CYCCNT = (uint32_t) ((u64SimGetTimeNs() * (SystemCoreClock / 1000000U)) / 1000U);
+    }
+    return &sDwt;
+}
+
+/*******************************************************************************
+ *  function :    u8SimTick
+ ******************************************************************************/
+/** \brief        Count a tick, end LCD frames and run the script and the
+ *                harness hook. Called for the simulated SysTick and by the
+ *                FreeRTOS glue.
+ *
+ *  \type         global
+ *
+ *  \return       1 once SIM_TICKS ticks are reached, 0 otherwise
+ *
+ ******************************************************************************/
+uint8_t u8SimTick(void)
+{
+
+    u32Ticks++;
+    u64LastTickNs = u64SimGetTimeNs();
+
+    vSimLcdTick(u32Ticks);
+    vSimScriptTick(u32Ticks);
+    if (pfTickHook != NULL) {
+        pfTickHook(u32Ticks);
+    }
+    if (!u8IrqTask) {
+        vSimIrqPoll();
+    }
+    return (uint8_t) (u32Ticks == u32RunTicks);
+}
+
+/*******************************************************************************
+ *  function :    u32SimGetTicks
+ ******************************************************************************/
+/** \brief        Number of delivered ticks
+ *
+ *  \type         global
+ *
+ *  \return       ticks since SysTick_Config
+ *
+ ******************************************************************************/
+uint32_t u32SimGetTicks(void)
+{
+
+    return u32Ticks;
+}
+
+/*******************************************************************************
+ *  function :    u64SimGetTimeNs
+ ******************************************************************************/
+/** \brief        Virtual time: host time plus the skipped idle time
+ *
+ *  \type         global
+ *
+ *  \return       virtual time since start-up in ns
+ *
+ ******************************************************************************/
+uint64_t u64SimGetTimeNs(void)
+{
+
+    return u64SimNow() - u64StartNs + u64SkippedNs;
+}
+
+/*******************************************************************************
+ *  function :    u64SimGetIdleNs
+ ******************************************************************************/
+/** \brief        Virtual time spent in WFI
+ *
+ *  \type         global
+ *
+ *  \return       idle time in ns
+ *
+ ******************************************************************************/
+uint64_t u64SimGetIdleNs(void)
+{
+
+    return u64IdleNs;
+}
+
+/*******************************************************************************
+ *  function :    vSimSetTickHook
+ ******************************************************************************/
+/** \brief        Install a hook called on every tick, used by the harnesses
+ *                to drive buttons, switches and ADC values
+ *
+ *  \type         global
+ *
+ *  \param[in]    pfHook    hook or NULL
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimSetTickHook(SimTickHook pfHook)
+{
+
+    pfTickHook = pfHook;
+}
+
+/*******************************************************************************
+ *  function :    NVIC_Init
+ ******************************************************************************/
+/** \brief        Enable or disable an interrupt line, priorities are not
+ *                simulated
+ *
+ *  \type         global
+ *
+ *  \param[in]    psInit    interrupt line settings
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void NVIC_Init(NVIC_InitTypeDef *psInit)
+{
+
+    if (psInit->NVIC_IRQChannel < SIM_IRQS) {
+        u8NvicEnabled[psInit->NVIC_IRQChannel] =
+            (uint8_t) (psInit->NVIC_IRQChannelCmd != DISABLE);
+    }
+}
+
+/*******************************************************************************
+ *  function :    u8SimNvicEnabled
+ ******************************************************************************/
+/** \brief        State of an interrupt line, set by NVIC_Init
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8Irq     interrupt number
+ *
+ *  \return       1 if enabled, 0 otherwise
+ *
+ ******************************************************************************/
+uint8_t u8SimNvicEnabled(uint8_t u8Irq)
+{
+
+    return (u8Irq < SIM_IRQS) ? u8NvicEnabled[u8Irq] : 0;
+}
+
+/*******************************************************************************
+ *  function :    vSimIrqAttach
+ ******************************************************************************/
+/** \brief        Add a peripheral which raises interrupts. The source is
+ *                polled on every tick and calls the handlers that are due.
+ *
+ *  \type         global
+ *
+ *  \param[in]    pfSource  poll function of the peripheral
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimIrqAttach(SimIrqSource pfSource)
+{
+
+    uint8_t u8Index;
+
+    for (u8Index = 0; u8Index < u8IrqSources; u8Index++) {
+        if (pfIrqSource[u8Index] == pfSource) {
+            return;
+        }
+    }
+    if (u8IrqSources >= SIM_IRQ_SOURCES) {
+        fprintf(stderr, "sim: too many interrupt sources\n");
+        abort();
+    }
+    pfIrqSource[u8IrqSources++] = pfSource;
+
+    /* With FreeRTOS a handler must not run inside the kernel tick */
+    if ((vSimRtosIrqStart != NULL) && !u8IrqTask) {
+        u8IrqTask = 1;
+        vSimRtosIrqStart();
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimIrqPoll
+ ******************************************************************************/
+/** \brief        Poll all interrupt sources
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimIrqPoll(void)
+{
+
+    uint8_t u8Index;
+
+    for (u8Index = 0; u8Index < u8IrqSources; u8Index++) {
+        pfIrqSource[u8Index]();
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimInit
+ ******************************************************************************/
+/** \brief        Set up signals and read the configuration before main
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimInit(void)
+{
+
+    struct sigaction sAction;
+    const char *pcEnv;
+
+    sigemptyset(&sTickMask);
+    sigaddset(&sTickMask, SIGALRM);
+
+    memset(&sAction, 0, sizeof(sAction));
+    sAction.sa_handler = vSimSignal;
+    sAction.sa_mask = sTickMask;
+    sigaction(SIGALRM, &sAction, NULL);
+
+    if ((pcEnv = getenv("SIM_TICKS")) != NULL) {
+        u32RunTicks = (uint32_t) strtoul(pcEnv, NULL, 0);
+    }
+    if ((pcEnv = getenv("SIM_REALTIME")) != NULL) {
+        u8Realtime = (uint8_t) (atoi(pcEnv) != 0);
+    }
+
+    u64StartNs = u64SimNow();
+    atexit(vSimReport);
+}
+
+/*******************************************************************************
+ *  function :    vSimReport
+ ******************************************************************************/
+/** \brief        Print the time summary when the simulation ends
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimReport(void)
+{
+
+    uint64_t u64Total = u64SimGetTimeNs();
+    uint64_t u64Busy = (u64Total > u64IdleNs) ? (u64Total - u64IdleNs) : 0;
+
+    if (u64IdleNs == 0) {
+        /* No WFI, e.g. FreeRTOS: the load is not known */
+        fprintf(stderr, "sim: %u ticks, %llu us\n", (unsigned) u32Ticks,
+                (unsigned long long) (u64Total / 1000));
+        return;
+    }
+    fprintf(stderr, "sim: %u ticks, %llu us virtual, %llu us busy (%u.%u%% load)\n",
+            (unsigned) u32Ticks,
+            (unsigned long long) (u64Total / 1000),
+            (unsigned long long) (u64Busy / 1000),
+            (unsigned) ((u64Total != 0) ? (u64Busy * 100 / u64Total) : 0),
+            (unsigned) ((u64Total != 0) ? ((u64Busy * 1000 / u64Total) % 10) : 0));
+}
+
+/*******************************************************************************
+ *  function :    vSimSignal
+ ******************************************************************************/
+/** \brief        SIGALRM handler, the simulated SysTick interrupt
+ *
+ *  \type         local
+ *
+ *  \param[in]    iSignal   not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimSignal(int iSignal)
+{
+
+    (void) iSignal;
+    vSimTick();
+}
+
+/*******************************************************************************
+ *  function :    vSimTick
+ ******************************************************************************/
+/** \brief        Deliver one tick to the harness and the application
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimTick(void)
+{
+
+    (void) u8SimTick();
+    if (SysTick_Handler != NULL) {
+        SysTick_Handler();
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimArmTimer
+ ******************************************************************************/
+/** \brief        (Re)start the interval timer with the tick period
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimArmTimer(void)
+{
+
+    struct itimerval sTimer;
+
+    sTimer.it_interval.tv_sec = u32TickNs / 1000000000U;
+    sTimer.it_interval.tv_usec = (u32TickNs % 1000000000U) / 1000U;
+    sTimer.it_value = sTimer.it_interval;
+    setitimer(ITIMER_REAL, &sTimer, NULL);
+}
+
+/*******************************************************************************
+ *  function :    u64SimNow
+ ******************************************************************************/
+/** \brief        Monotonic host time
+ *
+ *  \type         local
+ *
+ *  \return       host time in ns
+ *
+ ******************************************************************************/
+static uint64_t u64SimNow(void)
+{
+
+    struct timespec sNow;
+
+    clock_gettime(CLOCK_MONOTONIC, &sNow);
+    return ((uint64_t) sNow.tv_sec * 1000000000ULL) + (uint64_t) sNow.tv_nsec;
+}
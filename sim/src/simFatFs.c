@@ -0,0 +1,200 @@
+/******************************************************************************/
+/** \file       simFatFs.c
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the read functions of FatFs. Paths are
+ *              taken relative to SIM_FS_ROOT (default: current directory),
+ *              a leading drive number ("0:") is dropped.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              f_mount
+ *              f_open
+ *              f_close
+ *              f_read
+ *              f_lseek
+ *  functions  local:
+ *              .
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ff.h>
+
+//----- Macros -----------------------------------------------------------------
+#define SIM_FS_PATH_LEN     ( 512 )     /* Longest host path                  */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+
+//----- Data -------------------------------------------------------------------
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    f_mount
+ ******************************************************************************/
+/** \brief        Mount a volume, always succeeds on the host
+ *
+ *  \type         global
+ *
+ *  \param[in]    fs        work area
+ *  \param[in]    path      logical drive
+ *  \param[in]    opt       mount option
+ *
+ *  \return       FR_OK
+ *
+ ******************************************************************************/
+FRESULT f_mount(FATFS *fs, const TCHAR *path, BYTE opt)
+{
+
+    (void) path;
+    (void) opt;
+    if (fs != NULL) {
+        fs->fs_type = 1;
+    }
+    return FR_OK;
+}
+
+/*******************************************************************************
+ *  function :    f_open
+ ******************************************************************************/
+/** \brief        Open a file for reading
+ *
+ *  \type         global
+ *
+ *  \param[in]    fp        file object
+ *  \param[in]    path      file name
+ *  \param[in]    mode      only FA_READ is supported
+ *
+ *  \return       FR_OK, FR_NO_FILE or FR_DENIED
+ *
+ ******************************************************************************/
+FRESULT f_open(FIL *fp, const TCHAR *path, BYTE mode)
+{
+
+    char cPath[SIM_FS_PATH_LEN];
+    const char *pcRoot = getenv("SIM_FS_ROOT");
+    long lSize;
+
+    fp->pfHost = NULL;
+    if (mode & ~(FA_READ | FA_OPEN_EXISTING)) {
+        return FR_DENIED;
+    }
+    if ((path[0] >= '0') && (path[0] <= '9') && (path[1] == ':')) {
+        path += 2;
+    }
+    while (*path == '/') {
+        path++;
+    }
+    snprintf(cPath, sizeof(cPath), "%s/%s", pcRoot ? pcRoot : ".", path);
+
+    fp->pfHost = fopen(cPath, "rb");
+    if (fp->pfHost == NULL) {
+        return FR_NO_FILE;
+    }
+    fseek(fp->pfHost, 0, SEEK_END);
+    lSize = ftell(fp->pfHost);
+    fseek(fp->pfHost, 0, SEEK_SET);
+    fp->fsize = (lSize > 0) ? (DWORD) lSize : 0;
+    fp->fptr = 0;
+    return FR_OK;
+}
+
+/*******************************************************************************
+ *  function :    f_close
+ ******************************************************************************/
+/** \brief        Close a file
+ *
+ *  \type         global
+ *
+ *  \param[in]    fp        file object
+ *
+ *  \return       FR_OK or FR_INVALID_OBJECT
+ *
+ ******************************************************************************/
+FRESULT f_close(FIL *fp)
+{
+
+    if (fp->pfHost == NULL) {
+        return FR_INVALID_OBJECT;
+    }
+    fclose(fp->pfHost);
+    fp->pfHost = NULL;
+    return FR_OK;
+}
+
+/*******************************************************************************
+ *  function :    f_read
+ ******************************************************************************/
+/** \brief        Read from a file
+ *
+ *  \type         global
+ *
+ *  \param[in]    fp        file object
+ *  \param[out]   buff      data
+ *  \param[in]    btr       bytes to read
+ *  \param[out]   br        bytes read
+ *
+ *  \return       FR_OK, FR_INVALID_OBJECT or FR_DISK_ERR
+ *
+ ******************************************************************************/
+FRESULT f_read(FIL *fp, void *buff, UINT btr, UINT *br)
+{
+
+    size_t uRead;
+
+    *br = 0;
+    if (fp->pfHost == NULL) {
+        return FR_INVALID_OBJECT;
+    }
+    uRead = fread(buff, 1, btr, fp->pfHost);
+    if ((uRead < btr) && ferror(fp->pfHost)) {
+        return FR_DISK_ERR;
+    }
+    fp->fptr += (DWORD) uRead;
+    *br = (UINT) uRead;
+    return FR_OK;
+}
+
+/*******************************************************************************
+ *  function :    f_lseek
+ ******************************************************************************/
+/** \brief        Move the read pointer, limited to the file size
+ *
+ *  \type         global
+ *
+ *  \param[in]    fp        file object
+ *  \param[in]    ofs       offset from the start of the file
+ *
+ *  \return       FR_OK, FR_INVALID_OBJECT or FR_DISK_ERR
+ *
+ ******************************************************************************/
+FRESULT f_lseek(FIL *fp, DWORD ofs)
+{
+
+    if (fp->pfHost == NULL) {
+        return FR_INVALID_OBJECT;
+    }
+    if (ofs > fp->fsize) {
+        ofs = fp->fsize;
+    }
+    if (fseek(fp->pfHost, (long) ofs, SEEK_SET) != 0) {
+        return FR_DISK_ERR;
+    }
+    fp->fptr = ofs;
+    return FR_OK;
+}
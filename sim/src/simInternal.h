@@ -0,0 +1,40 @@
+#ifndef SIMINTERNAL_H_
+#define SIMINTERNAL_H_
+/******************************************************************************/
+/** \file       simInternal.h
+ *******************************************************************************
+ *
+ *  \brief      Functions shared between the modules of the host simulation,
+ *              not meant for the harnesses.
+ *
+ *  \author     id101010
+ *
+ ******************************************************************************/
+/*
+ *  function    vSimScriptTick
+ *              u8SimNvicEnabled
+ *              vSimIrqAttach
+ *              vSimIrqPoll
+ *              u16SimAdcGet
+ *              vSimLcdTick
+ *              vSimLcdFrameDue
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdint.h>
+
+//----- Data types -------------------------------------------------------------
+/* Poll function of a peripheral, calls the interrupt handlers that are due */
+typedef void (*SimIrqSource)(void);
+
+//----- Function prototypes ----------------------------------------------------
+extern void     vSimScriptTick(uint32_t u32Tick);
+extern uint8_t  u8SimNvicEnabled(uint8_t u8Irq);
+extern void     vSimIrqAttach(SimIrqSource pfSource);
+extern void     vSimIrqPoll(void);
+extern uint16_t u16SimAdcGet(uint8_t u8Channel);
+extern void     vSimLcdTick(uint32_t u32Tick);
+extern void     vSimLcdFrameDue(uint32_t u32Tick);
+
+#endif /* SIMINTERNAL_H_ */
@@ -0,0 +1,400 @@
+/******************************************************************************/
+/** \file       simIo.c
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the CARME IO1 and IO2 boards. LEDs,
+ *              switches, buttons and ADC channels are plain variables which
+ *              are driven by the harness through sim.h. Once
+ *              CARME_IO1_BUTTON_Interrupt is enabled, every button change
+ *              sets the pending bit of its EXTI line on both edges and the
+ *              EXTI handlers are called from the simulated interrupts.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Button EXTI interrupts
+ *               \li id101010, 17.10.2026, LED latch for io1Service
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              CARME_IO1_Init
+ *              CARME_IO1_LED_Set
+ *              CARME_IO1_LED_Get
+ *              CARME_IO1_SWITCH_Get
+ *              CARME_IO1_BUTTON_Get
+ *              CARME_IO1_BUTTON_Interrupt
+ *              CARME_IO2_Init
+ *              CARME_IO2_ADC_Get
+ *              vSimSetButtons
+ *              vSimSetButton
+ *              vSimSetSwitches
+ *              vSimSetAdc
+ *              u16SimAdcGet
+ *              u8SimGetLeds
+ *  functions  local:
+ *              vSimButtonPoll
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stm32f4xx.h>
+#include <carme_io1.h>
+#include <carme_io2.h>
+#include <sim.h>
+#include "simInternal.h"
+
+//----- Macros -----------------------------------------------------------------
+#define SIM_ADC_CHANNELS    ( 3 )           /* Number of IO2 ADC channels     */
+#define SIM_ADC_MAX         ( 0x3FF )       /* 10 bit converter               */
+#define SIM_BUTTONS         ( 4 )           /* T0..T3                         */
+
+/* EXTI lines of the buttons: T0 PC7, T1 PB15, T2 PB14, T3 PI0 */
+#define SIM_BUTTON_LINES    ( EXTI_Line7 | EXTI_Line15 | EXTI_Line14 | EXTI_Line0 )
+#define SIM_EXTI9_5_LINES   ( ( uint32_t ) 0x003E0 )
+#define SIM_EXTI15_10_LINES ( ( uint32_t ) 0x0FC00 )
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+void EXTI0_IRQHandler(void) __attribute__((weak));
+void EXTI9_5_IRQHandler(void) __attribute__((weak));
+void EXTI15_10_IRQHandler(void) __attribute__((weak));
+
+static void vSimButtonPoll(void);
+
+//----- Data -------------------------------------------------------------------
+EXTI_TypeDef     sSimExti;
+volatile uint8_t u8SimLedLatch;         /* LEDs, io1Service writes directly */
+
+static const uint32_t u32ButtonLine[SIM_BUTTONS] = {
+    EXTI_Line7, EXTI_Line15, EXTI_Line14, EXTI_Line0
+};
+
+static volatile uint8_t  u8Switches;
+static volatile uint8_t  u8Buttons;
+static volatile uint16_t u16Adc[SIM_ADC_CHANNELS];
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    CARME_IO1_Init
+ ******************************************************************************/
+/** \brief        Initialize the IO1 board, all LEDs off
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void CARME_IO1_Init(void)
+{
+
+    u8SimLedLatch = 0;
+}
+
+/*******************************************************************************
+ *  function :    CARME_IO1_LED_Set
+ ******************************************************************************/
+/** \brief        Set the LEDs selected by mask
+ *
+ *  \type         global
+ *
+ *  \param[in]    write     LED values
+ *  \param[in]    mask      LEDs to change
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void CARME_IO1_LED_Set(uint8_t write, uint8_t mask)
+{
+
+    u8SimLedLatch = (uint8_t) ((u8SimLedLatch & ~mask) | (write & mask));
+}
+
+/*******************************************************************************
+ *  function :    CARME_IO1_LED_Get
+ ******************************************************************************/
+/** \brief        Read back the LEDs
+ *
+ *  \type         global
+ *
+ *  \param[out]   pStatus   LED values
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void CARME_IO1_LED_Get(uint8_t *pStatus)
+{
+
+    *pStatus = u8SimLedLatch;
+}
+
+/*******************************************************************************
+ *  function :    CARME_IO1_SWITCH_Get
+ ******************************************************************************/
+/** \brief        Read the switches
+ *
+ *  \type         global
+ *
+ *  \param[out]   pStatus   switch values
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void CARME_IO1_SWITCH_Get(uint8_t *pStatus)
+{
+
+    *pStatus = u8Switches;
+}
+
+/*******************************************************************************
+ *  function :    CARME_IO1_BUTTON_Get
+ ******************************************************************************/
+/** \brief        Read the buttons
+ *
+ *  \type         global
+ *
+ *  \param[out]   pStatus   button values
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void CARME_IO1_BUTTON_Get(uint8_t *pStatus)
+{
+
+    *pStatus = u8Buttons;
+}
+
+/*******************************************************************************
+ *  function :    CARME_IO1_BUTTON_Interrupt
+ ******************************************************************************/
+/** \brief        Enable or disable the EXTI interrupts of the buttons on
+ *                both edges, at the lowest priority like the BSP.
+ *
+ *  \type         global
+ *
+ *  \param[in]    NewState  ENABLE or DISABLE
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void CARME_IO1_BUTTON_Interrupt(FunctionalState NewState)
+{
+
+    static const uint8_t u8Irq[] = { EXTI0_IRQn, EXTI9_5_IRQn, EXTI15_10_IRQn };
+    NVIC_InitTypeDef sNvic;
+    uint8_t u8Index;
+
+    if (NewState != DISABLE) {
+        EXTI->RTSR |= SIM_BUTTON_LINES;
+        EXTI->FTSR |= SIM_BUTTON_LINES;
+        EXTI->IMR |= SIM_BUTTON_LINES;
+        vSimIrqAttach(vSimButtonPoll);
+    } else {
+        EXTI->IMR &= ~SIM_BUTTON_LINES;
+    }
+    for (u8Index = 0; u8Index < sizeof(u8Irq); u8Index++) {
+        sNvic.NVIC_IRQChannel = u8Irq[u8Index];
+        sNvic.NVIC_IRQChannelPreemptionPriority = 0x0F;
+        sNvic.NVIC_IRQChannelSubPriority = 0x0F;
+        sNvic.NVIC_IRQChannelCmd = NewState;
+        NVIC_Init(&sNvic);
+    }
+}
+
+/*******************************************************************************
+ *  function :    CARME_IO2_Init
+ ******************************************************************************/
+/** \brief        Initialize the IO2 board
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void CARME_IO2_Init(void)
+{
+}
+
+/*******************************************************************************
+ *  function :    CARME_IO2_ADC_Get
+ ******************************************************************************/
+/** \brief        Read an ADC channel
+ *
+ *  \type         global
+ *
+ *  \param[in]    channel   ADC channel
+ *  \param[out]   pValue    converted value
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void CARME_IO2_ADC_Get(CARME_IO2_ADC_CHANNEL channel, uint16_t *pValue)
+{
+
+    *pValue = ((unsigned) channel < SIM_ADC_CHANNELS) ? u16Adc[channel] : 0;
+}
+
+/*******************************************************************************
+ *  function :    vSimSetButtons
+ ******************************************************************************/
+/** \brief        Set the state of the buttons, every change is an edge on
+ *                the EXTI line of the button
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8State   button bits
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimSetButtons(uint8_t u8State)
+{
+
+    uint8_t u8Changed = u8Buttons ^ u8State;
+    uint32_t u32Pending = 0;
+    uint8_t u8Index;
+
+    u8Buttons = u8State;
+    for (u8Index = 0; u8Index < SIM_BUTTONS; u8Index++) {
+        if (u8Changed & (1U << u8Index)) {
+            u32Pending |= u32ButtonLine[u8Index];
+        }
+    }
+    /* The pending bit is set on a selected edge, even if the line is masked */
+    u32Pending &= EXTI->RTSR | EXTI->FTSR;
+    if (u32Pending != 0) {
+        __atomic_fetch_or(&EXTI->PR, u32Pending, __ATOMIC_SEQ_CST);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimSetButton
+ ******************************************************************************/
+/** \brief        Press or release one button
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8Button  button number 0..3
+ *  \param[in]    u8Pressed 1: pressed, 0: released
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimSetButton(uint8_t u8Button, uint8_t u8Pressed)
+{
+
+    if (u8Button < SIM_BUTTONS) {
+        if (u8Pressed) {
+            vSimSetButtons((uint8_t) (u8Buttons | (1U << u8Button)));
+        } else {
+            vSimSetButtons((uint8_t) (u8Buttons & ~(1U << u8Button)));
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimSetSwitches
+ ******************************************************************************/
+/** \brief        Set the state of the switches
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8State   switch bits
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimSetSwitches(uint8_t u8State)
+{
+
+    u8Switches = u8State;
+}
+
+/*******************************************************************************
+ *  function :    vSimSetAdc
+ ******************************************************************************/
+/** \brief        Set the value an ADC channel converts
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8Channel ADC channel
+ *  \param[in]    u16Value  value, limited to 10 bit
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimSetAdc(uint8_t u8Channel, uint16_t u16Value)
+{
+
+    if (u8Channel < SIM_ADC_CHANNELS) {
+        u16Adc[u8Channel] = (u16Value > SIM_ADC_MAX) ? SIM_ADC_MAX : u16Value;
+    }
+}
+
+/*******************************************************************************
+ *  function :    u16SimAdcGet
+ ******************************************************************************/
+/** \brief        Value an ADC channel converts, for the DMA acquisition
+ *
+ *  \type         global
+ *
+ *  \param[in]    u8Channel ADC channel
+ *
+ *  \return       10 bit value, 0 for an unknown channel
+ *
+ ******************************************************************************/
+uint16_t u16SimAdcGet(uint8_t u8Channel)
+{
+
+    return (u8Channel < SIM_ADC_CHANNELS) ? u16Adc[u8Channel] : 0;
+}
+
+/*******************************************************************************
+ *  function :    u8SimGetLeds
+ ******************************************************************************/
+/** \brief        Current state of the LEDs
+ *
+ *  \type         global
+ *
+ *  \return       LED bits
+ *
+ ******************************************************************************/
+uint8_t u8SimGetLeds(void)
+{
+
+    return u8SimLedLatch;
+}
+
+/*******************************************************************************
+ *  function :    vSimButtonPoll
+ ******************************************************************************/
+/** \brief        Call the EXTI handlers with pending, unmasked lines
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimButtonPoll(void)
+{
+
+    uint32_t u32Pending = EXTI->PR & EXTI->IMR;
+
+    if ((u32Pending & EXTI_Line0) && u8SimNvicEnabled(EXTI0_IRQn) &&
+            (EXTI0_IRQHandler != NULL)) {
+        EXTI0_IRQHandler();
+    }
+    if ((u32Pending & SIM_EXTI9_5_LINES) && u8SimNvicEnabled(EXTI9_5_IRQn) &&
+            (EXTI9_5_IRQHandler != NULL)) {
+        EXTI9_5_IRQHandler();
+    }
+    if ((u32Pending & SIM_EXTI15_10_LINES) && u8SimNvicEnabled(EXTI15_10_IRQn) &&
+            (EXTI15_10_IRQHandler != NULL)) {
+        EXTI15_10_IRQHandler();
+    }
+}
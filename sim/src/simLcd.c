@@ -0,0 +1,590 @@
+/******************************************************************************/
+/** \file       simLcd.c
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the sGUI library. Everything is drawn
+ *              through the SSD1963 driver of simSsd1963.c with the windows
+ *              and pixel writes of the target library, so the bus cost is
+ *              the same. The glyph bitmaps are not available on the host,
+ *              characters are drawn as boxes of the font size. With
+ *              SIM_LCD_TRACE=1 all text output is printed to stderr as well.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Drawing through simSsd1963.c
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              LCD_SetTextColor
+ *              LCD_SetBackColor
+ *              LCD_SetFont
+ *              LCD_GetFont
+ *              LCD_GetLineCount
+ *              LCD_ClearLine
+ *              LCD_DisplayCharXY
+ *              LCD_DisplayCharLine
+ *              LCD_DisplayStringXY
+ *              LCD_DisplayStringLine
+ *              LCD_DisplayStringCenterLine
+ *              LCD_Log_AddMsg
+ *              LCD_Log_Update
+ *              LCD_DrawLine
+ *              LCD_DrawRect
+ *              LCD_DrawRectF
+ *              LCD_DrawCircle
+ *              LCD_DrawCircleF
+ *              LCD_BMP_DrawBitmap
+ *  functions  local:
+ *              vSimPixel
+ *              vSimTrace
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lcd.h>
+#include <sim.h>
+
+//----- Macros -----------------------------------------------------------------
+#define FONT(name, w, h)    FONT_T name = { (w), (h), 0, NULL }
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static void vSimPixel(int32_t s32X, int32_t s32Y, LCDCOLOR Color);
+static void vSimTrace(uint16_t x, uint16_t y, const char *pcText);
+
+//----- Data -------------------------------------------------------------------
+FONT(font_4x6, 4, 6);
+FONT(font_5x7, 5, 7);
+FONT(font_5x7W, 5, 7);
+FONT(font_5x8, 5, 8);
+FONT(font_6x9, 6, 9);
+FONT(font_6x10, 6, 10);
+FONT(font_6x12, 6, 12);
+FONT(font_6x13, 6, 13);
+FONT(font_6x13B, 6, 13);
+FONT(font_6x13O, 6, 13);
+FONT(font_7x13, 7, 13);
+FONT(font_7x13B, 7, 13);
+FONT(font_7x13O, 7, 13);
+FONT(font_7x14, 7, 14);
+FONT(font_7x14B, 7, 14);
+FONT(font_8x8, 8, 8);
+FONT(font_8x13, 8, 13);
+FONT(font_8x13B, 8, 13);
+FONT(font_8x13O, 8, 13);
+FONT(font_8x16, 8, 16);
+FONT(font_8x16B, 8, 16);
+FONT(font_9x15, 9, 15);
+FONT(font_9x15B, 9, 15);
+
+static FONT_T  *psFont = &font_8x16;
+static LCDCOLOR TextColor = GUI_COLOR_WHITE;
+static LCDCOLOR BackColor = GUI_COLOR_BLACK;
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    LCD_SetTextColor
+ ******************************************************************************/
+/** \brief        Set the text color
+ *
+ *  \type         global
+ *
+ *  \param[in]    Color     RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_SetTextColor(LCDCOLOR Color)
+{
+
+    TextColor = Color;
+}
+
+/*******************************************************************************
+ *  function :    LCD_SetBackColor
+ ******************************************************************************/
+/** \brief        Set the text background color
+ *
+ *  \type         global
+ *
+ *  \param[in]    Color     RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_SetBackColor(LCDCOLOR Color)
+{
+
+    BackColor = Color;
+}
+
+/*******************************************************************************
+ *  function :    LCD_SetFont
+ ******************************************************************************/
+/** \brief        Set the text font
+ *
+ *  \type         global
+ *
+ *  \param[in]    pFont     font
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_SetFont(FONT_T *pFont)
+{
+
+    psFont = pFont;
+}
+
+/*******************************************************************************
+ *  function :    LCD_GetFont
+ ******************************************************************************/
+/** \brief        Get the text font
+ *
+ *  \type         global
+ *
+ *  \return       current font
+ *
+ ******************************************************************************/
+FONT_T *LCD_GetFont(void)
+{
+
+    return psFont;
+}
+
+/*******************************************************************************
+ *  function :    LCD_GetLineCount
+ ******************************************************************************/
+/** \brief        Number of text lines with the current font
+ *
+ *  \type         global
+ *
+ *  \return       line count
+ *
+ ******************************************************************************/
+uint8_t LCD_GetLineCount(void)
+{
+
+    return (uint8_t) (LCD_VER_RESOLUTION / psFont->height);
+}
+
+/*******************************************************************************
+ *  function :    LCD_ClearLine
+ ******************************************************************************/
+/** \brief        Fill a text line with the background color
+ *
+ *  \type         global
+ *
+ *  \param[in]    Line      text line
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_ClearLine(uint8_t Line)
+{
+
+    uint16_t y = (uint16_t) (Line * psFont->height);
+
+    SSD1963_FillArea(SCRN_LEFT, y, SCRN_RIGHT, y + psFont->height - 1,
+                     BackColor);
+}
+
+/*******************************************************************************
+ *  function :    LCD_DisplayCharXY
+ ******************************************************************************/
+/** \brief        Draw one character cell as one window, like the target
+ *                library. Visible characters are drawn as a box in the
+ *                text color, inset by one pixel.
+ *
+ *  \type         global
+ *
+ *  \param[in]    x, y      upper left corner
+ *  \param[in]    Ascii     character
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_DisplayCharXY(uint16_t x, uint16_t y, char Ascii)
+{
+
+    uint16_t u16W = psFont->width;
+    uint16_t u16H = psFont->height;
+    uint16_t u16Col, u16Row;
+    uint8_t  u8Box = (uint8_t) (Ascii > ' ');
+
+    SSD1963_SetArea(x, y, x + u16W - 1, y + u16H - 1);
+    SSD1963_WriteCommand(CMD_WR_MEMSTART);
+    for (u16Row = 0; u16Row < u16H; u16Row++) {
+        for (u16Col = 0; u16Col < u16W; u16Col++) {
+            if (u8Box && (u16Col > 0) && (u16Col < u16W - 1) &&
+                (u16Row > 0) && (u16Row < u16H - 1)) {
+                SSD1963_WriteData(TextColor);
+            } else {
+                SSD1963_WriteData(BackColor);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    LCD_DisplayCharLine
+ ******************************************************************************/
+/** \brief        Draw one character at a text line and column
+ *
+ *  \type         global
+ *
+ *  \param[in]    Line      text line
+ *  \param[in]    Column    text column
+ *  \param[in]    Ascii     character
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_DisplayCharLine(uint8_t Line, uint8_t Column, char Ascii)
+{
+
+    LCD_DisplayCharXY((uint16_t) (Column * psFont->width),
+                      (uint16_t) (Line * psFont->height), Ascii);
+}
+
+/*******************************************************************************
+ *  function :    LCD_DisplayStringXY
+ ******************************************************************************/
+/** \brief        Draw a string, clipped at the right screen border
+ *
+ *  \type         global
+ *
+ *  \param[in]    x, y      upper left corner
+ *  \param[in]    ptr       string
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_DisplayStringXY(uint16_t x, uint16_t y, const char *ptr)
+{
+
+    vSimTrace(x, y, ptr);
+    while ((*ptr != '\0') && ((x + psFont->width) <= LCD_HOR_RESOLUTION)) {
+        LCD_DisplayCharXY(x, y, *ptr++);
+        x += psFont->width;
+    }
+}
+
+/*******************************************************************************
+ *  function :    LCD_DisplayStringLine
+ ******************************************************************************/
+/** \brief        Draw a string at the start of a text line
+ *
+ *  \type         global
+ *
+ *  \param[in]    Line      text line
+ *  \param[in]    ptr       string
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_DisplayStringLine(uint8_t Line, const char *ptr)
+{
+
+    LCD_DisplayStringXY(0, (uint16_t) (Line * psFont->height), ptr);
+}
+
+/*******************************************************************************
+ *  function :    LCD_DisplayStringCenterLine
+ ******************************************************************************/
+/** \brief        Draw a string centered on a text line
+ *
+ *  \type         global
+ *
+ *  \param[in]    Line      text line
+ *  \param[in]    ptr       string
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_DisplayStringCenterLine(uint8_t Line, const char *ptr)
+{
+
+    uint32_t u32Width = (uint32_t) strlen(ptr) * psFont->width;
+    uint16_t x = 0;
+
+    if (u32Width < LCD_HOR_RESOLUTION) {
+        x = (uint16_t) ((LCD_HOR_RESOLUTION - u32Width) / 2);
+    }
+    LCD_DisplayStringXY(x, (uint16_t) (Line * psFont->height), ptr);
+}
+
+/*******************************************************************************
+ *  function :    LCD_Log_AddMsg
+ ******************************************************************************/
+/** \brief        Add a message to the log console, traced only
+ *
+ *  \type         global
+ *
+ *  \param[in]    ptr       message
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_Log_AddMsg(char *ptr)
+{
+
+    vSimTrace(0, 0, ptr);
+}
+
+/*******************************************************************************
+ *  function :    LCD_Log_Update
+ ******************************************************************************/
+/** \brief        Redraw the log console, nothing to do on the host
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_Log_Update(void)
+{
+}
+
+/*******************************************************************************
+ *  function :    LCD_DrawLine
+ ******************************************************************************/
+/** \brief        Draw a line (Bresenham)
+ *
+ *  \type         global
+ *
+ *  \param[in]    Xstart, Ystart    start point
+ *  \param[in]    Xstop, Ystop      end point
+ *  \param[in]    Color             RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_DrawLine(uint16_t Xstart, uint16_t Ystart, uint16_t Xstop,
+                  uint16_t Ystop, LCDCOLOR Color)
+{
+
+    int32_t s32X = Xstart, s32Y = Ystart;
+    int32_t s32Dx = abs((int32_t) Xstop - Xstart);
+    int32_t s32Dy = -abs((int32_t) Ystop - Ystart);
+    int32_t s32Sx = (Xstart < Xstop) ? 1 : -1;
+    int32_t s32Sy = (Ystart < Ystop) ? 1 : -1;
+    int32_t s32Err = s32Dx + s32Dy;
+    int32_t s32E2;
+
+    for (;;) {
+        vSimPixel(s32X, s32Y, Color);
+        if ((s32X == Xstop) && (s32Y == Ystop)) {
+            break;
+        }
+        s32E2 = 2 * s32Err;             /* Both steps test the same error     */
+        if (s32E2 >= s32Dy) {
+            s32Err += s32Dy;
+            s32X += s32Sx;
+        }
+        if (s32E2 <= s32Dx) {
+            s32Err += s32Dx;
+            s32Y += s32Sy;
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    LCD_DrawRect
+ ******************************************************************************/
+/** \brief        Draw the outline of a rectangle
+ *
+ *  \type         global
+ *
+ *  \param[in]    Xpos, Ypos        upper left corner
+ *  \param[in]    width, height     size
+ *  \param[in]    Color             RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_DrawRect(uint16_t Xpos, uint16_t Ypos, uint16_t width,
+                  uint16_t height, LCDCOLOR Color)
+{
+
+    LCD_DrawLine(Xpos, Ypos, Xpos + width, Ypos, Color);
+    LCD_DrawLine(Xpos, Ypos + height, Xpos + width, Ypos + height, Color);
+    LCD_DrawLine(Xpos, Ypos, Xpos, Ypos + height, Color);
+    LCD_DrawLine(Xpos + width, Ypos, Xpos + width, Ypos + height, Color);
+}
+
+/*******************************************************************************
+ *  function :    LCD_DrawRectF
+ ******************************************************************************/
+/** \brief        Draw a filled rectangle
+ *
+ *  \type         global
+ *
+ *  \param[in]    Xpos, Ypos        upper left corner
+ *  \param[in]    width, height     size
+ *  \param[in]    Color             RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_DrawRectF(uint16_t Xpos, uint16_t Ypos, uint16_t width,
+                   uint16_t height, LCDCOLOR Color)
+{
+
+    SSD1963_FillArea(Xpos, Ypos, Xpos + width, Ypos + height, Color);
+}
+
+/*******************************************************************************
+ *  function :    LCD_DrawCircle
+ ******************************************************************************/
+/** \brief        Draw the outline of a circle (midpoint algorithm)
+ *
+ *  \type         global
+ *
+ *  \param[in]    Xpos, Ypos        center
+ *  \param[in]    Radius            radius
+ *  \param[in]    Color             RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_DrawCircle(uint16_t Xpos, uint16_t Ypos, uint16_t Radius,
+                    LCDCOLOR Color)
+{
+
+    int32_t s32X = Radius, s32Y = 0;
+    int32_t s32Err = 1 - (int32_t) Radius;
+
+    while (s32X >= s32Y) {
+        vSimPixel(Xpos + s32X, Ypos + s32Y, Color);
+        vSimPixel(Xpos + s32Y, Ypos + s32X, Color);
+        vSimPixel(Xpos - s32Y, Ypos + s32X, Color);
+        vSimPixel(Xpos - s32X, Ypos + s32Y, Color);
+        vSimPixel(Xpos - s32X, Ypos - s32Y, Color);
+        vSimPixel(Xpos - s32Y, Ypos - s32X, Color);
+        vSimPixel(Xpos + s32Y, Ypos - s32X, Color);
+        vSimPixel(Xpos + s32X, Ypos - s32Y, Color);
+        s32Y++;
+        if (s32Err < 0) {
+            s32Err += (2 * s32Y) + 1;
+        } else {
+            s32X--;
+            s32Err += (2 * (s32Y - s32X)) + 1;
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    LCD_DrawCircleF
+ ******************************************************************************/
+/** \brief        Draw a filled circle
+ *
+ *  \type         global
+ *
+ *  \param[in]    Xpos, Ypos        center
+ *  \param[in]    Radius            radius
+ *  \param[in]    Color             RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void LCD_DrawCircleF(uint8_t Xpos, uint16_t Ypos, uint16_t Radius,
+                     LCDCOLOR Color)
+{
+
+    int32_t s32X, s32Y;
+    int32_t s32R2 = (int32_t) Radius * Radius;
+
+    for (s32Y = -(int32_t) Radius; s32Y <= (int32_t) Radius; s32Y++) {
+        for (s32X = -(int32_t) Radius; s32X <= (int32_t) Radius; s32X++) {
+            if (((s32X * s32X) + (s32Y * s32Y)) <= s32R2) {
+                vSimPixel(Xpos + s32X, Ypos + s32Y, Color);
+            }
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    LCD_BMP_DrawBitmap
+ ******************************************************************************/
+/** \brief        Draw a bitmap file, there is no file system on the host
+ *
+ *  \type         global
+ *
+ *  \param[in]    filename          BMP file
+ *  \param[in]    Xpos, Ypos        upper left corner
+ *
+ *  \return       BMP_FILE_NOT_SUPPORTED
+ *
+ ******************************************************************************/
+BMP_STATUS LCD_BMP_DrawBitmap(const char *filename, uint16_t Xpos,
+                              uint16_t Ypos)
+{
+
+    (void) Xpos;
+    (void) Ypos;
+    vSimTrace(0, 0, filename);
+    return BMP_FILE_NOT_SUPPORTED;
+}
+
+/*******************************************************************************
+ *  function :    vSimPixel
+ ******************************************************************************/
+/** \brief        Write one pixel, clipped to the screen, through a window
+ *                of one pixel like LCD_WritePixel
+ *
+ *  \type         local
+ *
+ *  \param[in]    s32X, s32Y        position
+ *  \param[in]    Color             RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimPixel(int32_t s32X, int32_t s32Y, LCDCOLOR Color)
+{
+
+    if ((s32X >= 0) && (s32X < LCD_HOR_RESOLUTION) &&
+        (s32Y >= 0) && (s32Y < LCD_VER_RESOLUTION)) {
+        SSD1963_WritePixel((uint16_t) s32X, (uint16_t) s32Y, Color);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimTrace
+ ******************************************************************************/
+/** \brief        Print text output to stderr if SIM_LCD_TRACE is set
+ *
+ *  \type         local
+ *
+ *  \param[in]    x, y      position
+ *  \param[in]    pcText    text
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimTrace(uint16_t x, uint16_t y, const char *pcText)
+{
+
+    static int8_t s8Trace = -1;
+    const char *pcEnv;
+
+    if (s8Trace < 0) {
+        pcEnv = getenv("SIM_LCD_TRACE");
+        s8Trace = (int8_t) ((pcEnv != NULL) && (atoi(pcEnv) != 0));
+    }
+    if (s8Trace) {
+        fprintf(stderr, "lcd %3u,%3u: %s\n", x, y, pcText);
+    }
+}
@@ -0,0 +1,209 @@
+/******************************************************************************/
+/** \file       simScript.c
+ *******************************************************************************
+ *
+ *  \brief      Timed board inputs for the host simulation. The file named by
+ *              SIM_SCRIPT holds one step per line:
+ *
+ *                # tick  command   arguments
+ *                  1000  buttons   0x01        set the buttons T0..T3
+ *                  1300  buttons   0
+ *                  1302  button    2 1     press T2 only, 0 releases it
+ *                     0  switches  0xA5        set the switches S0..S7
+ *                   500  adc       0 512       set ADC channel 0
+ *                  2000  leds                  print the LEDs to stderr
+ *                  2500  lcd                   end a LCD frame
+ *                        repeat    4000        restart every 4000 ticks
+ *
+ *              The steps are applied in the tick interrupt, before the hook
+ *              of the harness.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Single button edges
+ *               \li id101010, 17.10.2026, LCD frames
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              vSimScriptTick
+ *  functions  local:
+ *              vSimScriptLoad
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sim.h>
+#include "simInternal.h"
+
+//----- Macros -----------------------------------------------------------------
+#define SIM_SCRIPT_STEPS    ( 256 )     /* Longest script                     */
+
+//----- Data types -------------------------------------------------------------
+typedef enum {
+    SCRIPT_BUTTONS,
+    SCRIPT_BUTTON,
+    SCRIPT_SWITCHES,
+    SCRIPT_ADC,
+    SCRIPT_LEDS,
+    SCRIPT_LCD
+} ScriptCommand;
+
+typedef struct {
+    uint32_t      u32Tick;              /* Tick of the step within the period */
+    ScriptCommand eCommand;
+    uint16_t      u16Arg1;
+    uint16_t      u16Arg2;
+} ScriptStep;
+
+//----- Function prototypes ----------------------------------------------------
+static void vSimScriptLoad(void) __attribute__((constructor));
+
+//----- Data -------------------------------------------------------------------
+static ScriptStep sSteps[SIM_SCRIPT_STEPS];
+static uint32_t   u32Steps;
+static uint32_t   u32Repeat;            /* 0: run the script once             */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    vSimScriptTick
+ ******************************************************************************/
+/** \brief        Apply the steps due at a tick
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Tick   current tick
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimScriptTick(uint32_t u32Tick)
+{
+
+    uint32_t u32Step;
+    char cLine[32];
+    int iLen;
+
+    if (u32Repeat != 0) {
+        u32Tick %= u32Repeat;
+    }
+    for (u32Step = 0; u32Step < u32Steps; u32Step++) {
+        if (sSteps[u32Step].u32Tick != u32Tick) {
+            continue;
+        }
+        switch (sSteps[u32Step].eCommand) {
+        case SCRIPT_BUTTONS:
+            vSimSetButtons((uint8_t) sSteps[u32Step].u16Arg1);
+            break;
+        case SCRIPT_BUTTON:
+            vSimSetButton((uint8_t) sSteps[u32Step].u16Arg1,
+                          (uint8_t) sSteps[u32Step].u16Arg2);
+            break;
+        case SCRIPT_SWITCHES:
+            vSimSetSwitches((uint8_t) sSteps[u32Step].u16Arg1);
+            break;
+        case SCRIPT_ADC:
+            vSimSetAdc((uint8_t) sSteps[u32Step].u16Arg1,
+                       sSteps[u32Step].u16Arg2);
+            break;
+        case SCRIPT_LEDS:
+            /* Interrupt context: no stdio */
+            iLen = snprintf(cLine, sizeof(cLine), "leds 0x%02X\n",
+                            (unsigned) u8SimGetLeds());
+            if (write(STDERR_FILENO, cLine, (size_t) iLen) < 0) {
+                /* Nothing to do */
+            }
+            break;
+        case SCRIPT_LCD:
+            vSimLcdFrameDue(u32SimGetTicks());
+            break;
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimScriptLoad
+ ******************************************************************************/
+/** \brief        Read the script named by SIM_SCRIPT before main runs
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimScriptLoad(void)
+{
+
+    const char *pcName = getenv("SIM_SCRIPT");
+    char cLine[128];
+    char cCommand[16];
+    unsigned long ulTick, ulArg1, ulArg2;
+    uint32_t u32Line = 0;
+    FILE *pfScript;
+    ScriptStep *psStep;
+    int iFields;
+
+    if (pcName == NULL) {
+        return;
+    }
+    pfScript = fopen(pcName, "r");
+    if (pfScript == NULL) {
+        fprintf(stderr, "sim: cannot open script %s\n", pcName);
+        exit(1);
+    }
+
+    while (fgets(cLine, sizeof(cLine), pfScript) != NULL) {
+        u32Line++;
+        if ((cLine[strspn(cLine, " \t\r\n")] == '\0') ||
+                (cLine[strspn(cLine, " \t")] == '#')) {
+            continue;
+        }
+        if (sscanf(cLine, " repeat %lu", &ulTick) == 1) {
+            u32Repeat = (uint32_t) ulTick;
+            continue;
+        }
+        ulArg1 = 0;
+        ulArg2 = 0;
+        iFields = sscanf(cLine, " %li %15s %li %li", (long *) &ulTick, cCommand,
+                         (long *) &ulArg1, (long *) &ulArg2);
+        if ((iFields < 2) || (u32Steps >= SIM_SCRIPT_STEPS)) {
+            fprintf(stderr, "sim: %s:%u: invalid step\n", pcName,
+                    (unsigned) u32Line);
+            exit(1);
+        }
+
+        psStep = &sSteps[u32Steps];
+        psStep->u32Tick = (uint32_t) ulTick;
+        psStep->u16Arg1 = (uint16_t) ulArg1;
+        psStep->u16Arg2 = (uint16_t) ulArg2;
+        if (strcmp(cCommand, "buttons") == 0) {
+            psStep->eCommand = SCRIPT_BUTTONS;
+        } else if (strcmp(cCommand, "button") == 0) {
+            psStep->eCommand = SCRIPT_BUTTON;
+        } else if (strcmp(cCommand, "switches") == 0) {
+            psStep->eCommand = SCRIPT_SWITCHES;
+        } else if (strcmp(cCommand, "adc") == 0) {
+            psStep->eCommand = SCRIPT_ADC;
+        } else if (strcmp(cCommand, "leds") == 0) {
+            psStep->eCommand = SCRIPT_LEDS;
+        } else if (strcmp(cCommand, "lcd") == 0) {
+            psStep->eCommand = SCRIPT_LCD;
+        } else {
+            fprintf(stderr, "sim: %s:%u: unknown command %s\n", pcName,
+                    (unsigned) u32Line, cCommand);
+            exit(1);
+        }
+        u32Steps++;
+    }
+    fclose(pfScript);
+}
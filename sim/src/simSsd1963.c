@@ -0,0 +1,643 @@
+/******************************************************************************/
+/** \file       simSsd1963.c
+ *******************************************************************************
+ *
+ *  \brief      SSD1963 display controller of the host simulation. The
+ *              command and data writes of the driver are decoded like the
+ *              controller does: CMD_SET_COLUMN and CMD_SET_PAGE take the
+ *              window as four bytes each, after CMD_WR_MEMSTART every data
+ *              write is a pixel, the address runs row by row through the
+ *              window and wraps at its end. The frame memory is a 320 x 240
+ *              RGB565 framebuffer.
+ *              Every bus access is counted, so the LCD cost of a screen can
+ *              be measured without the board. A frame ends on request of the
+ *              harness, every SIM_LCD_FRAME ticks or at a "lcd" step of the
+ *              script; its counts are printed to stderr and with
+ *              SIM_LCD_PPM the screen is written as PPM image. The name is
+ *              a printf pattern with the tick, e.g. "shot-%06u.ppm", without
+ *              a conversion the file holds the last frame. The last frame
+ *              ends with the simulation.
+ *              A frame due in the tick interrupt is closed at the next bus
+ *              access, files are not written in interrupt context.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              SSD1963_LLD_Init
+ *              SSD1963_WriteCommand
+ *              SSD1963_WriteData
+ *              SSD1963_ReadData
+ *              SSD1963_Init
+ *              SSD1963_SetArea
+ *              SSD1963_WritePixel
+ *              SSD1963_ReadPixel
+ *              SSD1963_FillArea
+ *              SSD1963_WriteArea
+ *              pu16SimGetFrame
+ *              vSimLcdEndFrame
+ *              u8SimLcdSnapshot
+ *              vSimLcdTick
+ *              vSimLcdFrameDue
+ *  functions  local:
+ *              vSimLcdInit
+ *              vSimLcdReport
+ *              vSimLcdPending
+ *              vSimLcdClose
+ *              vSimLcdFinish
+ *              vSimLcdNext
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <lcd.h>
+#include <sim.h>
+#include "simInternal.h"
+
+//----- Macros -----------------------------------------------------------------
+#define SIM_LCD_WIDTH       ( LCD_HOR_RESOLUTION )
+#define SIM_LCD_HEIGHT      ( LCD_VER_RESOLUTION )
+#define SIM_LCD_NAME        ( 256 )     /* Longest snapshot file name         */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+static void vSimLcdInit(void) __attribute__((constructor));
+static void vSimLcdReport(void);
+static void vSimLcdPending(void);
+static void vSimLcdClose(uint32_t u32Tick);
+static void vSimLcdFinish(uint32_t u32Tick, SimLcdStats *psStats);
+static void vSimLcdNext(void);
+
+//----- Data -------------------------------------------------------------------
+static uint16_t          u16Frame[SIM_LCD_HEIGHT * SIM_LCD_WIDTH];
+static uint16_t          u16Command;    /* Last command                       */
+static uint8_t           u8Param;       /* Data writes since the command      */
+static uint16_t          u16Param[4];   /* Window parameter bytes             */
+static uint16_t          u16Column[2];  /* Window, start and end inclusive    */
+static uint16_t          u16Page[2];
+static uint16_t          u16X, u16Y;    /* Frame memory address               */
+static uint8_t           u8Moved;       /* Window set since the last start    */
+static SimLcdStats       sStats;        /* Current frame                      */
+static uint32_t          u32Frames;     /* Frames ended                       */
+static uint32_t          u32Period;     /* SIM_LCD_FRAME, 0 if not set        */
+static const char       *pcPattern;     /* SIM_LCD_PPM, NULL if not set       */
+static uint8_t           u8Report;      /* Frames are printed                 */
+static volatile uint32_t u32Due;        /* Tick of a frame end, 0 if none     */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    SSD1963_LLD_Init
+ ******************************************************************************/
+/** \brief        Reset the bus state, there is no FSMC to set up
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void SSD1963_LLD_Init(void)
+{
+
+    u16Command = CMD_NOP;
+    u8Param = 0;
+}
+
+/*******************************************************************************
+ *  function :    SSD1963_WriteCommand
+ ******************************************************************************/
+/** \brief        Command write. A memory start moves the address to the
+ *                upper left corner of the window.
+ *
+ *  \type         global
+ *
+ *  \param[in]    cmd       command code
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void SSD1963_WriteCommand(uint16_t cmd)
+{
+
+    vSimLcdPending();
+    sStats.u32Writes++;
+    u16Command = cmd;
+    u8Param = 0;
+
+    if ((cmd == CMD_WR_MEMSTART) || (cmd == CMD_RD_MEMSTART)) {
+        u16X = u16Column[0];
+        u16Y = u16Page[0];
+        if (u8Moved) {
+            sStats.u32Windows++;
+            u8Moved = 0;
+        }
+    }
+}
+
+/*******************************************************************************
+ *  function :    SSD1963_WriteData
+ ******************************************************************************/
+/** \brief        Data write: a window parameter or a pixel, depending on the
+ *                last command. Parameters of other commands are ignored.
+ *
+ *  \type         global
+ *
+ *  \param[in]    data      parameter byte or RGB565 pixel
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void SSD1963_WriteData(uint16_t data)
+{
+
+    vSimLcdPending();
+    sStats.u32Writes++;
+
+    switch (u16Command) {
+    case CMD_SET_COLUMN:
+    case CMD_SET_PAGE:
+        if (u8Param < 4) {
+            u16Param[u8Param++] = data & 0xFF;
+        }
+        if (u8Param == 4) {
+            uint16_t *pu16Window = (u16Command == CMD_SET_COLUMN) ?
+                                   u16Column : u16Page;
+            pu16Window[0] = (uint16_t) ((u16Param[0] << 8) | u16Param[1]);
+            pu16Window[1] = (uint16_t) ((u16Param[2] << 8) | u16Param[3]);
+            u8Moved = 1;
+        }
+        break;
+    case CMD_WR_MEMSTART:
+    case CMD_WR_MEM_AUTO:
+        if ((u16X < SIM_LCD_WIDTH) && (u16Y < SIM_LCD_HEIGHT)) {
+            u16Frame[(u16Y * SIM_LCD_WIDTH) + u16X] = data;
+        }
+        sStats.u32Pixels++;
+        vSimLcdNext();
+        break;
+    default:
+        break;
+    }
+}
+
+/*******************************************************************************
+ *  function :    SSD1963_ReadData
+ ******************************************************************************/
+/** \brief        Data read, a pixel after CMD_RD_MEMSTART
+ *
+ *  \type         global
+ *
+ *  \return       RGB565 pixel, 0 after other commands
+ *
+ ******************************************************************************/
+uint16_t SSD1963_ReadData(void)
+{
+
+    uint16_t u16Pixel = 0;
+
+    vSimLcdPending();
+    sStats.u32Reads++;
+
+    if ((u16Command == CMD_RD_MEMSTART) || (u16Command == CMD_RD_MEM_AUTO)) {
+        if ((u16X < SIM_LCD_WIDTH) && (u16Y < SIM_LCD_HEIGHT)) {
+            u16Pixel = u16Frame[(u16Y * SIM_LCD_WIDTH) + u16X];
+        }
+        vSimLcdNext();
+    }
+    return u16Pixel;
+}
+
+/*******************************************************************************
+ *  function :    SSD1963_Init
+ ******************************************************************************/
+/** \brief        Initialize the display, the screen is cleared. The set-up
+ *                sequence of the panel is not emulated, the counters start
+ *                at 0.
+ *
+ *  \type         global
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void SSD1963_Init(void)
+{
+
+    SSD1963_LLD_Init();
+    memset(u16Frame, 0, sizeof(u16Frame));
+    u16Column[0] = 0;
+    u16Column[1] = SIM_LCD_WIDTH - 1;
+    u16Page[0] = 0;
+    u16Page[1] = SIM_LCD_HEIGHT - 1;
+    u8Moved = 0;
+    memset(&sStats, 0, sizeof(sStats));
+}
+
+/*******************************************************************************
+ *  function :    SSD1963_SetArea
+ ******************************************************************************/
+/** \brief        Set the window, corners are inclusive. 10 bus writes like
+ *                the target driver.
+ *
+ *  \type         global
+ *
+ *  \param[in]    x1, y1    upper left corner
+ *  \param[in]    x2, y2    lower right corner
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void SSD1963_SetArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+
+    SSD1963_WriteCommand(CMD_SET_COLUMN);
+    SSD1963_WriteData(x1 >> 8);
+    SSD1963_WriteData(x1 & 0xFF);
+    SSD1963_WriteData(x2 >> 8);
+    SSD1963_WriteData(x2 & 0xFF);
+
+    SSD1963_WriteCommand(CMD_SET_PAGE);
+    SSD1963_WriteData(y1 >> 8);
+    SSD1963_WriteData(y1 & 0xFF);
+    SSD1963_WriteData(y2 >> 8);
+    SSD1963_WriteData(y2 & 0xFF);
+}
+
+/*******************************************************************************
+ *  function :    SSD1963_WritePixel
+ ******************************************************************************/
+/** \brief        Write one pixel through a window of one pixel
+ *
+ *  \type         global
+ *
+ *  \param[in]    x, y      position
+ *  \param[in]    color     RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void SSD1963_WritePixel(uint16_t x, uint16_t y, uint16_t color)
+{
+
+    SSD1963_SetArea(x, y, x, y);
+    SSD1963_WriteCommand(CMD_WR_MEMSTART);
+    SSD1963_WriteData(color);
+}
+
+/*******************************************************************************
+ *  function :    SSD1963_ReadPixel
+ ******************************************************************************/
+/** \brief        Read one pixel through a window of one pixel
+ *
+ *  \type         global
+ *
+ *  \param[in]    x, y      position
+ *
+ *  \return       RGB565 color, 0 outside of the screen
+ *
+ ******************************************************************************/
+uint16_t SSD1963_ReadPixel(uint16_t x, uint16_t y)
+{
+
+    SSD1963_SetArea(x, y, x, y);
+    SSD1963_WriteCommand(CMD_RD_MEMSTART);
+    return SSD1963_ReadData();
+}
+
+/*******************************************************************************
+ *  function :    SSD1963_FillArea
+ ******************************************************************************/
+/** \brief        Fill a window, corners are inclusive
+ *
+ *  \type         global
+ *
+ *  \param[in]    x1, y1    upper left corner
+ *  \param[in]    x2, y2    lower right corner
+ *  \param[in]    color     RGB565 color
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void SSD1963_FillArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                      uint16_t color)
+{
+
+    uint32_t u32Pixels = (uint32_t) (x2 - x1 + 1) * (y2 - y1 + 1);
+
+    if ((x1 > x2) || (y1 > y2)) {
+        return;
+    }
+    SSD1963_SetArea(x1, y1, x2, y2);
+    SSD1963_WriteCommand(CMD_WR_MEMSTART);
+    while (u32Pixels-- != 0) {
+        SSD1963_WriteData(color);
+    }
+}
+
+/*******************************************************************************
+ *  function :    SSD1963_WriteArea
+ ******************************************************************************/
+/** \brief        Write a window row by row, corners are inclusive
+ *
+ *  \type         global
+ *
+ *  \param[in]    x1, y1    upper left corner
+ *  \param[in]    x2, y2    lower right corner
+ *  \param[in]    pData     RGB565 pixels
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void SSD1963_WriteArea(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                       uint16_t *pData)
+{
+
+    uint32_t u32Pixels = (uint32_t) (x2 - x1 + 1) * (y2 - y1 + 1);
+
+    if ((x1 > x2) || (y1 > y2)) {
+        return;
+    }
+    SSD1963_SetArea(x1, y1, x2, y2);
+    SSD1963_WriteCommand(CMD_WR_MEMSTART);
+    while (u32Pixels-- != 0) {
+        SSD1963_WriteData(*pData++);
+    }
+}
+
+/*******************************************************************************
+ *  function :    pu16SimGetFrame
+ ******************************************************************************/
+/** \brief        Frame memory of the emulated controller, row by row
+ *
+ *  \type         global
+ *
+ *  \return       320 x 240 RGB565 pixels
+ *
+ ******************************************************************************/
+const uint16_t *pu16SimGetFrame(void)
+{
+
+    return u16Frame;
+}
+
+/*******************************************************************************
+ *  function :    vSimLcdEndFrame
+ ******************************************************************************/
+/** \brief        End the current frame: take its counts and write the
+ *                snapshot if SIM_LCD_PPM is set. Not in interrupt context.
+ *
+ *  \type         global
+ *
+ *  \param[out]   psStats   bus accesses of the frame, may be NULL
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimLcdEndFrame(SimLcdStats *psStats)
+{
+
+    vSimLcdPending();
+    vSimLcdFinish(u32SimGetTicks(), psStats);
+}
+
+/*******************************************************************************
+ *  function :    u8SimLcdSnapshot
+ ******************************************************************************/
+/** \brief        Write the screen as binary PPM (P6), the RGB565 pixels are
+ *                expanded to 8 bits per colour. Not in interrupt context.
+ *
+ *  \type         global
+ *
+ *  \param[in]    pcFile    file name
+ *
+ *  \return       0 on success, 1 if the file cannot be written
+ *
+ ******************************************************************************/
+uint8_t u8SimLcdSnapshot(const char *pcFile)
+{
+
+    static uint8_t u8Row[SIM_LCD_WIDTH * 3];
+    FILE *pfImage;
+    uint16_t u16Pixel;
+    uint32_t u32X, u32Y;
+    uint8_t u8Error = 0;
+
+    pfImage = fopen(pcFile, "wb");
+    if (pfImage == NULL) {
+        fprintf(stderr, "sim: cannot write %s\n", pcFile);
+        return 1;
+    }
+    fprintf(pfImage, "P6\n%u %u\n255\n", (unsigned) SIM_LCD_WIDTH,
+            (unsigned) SIM_LCD_HEIGHT);
+    for (u32Y = 0; u32Y < SIM_LCD_HEIGHT; u32Y++) {
+        for (u32X = 0; u32X < SIM_LCD_WIDTH; u32X++) {
+            u16Pixel = u16Frame[(u32Y * SIM_LCD_WIDTH) + u32X];
+            u8Row[(u32X * 3) + 0] = (uint8_t) (((u16Pixel >> 11) & 0x1F) * 255 / 31);
+            u8Row[(u32X * 3) + 1] = (uint8_t) (((u16Pixel >> 5) & 0x3F) * 255 / 63);
+            u8Row[(u32X * 3) + 2] = (uint8_t) ((u16Pixel & 0x1F) * 255 / 31);
+        }
+        if (fwrite(u8Row, sizeof(u8Row), 1, pfImage) != 1) {
+            u8Error = 1;
+        }
+    }
+    if ((fclose(pfImage) != 0) || u8Error) {
+        fprintf(stderr, "sim: cannot write %s\n", pcFile);
+        return 1;
+    }
+    return 0;
+}
+
+/*******************************************************************************
+ *  function :    vSimLcdTick
+ ******************************************************************************/
+/** \brief        End a frame every SIM_LCD_FRAME ticks. Interrupt context.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Tick   current tick
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimLcdTick(uint32_t u32Tick)
+{
+
+    if ((u32Period != 0) && ((u32Tick % u32Period) == 0)) {
+        vSimLcdFrameDue(u32Tick);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimLcdFrameDue
+ ******************************************************************************/
+/** \brief        Mark the end of a frame, it is closed at the next bus
+ *                access. Interrupt context.
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Tick   current tick
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void vSimLcdFrameDue(uint32_t u32Tick)
+{
+
+    u8Report = 1;
+    u32Due = u32Tick;
+}
+
+/*******************************************************************************
+ *  function :    vSimLcdInit
+ ******************************************************************************/
+/** \brief        Read the configuration before main
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimLcdInit(void)
+{
+
+    const char *pcEnv;
+
+    if ((pcEnv = getenv("SIM_LCD_FRAME")) != NULL) {
+        u32Period = (uint32_t) strtoul(pcEnv, NULL, 0);
+        u8Report = (uint8_t) (u32Period != 0);
+    }
+    if ((pcEnv = getenv("SIM_LCD_PPM")) != NULL) {
+        pcPattern = pcEnv;
+        u8Report = 1;
+    }
+    SSD1963_Init();
+    atexit(vSimLcdReport);
+}
+
+/*******************************************************************************
+ *  function :    vSimLcdReport
+ ******************************************************************************/
+/** \brief        End the last frame when the simulation ends
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimLcdReport(void)
+{
+
+    if (u8Report) {
+        vSimLcdPending();
+        vSimLcdClose(u32SimGetTicks());
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimLcdPending
+ ******************************************************************************/
+/** \brief        Close a frame which became due in the tick interrupt
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimLcdPending(void)
+{
+
+    uint32_t u32Tick = u32Due;
+
+    if (u32Tick != 0) {
+        u32Due = 0;
+        vSimLcdClose(u32Tick);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimLcdClose
+ ******************************************************************************/
+/** \brief        Print the counts of a frame with bus traffic and end it
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32Tick   tick at which the frame ended
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimLcdClose(uint32_t u32Tick)
+{
+
+    SimLcdStats sFrame;
+
+    if ((sStats.u32Writes == 0) && (sStats.u32Reads == 0)) {
+        return;
+    }
+    vSimLcdFinish(u32Tick, &sFrame);
+    fprintf(stderr, "lcd frame %u tick %u: %u writes, %u windows, %u pixels, "
+            "%u reads\n", (unsigned) u32Frames, (unsigned) u32Tick,
+            (unsigned) sFrame.u32Writes, (unsigned) sFrame.u32Windows,
+            (unsigned) sFrame.u32Pixels, (unsigned) sFrame.u32Reads);
+}
+
+/*******************************************************************************
+ *  function :    vSimLcdFinish
+ ******************************************************************************/
+/** \brief        Take the counts of the frame, write the snapshot and start
+ *                the next frame
+ *
+ *  \type         local
+ *
+ *  \param[in]    u32Tick   tick at which the frame ended
+ *  \param[out]   psStats   bus accesses of the frame, may be NULL
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimLcdFinish(uint32_t u32Tick, SimLcdStats *psStats)
+{
+
+    char cName[SIM_LCD_NAME];
+
+    if (psStats != NULL) {
+        *psStats = sStats;
+    }
+    memset(&sStats, 0, sizeof(sStats));
+    u32Frames++;
+    if (pcPattern != NULL) {
+        snprintf(cName, sizeof(cName), pcPattern, (unsigned) u32Tick);
+        (void) u8SimLcdSnapshot(cName);
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimLcdNext
+ ******************************************************************************/
+/** \brief        Advance the frame memory address within the window
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimLcdNext(void)
+{
+
+    if (u16X < u16Column[1]) {
+        u16X++;
+        return;
+    }
+    u16X = u16Column[0];
+    u16Y = (u16Y < u16Page[1]) ? (u16Y + 1) : u16Page[0];
+}
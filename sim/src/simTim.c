@@ -0,0 +1,270 @@
+/******************************************************************************/
+/** \file       simTim.c
+ *******************************************************************************
+ *
+ *  \brief      Host stand-in for the general purpose timers. A running timer
+ *              counts up from the virtual time at the APB1 timer clock
+ *              (SystemCoreClock / 2) divided by the prescaler and wraps at
+ *              the auto-reload value. Update interrupts are not simulated,
+ *              the update event as trigger output is used by simAdc.c.
+ *              The interrupt enable and flag bits are only stored.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, Trigger output, APB2 and AHB1 clocks
+ *               \li id101010, 17.10.2026, Interrupt enable and flags
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              psSimTim
+ *              TIM_TimeBaseStructInit
+ *              TIM_TimeBaseInit
+ *              TIM_Cmd
+ *              TIM_SelectOutputTrigger
+ *              TIM_ITConfig
+ *              TIM_ClearITPendingBit
+ *              RCC_APB1PeriphClockCmd
+ *              RCC_APB2PeriphClockCmd
+ *              RCC_AHB1PeriphClockCmd
+ *  functions  local:
+ *              .
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#include <stm32f4xx.h>
+#include <sim.h>
+
+//----- Macros -----------------------------------------------------------------
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+
+//----- Data -------------------------------------------------------------------
+TIM_TypeDef sSimTim[SIM_TIMERS];
+
+static uint64_t u64StartNs[SIM_TIMERS];     /* Virtual time of CNT = 0        */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    psSimTim
+ ******************************************************************************/
+/** \brief        Access to a timer, CNT is updated from the virtual time
+ *
+ *  \type         global
+ *
+ *  \param[in]    psTim     timer stand-in
+ *
+ *  \return       psTim
+ *
+ ******************************************************************************/
+TIM_TypeDef *psSimTim(TIM_TypeDef *psTim)
+{
+
+    uint32_t u32Index = (uint32_t) (psTim - sSimTim);
+    uint64_t u64Counts;
+
+    if (psTim->CR1 & TIM_CR1_CEN) {
+        u64Counts = ((u64SimGetTimeNs() - u64StartNs[u32Index]) *
+                     (SystemCoreClock / 2U / 1000U)) /
+                    ((uint64_t) (psTim->PSC + 1U) * 1000000U);
+        psTim->CNT = (uint32_t) (u64Counts % ((uint64_t) psTim->ARR + 1U));
+    }
+    return psTim;
+}
+
+/*******************************************************************************
+ *  function :    TIM_TimeBaseStructInit
+ ******************************************************************************/
+/** \brief        Default time base: no prescaler, full 32 bit period
+ *
+ *  \type         global
+ *
+ *  \param[out]   psInit    time base settings
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void TIM_TimeBaseStructInit(TIM_TimeBaseInitTypeDef *psInit)
+{
+
+    psInit->TIM_Prescaler = 0;
+    psInit->TIM_CounterMode = TIM_CounterMode_Up;
+    psInit->TIM_Period = 0xFFFFFFFFU;
+    psInit->TIM_ClockDivision = TIM_CKD_DIV1;
+    psInit->TIM_RepetitionCounter = 0;
+}
+
+/*******************************************************************************
+ *  function :    TIM_TimeBaseInit
+ ******************************************************************************/
+/** \brief        Set prescaler and period, the counter restarts at 0
+ *
+ *  \type         global
+ *
+ *  \param[in]    psTim     timer stand-in
+ *  \param[in]    psInit    time base settings
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void TIM_TimeBaseInit(TIM_TypeDef *psTim, TIM_TimeBaseInitTypeDef *psInit)
+{
+
+    psTim->PSC = psInit->TIM_Prescaler;
+    psTim->ARR = psInit->TIM_Period;
+    psTim->CNT = 0;
+    u64StartNs[psTim - sSimTim] = u64SimGetTimeNs();
+}
+
+/*******************************************************************************
+ *  function :    TIM_Cmd
+ ******************************************************************************/
+/** \brief        Start or stop a timer
+ *
+ *  \type         global
+ *
+ *  \param[in]    psTim     timer stand-in
+ *  \param[in]    NewState  ENABLE or DISABLE
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void TIM_Cmd(TIM_TypeDef *psTim, FunctionalState NewState)
+{
+
+    if (NewState != DISABLE) {
+        psTim->CR1 |= TIM_CR1_CEN;
+    } else {
+        psTim->CR1 &= (uint16_t) ~TIM_CR1_CEN;
+    }
+}
+
+/*******************************************************************************
+ *  function :    TIM_SelectOutputTrigger
+ ******************************************************************************/
+/** \brief        Select the trigger output (TRGO) of a timer
+ *
+ *  \type         global
+ *
+ *  \param[in]    psTim     timer stand-in
+ *  \param[in]    u16Source TIM_TRGOSource_xxx
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void TIM_SelectOutputTrigger(TIM_TypeDef *psTim, uint16_t u16Source)
+{
+
+    psTim->CR2 = (uint16_t) ((psTim->CR2 & ~TIM_CR2_MMS) | u16Source);
+}
+
+/*******************************************************************************
+ *  function :    TIM_ITConfig
+ ******************************************************************************/
+/** \brief        Enable timer interrupts, stored only
+ *
+ *  \type         global
+ *
+ *  \param[in]    psTim     timer stand-in
+ *  \param[in]    u16It     TIM_IT_xxx
+ *  \param[in]    NewState  ENABLE or DISABLE
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void TIM_ITConfig(TIM_TypeDef *psTim, uint16_t u16It, FunctionalState NewState)
+{
+
+    if (NewState != DISABLE) {
+        psTim->DIER |= u16It;
+    } else {
+        psTim->DIER &= (uint16_t) ~u16It;
+    }
+}
+
+/*******************************************************************************
+ *  function :    TIM_ClearITPendingBit
+ ******************************************************************************/
+/** \brief        Clear timer interrupt flags
+ *
+ *  \type         global
+ *
+ *  \param[in]    psTim     timer stand-in
+ *  \param[in]    u16It     TIM_IT_xxx
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void TIM_ClearITPendingBit(TIM_TypeDef *psTim, uint16_t u16It)
+{
+
+    psTim->SR &= (uint16_t) ~u16It;
+}
+
+/*******************************************************************************
+ *  function :    RCC_APB1PeriphClockCmd
+ ******************************************************************************/
+/** \brief        Peripheral clocks are always on in the simulation
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Periph     not used
+ *  \param[in]    NewState      not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void RCC_APB1PeriphClockCmd(uint32_t u32Periph, FunctionalState NewState)
+{
+
+    (void) u32Periph;
+    (void) NewState;
+}
+
+/*******************************************************************************
+ *  function :    RCC_APB2PeriphClockCmd
+ ******************************************************************************/
+/** \brief        Peripheral clocks are always on in the simulation
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Periph     not used
+ *  \param[in]    NewState      not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void RCC_APB2PeriphClockCmd(uint32_t u32Periph, FunctionalState NewState)
+{
+
+    (void) u32Periph;
+    (void) NewState;
+}
+
+/*******************************************************************************
+ *  function :    RCC_AHB1PeriphClockCmd
+ ******************************************************************************/
+/** \brief        Peripheral clocks are always on in the simulation
+ *
+ *  \type         global
+ *
+ *  \param[in]    u32Periph     not used
+ *  \param[in]    NewState      not used
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void RCC_AHB1PeriphClockCmd(uint32_t u32Periph, FunctionalState NewState)
+{
+
+    (void) u32Periph;
+    (void) NewState;
+}
@@ -0,0 +1,291 @@
+/******************************************************************************/
+/** \file       simUart.c
+ *******************************************************************************
+ *
+ *  \brief      UART of the host simulation. printf and the CARME UART
+ *              functions write to stdout. With SIM_UART_PTY=1 stdout is
+ *              connected to a new pseudo terminal, which can be opened with
+ *              a terminal program like on the board. Output written while
+ *              no terminal is attached is dropped, like on a real UART.
+ *              USART_SendData writes to stdout too. The transmitter is
+ *              always empty, while the TXE interrupt of USART1 is enabled
+ *              its handler is called SIM_UART_TICK_BYTES times per tick,
+ *              the rate of 115200 baud.
+ *              While the RXNE interrupt of USART1 is enabled up to
+ *              SIM_UART_TICK_BYTES bytes per tick are received from stdin,
+ *              or from the pseudo terminal. A byte arriving before the
+ *              last one was read sets the overrun flag and is lost.
+ *
+ *  \author     id101010
+ *
+ *  \date       17.10.2026
+ *
+ *  \remark     Last Modification
+ *               \li id101010, 17.10.2026, Created
+ *               \li id101010, 17.10.2026, USART1 TXE interrupt
+ *               \li id101010, 17.10.2026, USART1 RXNE interrupt
+ *
+ ******************************************************************************/
+/*
+ *  functions  global:
+ *              USART_SendData
+ *              USART_ReceiveData
+ *              USART_GetFlagStatus
+ *              USART_ITConfig
+ *              USART_GetITStatus
+ *  functions  local:
+ *              vSimUartInit
+ *              vSimUartPoll
+ *              vSimUartReceive
+ *
+ ******************************************************************************/
+
+//----- Header-Files -----------------------------------------------------------
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <stm32f4xx.h>
+#include "simInternal.h"
+
+//----- Macros -----------------------------------------------------------------
+#define SIM_UART_TICK_BYTES ( 11 )          /* 115200 baud, 1 ms tick         */
+
+//----- Data types -------------------------------------------------------------
+
+//----- Function prototypes ----------------------------------------------------
+void USART1_IRQHandler(void) __attribute__((weak));
+
+static void vSimUartInit(void) __attribute__((constructor));
+static void vSimUartPoll(void);
+static void vSimUartReceive(void);
+
+//----- Data -------------------------------------------------------------------
+static int iSimUartIn = STDIN_FILENO;   /* Received bytes, -1 after the end   */
+
+//----- Implementation ---------------------------------------------------------
+
+/*******************************************************************************
+ *  function :    USART_SendData
+ ******************************************************************************/
+/** \brief        Send a byte, it is written to stdout at once
+ *
+ *  \type         global
+ *
+ *  \param[in]    psUsart   USART1 or USART3
+ *  \param[in]    u16Data   byte to send
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void USART_SendData(USART_TypeDef *psUsart, uint16_t u16Data)
+{
+
+    (void) psUsart;
+    putchar((char) u16Data);
+}
+
+/*******************************************************************************
+ *  function :    USART_ReceiveData
+ ******************************************************************************/
+/** \brief        Read the received byte, clears RXNE and the overrun flag
+ *
+ *  \type         global
+ *
+ *  \param[in]    psUsart   USART1 or USART3
+ *
+ *  \return       the byte
+ *
+ ******************************************************************************/
+uint16_t USART_ReceiveData(USART_TypeDef *psUsart)
+{
+
+    psUsart->SR &= (uint16_t) ~(USART_FLAG_RXNE | USART_FLAG_ORE);
+    return psUsart->DR;
+}
+
+/*******************************************************************************
+ *  function :    USART_GetFlagStatus
+ ******************************************************************************/
+/** \brief        Status flag, the transmitter is always empty, the receive
+ *                flags are kept in SR
+ *
+ *  \type         global
+ *
+ *  \param[in]    psUsart   USART1 or USART3
+ *  \param[in]    u16Flag   USART_FLAG_TXE, _TC, _RXNE or _ORE
+ *
+ *  \return       SET for the transmit flags and set receive flags
+ *
+ ******************************************************************************/
+FlagStatus USART_GetFlagStatus(USART_TypeDef *psUsart, uint16_t u16Flag)
+{
+
+    if ((u16Flag & (USART_FLAG_TXE | USART_FLAG_TC)) != 0) {
+        return SET;
+    }
+    return ((psUsart->SR & u16Flag) != 0) ? SET : RESET;
+}
+
+/*******************************************************************************
+ *  function :    USART_ITConfig
+ ******************************************************************************/
+/** \brief        Enable or disable an interrupt of the USART, the bit in CR1
+ *                is taken from the interrupt like in the StdPeriph library
+ *
+ *  \type         global
+ *
+ *  \param[in]    psUsart   USART1 or USART3
+ *  \param[in]    u16It     USART_IT_TXE or USART_IT_RXNE
+ *  \param[in]    NewState  ENABLE or DISABLE
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+void USART_ITConfig(USART_TypeDef *psUsart, uint16_t u16It,
+                    FunctionalState NewState)
+{
+
+    uint16_t u16Mask = (uint16_t) (1U << (u16It & 0x1F));
+
+    if (NewState != DISABLE) {
+        psUsart->CR1 |= u16Mask;
+        vSimIrqAttach(vSimUartPoll);
+    } else {
+        psUsart->CR1 &= (uint16_t) ~u16Mask;
+    }
+}
+
+/*******************************************************************************
+ *  function :    USART_GetITStatus
+ ******************************************************************************/
+/** \brief        Interrupt pending: enabled and its flag set
+ *
+ *  \type         global
+ *
+ *  \param[in]    psUsart   USART1 or USART3
+ *  \param[in]    u16It     USART_IT_TXE or USART_IT_RXNE
+ *
+ *  \return       SET if pending
+ *
+ ******************************************************************************/
+ITStatus USART_GetITStatus(USART_TypeDef *psUsart, uint16_t u16It)
+{
+
+    uint16_t u16Enable = (uint16_t) (1U << (u16It & 0x1F));
+    uint16_t u16Flag = (uint16_t) (1U << (u16It >> 8));
+
+    if ((psUsart->CR1 & u16Enable) == 0) {
+        return RESET;
+    }
+    return USART_GetFlagStatus(psUsart, u16Flag);
+}
+
+/*******************************************************************************
+ *  function :    vSimUartInit
+ ******************************************************************************/
+/** \brief        Connect stdout to a pseudo terminal if SIM_UART_PTY is set
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimUartInit(void)
+{
+
+    const char *pcEnv = getenv("SIM_UART_PTY");
+    int iMaster;
+
+    if ((pcEnv == NULL) || (atoi(pcEnv) == 0)) {
+        return;
+    }
+
+    iMaster = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((iMaster < 0) || (grantpt(iMaster) != 0) || (unlockpt(iMaster) != 0)) {
+        fprintf(stderr, "sim: no pseudo terminal, UART stays on stdout\n");
+        return;
+    }
+    fcntl(iMaster, F_SETFL, fcntl(iMaster, F_GETFL) | O_NONBLOCK);
+
+    fprintf(stderr, "sim: UART on %s\n", ptsname(iMaster));
+    fflush(stdout);
+    dup2(iMaster, STDOUT_FILENO);
+    close(iMaster);
+    /* What is typed in the terminal is received */
+    iSimUartIn = STDOUT_FILENO;
+    setvbuf(stdout, NULL, _IOLBF, 0);
+}
+
+/*******************************************************************************
+ *  function :    vSimUartPoll
+ ******************************************************************************/
+/** \brief        Call the USART1 handler for the bytes of one tick, as long
+ *                as the TXE interrupt stays enabled or bytes are received
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimUartPoll(void)
+{
+
+    uint8_t u8Byte;
+
+    if (!u8SimNvicEnabled(USART1_IRQn) || (USART1_IRQHandler == NULL)) {
+        return;
+    }
+    for (u8Byte = 0; u8Byte < SIM_UART_TICK_BYTES; u8Byte++) {
+        if ((USART1->CR1 & (1U << (USART_IT_RXNE & 0x1F))) != 0) {
+            vSimUartReceive();
+        }
+        if ((USART_GetITStatus(USART1, USART_IT_TXE) == RESET) &&
+                (USART_GetITStatus(USART1, USART_IT_RXNE) == RESET)) {
+            break;
+        }
+        USART1_IRQHandler();
+    }
+}
+
+/*******************************************************************************
+ *  function :    vSimUartReceive
+ ******************************************************************************/
+/** \brief        Receive a byte from the input if one is waiting. If the
+ *                last byte was not read yet the new one is lost and the
+ *                overrun flag is set.
+ *
+ *  \type         local
+ *
+ *  \return       void
+ *
+ ******************************************************************************/
+static void vSimUartReceive(void)
+{
+
+    struct pollfd sPoll = { .fd = iSimUartIn, .events = POLLIN };
+    unsigned char ucByte;
+    ssize_t iRead;
+
+    if ((iSimUartIn < 0) || (poll(&sPoll, 1, 0) <= 0)) {
+        return;
+    }
+    iRead = read(iSimUartIn, &ucByte, 1);
+    if (iRead == 0) {
+        /* End of the input, nothing more is received */
+        iSimUartIn = -1;
+        return;
+    }
+    if (iRead < 0) {
+        return;
+    }
+    if ((USART1->SR & USART_FLAG_RXNE) != 0) {
+        USART1->SR |= USART_FLAG_ORE;
+        return;
+    }
+    USART1->DR = ucByte;
+    USART1->SR |= USART_FLAG_RXNE;
+}